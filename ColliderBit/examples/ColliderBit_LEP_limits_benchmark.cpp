@@ -0,0 +1,98 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///
+///  Microbenchmark of the LEP limit contour
+///  interpolation in ColliderBit, comparing the
+///  indexed BaseLimitContainer::limitAverage with
+///  the full scan over all contour segments on a
+///  dense grid of masses.
+///
+///  Usage: ColliderBit_LEP_limits_benchmark [ngrid]
+///
+///  *********************************************
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "gambit/ColliderBit/limits/ALEPHSleptonLimits.hpp"
+#include "gambit/ColliderBit/limits/L3GauginoLimits.hpp"
+#include "gambit/ColliderBit/limits/L3SleptonLimits.hpp"
+#include "gambit/ColliderBit/limits/OPALGauginoLimits.hpp"
+
+using namespace Gambit::ColliderBit;
+
+namespace
+{
+  const double mZ = 91.1876;
+
+  /// Time both lookups over an ngrid x ngrid grid of (x, y) masses, and compare their results.
+  void benchmark(const std::string& name, const BaseLimitContainer& limits,
+                 double xlow, double xhigh, double ylow, double yhigh, int ngrid)
+  {
+    typedef std::chrono::steady_clock clock;
+    double sumIndexed = 0, sumFullScan = 0, maxRelDiff = 0;
+    int nDiffer = 0;
+
+    // Build the index outside the timed loop
+    limits.limitAverage(xlow, ylow, mZ);
+
+    clock::time_point start = clock::now();
+    for (int i = 0; i <= ngrid; i++)
+      for (int j = 0; j <= ngrid; j++)
+        sumIndexed += std::min(1e10, limits.limitAverage(xlow + (xhigh-xlow)*i/ngrid, ylow + (yhigh-ylow)*j/ngrid, mZ));
+    double tIndexed = std::chrono::duration<double>(clock::now() - start).count();
+
+    start = clock::now();
+    for (int i = 0; i <= ngrid; i++)
+      for (int j = 0; j <= ngrid; j++)
+        sumFullScan += std::min(1e10, limits.limitAverageFullScan(xlow + (xhigh-xlow)*i/ngrid, ylow + (yhigh-ylow)*j/ngrid, mZ));
+    double tFullScan = std::chrono::duration<double>(clock::now() - start).count();
+
+    for (int i = 0; i <= ngrid; i++)
+      for (int j = 0; j <= ngrid; j++)
+      {
+        double x = xlow + (xhigh-xlow)*i/ngrid, y = ylow + (yhigh-ylow)*j/ngrid;
+        double a = limits.limitAverage(x, y, mZ), b = limits.limitAverageFullScan(x, y, mZ);
+        if (a == b) continue;
+        nDiffer++;
+        if (std::isfinite(a) and std::isfinite(b)) maxRelDiff = std::max(maxRelDiff, std::abs(a-b)/std::abs(b));
+        else maxRelDiff = std::numeric_limits<double>::infinity();
+      }
+
+    int npoints = (ngrid+1)*(ngrid+1);
+    std::cout << std::left << std::setw(42) << name << std::right
+              << std::setw(12) << 1e6*tFullScan/npoints << " us"
+              << std::setw(12) << 1e6*tIndexed/npoints << " us"
+              << std::setw(10) << std::setprecision(3) << tFullScan/tIndexed << "x"
+              << std::setw(10) << nDiffer
+              << std::setw(14) << maxRelDiff << std::endl;
+    if (std::abs(sumIndexed - sumFullScan) > 1e-9*std::abs(sumFullScan))
+      std::cout << "  WARNING: grid sums differ: " << sumIndexed << " vs " << sumFullScan << std::endl;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int ngrid = (argc > 1 ? std::atoi(argv[1]) : 200);
+
+  std::cout << "LEP limit interpolation on a " << ngrid+1 << " x " << ngrid+1 << " mass grid, time per point:" << std::endl;
+  std::cout << std::left << std::setw(42) << "Limit" << std::right << std::setw(15) << "full scan" << std::setw(15) << "indexed"
+            << std::setw(11) << "speedup" << std::setw(10) << "differ" << std::setw(14) << "max rel diff" << std::endl;
+
+  benchmark("ALEPHSelectronLimitAt208GeV", ALEPHSelectronLimitAt208GeV(), 45., 115., 0., 100., ngrid);
+  benchmark("ALEPHSmuonLimitAt208GeV", ALEPHSmuonLimitAt208GeV(), 45., 115., 0., 100., ngrid);
+  benchmark("ALEPHStauLimitAt208GeV", ALEPHStauLimitAt208GeV(), 45., 115., 0., 100., ngrid);
+  benchmark("L3SelectronLimitAt205GeV", L3SelectronLimitAt205GeV(), 45., 115., 0., 100., ngrid);
+  benchmark("L3SmuonLimitAt205GeV", L3SmuonLimitAt205GeV(), 45., 115., 0., 100., ngrid);
+  benchmark("L3StauLimitAt205GeV", L3StauLimitAt205GeV(), 45., 115., 0., 100., ngrid);
+  benchmark("L3NeutralinoAllChannelsLimitAt188pt6GeV", L3NeutralinoAllChannelsLimitAt188pt6GeV(), 0., 200., 0., 100., ngrid);
+  benchmark("L3CharginoAllChannelsLimitAt188pt6GeV", L3CharginoAllChannelsLimitAt188pt6GeV(), 45., 100., 0., 100., ngrid);
+  benchmark("OPALCharginoHadronicLimitAt208GeV", OPALCharginoHadronicLimitAt208GeV(), 75., 105., 0., 105., ngrid);
+  benchmark("OPALNeutralinoHadronicLimitAt208GeV", OPALNeutralinoHadronicLimitAt208GeV(), 0., 200., 0., 100., ngrid);
+
+  return 0;
+}
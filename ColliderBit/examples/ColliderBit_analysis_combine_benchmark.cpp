@@ -0,0 +1,151 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///
+///  Microbenchmark of combining the analysis
+///  results of the threads of the ColliderBit event
+///  loop, comparing one container at a time in a
+///  critical section with the pairwise parallel
+///  reduce_analyses, for increasing thread counts.
+///  Both are checked to add up all the signal, and
+///  to give the cross-section as the mean over all
+///  threads weighted by their numbers of events.
+///
+///  Usage: ColliderBit_analysis_combine_benchmark [nevents per thread]
+///
+///  *********************************************
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <omp.h>
+
+#include "gambit/ColliderBit/Utils.hpp"
+#include "gambit/ColliderBit/analyses/HEPUtilsAnalysisContainer.hpp"
+#include "ColliderBit_example_events.hpp"
+
+using namespace Gambit::ColliderBit;
+
+namespace
+{
+
+  /// Total signal over all signal regions of all analyses
+  double total_signal(HEPUtilsAnalysisContainer& container)
+  {
+    double total = 0;
+    for (HEPUtilsAnalysis* analysis : container.analyses)
+      for (const SignalRegionData& sr : analysis->get_results()) total += sr.n_signal;
+    return total;
+  }
+
+  /// One container per thread, each having analysed its own nevents events.
+  /// @return The total signal of all containers
+  double make_containers(const std::vector<std::string>& names, int nThreads, int nevents,
+                         std::vector<HEPUtilsAnalysisContainer*>& containers)
+  {
+    double total = 0;
+    containers.resize(nThreads);
+    for (int t = 0; t < nThreads; t++)
+    {
+      containers[t] = new HEPUtilsAnalysisContainer();
+      containers[t]->init(names);
+      std::mt19937_64 gen(1000 + t);
+      set_random_seed(1000 + t);
+      HEPUtils::Event event;
+      for (int i = 0; i < nevents; i++)
+      {
+        make_event(gen, event);
+        containers[t]->analyze(event);
+      }
+      containers[t]->add_xsec(1. + 0.01*t, 0.1);
+      total += total_signal(*containers[t]);
+    }
+    return total;
+  }
+
+  /// Mean cross-section of the containers, weighted by their numbers of events
+  double expected_xsec(const std::vector<HEPUtilsAnalysisContainer*>& containers)
+  {
+    double xsecTimesEvents = 0, events = 0;
+    for (HEPUtilsAnalysisContainer* container : containers)
+    {
+      const HEPUtilsAnalysis* analysis = container->analyses.front();
+      xsecTimesEvents += analysis->xsec() * analysis->num_events();
+      events += analysis->num_events();
+    }
+    return xsecTimesEvents / events;
+  }
+
+  /// Time both ways of combining nThreads containers, and check that both add up all the signal
+  /// and give the event-weighted mean cross-section.
+  /// (Some analyses draw b-tags from their own random numbers, so the events of the two runs
+  /// need not pass the same cuts.)
+  void benchmark(const std::vector<std::string>& names, int nThreads, int nevents)
+  {
+    typedef std::chrono::steady_clock clock;
+    omp_set_num_threads(nThreads);
+    std::vector<HEPUtilsAnalysisContainer*> containers;
+
+    // One thread at a time, as the event loop used to do at END_SUBPROCESS
+    const double criticalExpected = make_containers(names, nThreads, nevents, containers);
+    const double criticalXsec = expected_xsec(containers);
+    HEPUtilsAnalysisContainer critical;
+    critical.init(names);
+    clock::time_point start = clock::now();
+    #pragma omp parallel
+    {
+      HEPUtilsAnalysisContainer* mine = containers[omp_get_thread_num()];
+      #pragma omp critical (access_globalAnalyses)
+      {
+        critical.improve_xsec(mine);
+        critical.add(mine);
+      }
+    }
+    const double tCritical = std::chrono::duration<double>(clock::now() - start).count();
+    for (HEPUtilsAnalysisContainer* container : containers) delete container;
+
+    // Pairwise in parallel
+    const double reducedExpected = make_containers(names, nThreads, nevents, containers);
+    const double reducedXsec = expected_xsec(containers);
+    HEPUtilsAnalysisContainer reduced;
+    reduced.init(names);
+    start = clock::now();
+    reduce_analyses(containers);
+    reduced.improve_xsec(containers.front());
+    reduced.add(containers.front());
+    const double tReduced = std::chrono::duration<double>(clock::now() - start).count();
+    for (HEPUtilsAnalysisContainer* container : containers) delete container;
+
+    std::cout << std::setw(8) << nThreads << std::setw(14) << std::setprecision(3) << 1e3*tCritical << " ms"
+              << std::setw(14) << 1e3*tReduced << " ms" << std::setw(10) << tCritical/tReduced << "x"
+              << std::setw(16) << std::max(std::abs(total_signal(critical) - criticalExpected),
+                                           std::abs(total_signal(reduced) - reducedExpected))
+              << std::setw(16) << std::max(std::abs(critical.analyses.front()->xsec()/criticalXsec - 1),
+                                           std::abs(reduced.analyses.front()->xsec()/reducedXsec - 1)) << std::endl;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int nevents = (argc > 1 ? std::atoi(argv[1]) : 200);
+
+  // All analyses that do not need external output
+  std::vector<std::string> names = analysisNames();
+  names.erase(std::remove(names.begin(), names.end(), "Perf"), names.end());
+  std::sort(names.begin(), names.end());
+
+  std::cout << "Combining " << names.size() << " analyses after " << nevents << " events per thread:" << std::endl;
+  std::cout << std::setw(8) << "Threads" << std::setw(17) << "critical" << std::setw(17) << "pairwise"
+            << std::setw(11) << "speedup" << std::setw(16) << "signal lost" << std::setw(16) << "xsec rel. error"
+            << std::endl;
+
+  const int maxThreads = omp_get_max_threads();
+  for (int nThreads = 1; nThreads < maxThreads; nThreads *= 2) benchmark(names, nThreads, nevents);
+  benchmark(names, maxThreads, nevents);
+
+  return 0;
+}
@@ -0,0 +1,341 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Check that the one-pass particle ancestry of
+///  EventAncestry gives the same detector-level
+///  events as the recursive fromHadron walks it
+///  replaced in the BuckFast converter.
+///
+///  First, without Pythia, the fromBottom, fromTau
+///  and fromHadron flags of EventAncestry and of the
+///  recursive functions of Py8Utils are compared
+///   - with the known ancestry of a few hand-made
+///     event records;
+///   - with each other, on random records.
+///  The hand-made records mirror Pythia8::Event, and
+///  the isParton and isHadron rules of Pythia 8.212.
+///
+///  Then, if an SLHA file is given, fixed events
+///  are generated by Pythia from it and a fixed
+///  SLHA file and a fixed seed.  For every event
+///   - the fromBottom, fromTau and fromHadron flags
+///     of every particle are compared with the
+///     recursive functions of Py8Utils;
+///   - the event is converted and smeared by the
+///     ATLAS and CMS BuckFast detectors, once with
+///     EventAncestry and once with the recursive
+///     walks, from the same random numbers, and
+///     the resulting objects are compared.
+///
+///  Usage: ColliderBit_ancestry_check [<Pythia xmldoc path> <SLHA file> [-n nevents]]
+///
+///  *********************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+// Always required for the standalone main file
+#include "gambit/Elements/standalone_module.hpp"
+#include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
+#include "gambit/ColliderBit/Utils.hpp"
+
+using namespace Gambit::ColliderBit;
+using namespace std;
+
+namespace
+{
+
+  /// A hand-made event record, with the parts of the Pythia8::Event interface the ancestry walks use
+  class Record
+  {
+    public:
+
+      /// An entry of the record
+      class Entry
+      {
+        public:
+          Entry(int id, const vector<int>& mothers) : _id(id), _mothers(mothers) { }
+          int id() const { return _id; }
+          vector<int> motherList() const { return _mothers; }
+          /// As ParticleDataEntry::isParton of Pythia 8.212: gluons, quarks but the top, and diquarks
+          bool isParton() const
+          {
+            const int a = abs(_id);
+            return a == 21 or (a != 0 and a < 6) or (a > 1000 and a < 5510 and (a/10)%10 == 0);
+          }
+          /// As ParticleDataEntry::isHadron of Pythia 8.212
+          bool isHadron() const
+          {
+            const int a = abs(_id);
+            if (a <= 100 or (a >= 1000000 and a <= 9000000) or a >= 9900000) return false;
+            if (a == 130 or a == 310) return true;
+            return not (a%10 == 0 or (a/10)%10 == 0 or (a/100)%10 == 0);
+          }
+        private:
+          int _id;
+          vector<int> _mothers;
+      };
+
+      /// Start with the system entry, as Pythia does
+      Record() { add(90, {}); }
+      /// Add an entry with ID @a id and the given mothers, and return its index
+      int add(int id, const vector<int>& mothers) { _entries.push_back(Entry(id, mothers)); return size() - 1; }
+      int size() const { return _entries.size(); }
+      const Entry& operator[](int i) const { return _entries[i]; }
+
+    private:
+      vector<Entry> _entries;
+  };
+
+  /// Expected ancestry of a particle of a hand-made record
+  enum { B = 1, T = 2, H = 4 };
+
+  /// Compare the flags of EventAncestry and of the recursive walks for every particle of @a record,
+  /// with each other and, if given, with the @a expected ones.
+  /// @return The number of particles for which they differ
+  int check_record(const string& name, const Record& record, const vector<int>& expected = vector<int>())
+  {
+    static int reported = 0;
+    EventAncestry ancestry;
+    ancestry.classify(record);
+    int bad = 0;
+    for (int i = 0; i < record.size(); ++i)
+    {
+      const int onePass = (ancestry.fromBottom(i) ? B : 0) | (ancestry.fromTau(i) ? T : 0) | (ancestry.fromHadron(i) ? H : 0);
+      const int recursive = (fromBottom(i, record) ? B : 0) | (fromTau(i, record) ? T : 0) | (fromHadron(i, record) ? H : 0);
+      const bool ok = (onePass == recursive and (expected.empty() or onePass == expected[i]));
+      if (ok) continue;
+      bad++;
+      if (reported++ < 10)
+        cout << "  " << name << ": particle " << i << " (ID " << record[i].id() << ") has flags " << onePass
+             << " (one pass), " << recursive << " (recursive)"
+             << (expected.empty() ? "" : ", expected " + to_string(expected[i])) << endl;
+    }
+    return bad;
+  }
+
+  /// Hand-made records with known ancestry.
+  /// @return The number of particles with wrong flags
+  int check_known_records()
+  {
+    int bad = 0;
+
+    // b quarks from gluon fusion hadronize to a B0, which decays semileptonically to a D- and a muon
+    Record bDecay;
+    bDecay.add(2212, {0});                            //  1: beam protons
+    bDecay.add(2212, {0});                            //  2
+    bDecay.add(21, {1});                              //  3: incoming gluons
+    bDecay.add(21, {2});                              //  4
+    bDecay.add(5, {3, 4});                            //  5: b bbar
+    bDecay.add(-5, {3, 4});                           //  6
+    bDecay.add(511, {5, 6});                          //  7: B0 from the string
+    bDecay.add(-411, {7});                            //  8: D-
+    bDecay.add(-13, {7});                             //  9: mu+
+    bDecay.add(14, {7});                              // 10: nu_mu
+    bDecay.add(321, {8});                             // 11: K+
+    bDecay.add(111, {8});                             // 12: pi0
+    bDecay.add(22, {12});                             // 13: photons
+    bDecay.add(22, {12});                             // 14
+    bad += check_record("b decay", bDecay, {0, H, H, 0, 0, B, B, B|H, B|H, B|H, B|H, B|H, B|H, B|H, B|H});
+
+    // A W from u dbar decays to a tau, which decays hadronically after a replica; a photon is radiated
+    Record tauDecay;
+    tauDecay.add(2212, {0});                          //  1: beam protons
+    tauDecay.add(2212, {0});                          //  2
+    tauDecay.add(2, {1});                             //  3: u
+    tauDecay.add(-1, {2});                            //  4: dbar
+    tauDecay.add(24, {3, 4});                         //  5: W+
+    tauDecay.add(-15, {5});                           //  6: tau+
+    tauDecay.add(16, {5});                            //  7: nu_tau
+    tauDecay.add(-15, {6});                           //  8: replica of the tau+
+    tauDecay.add(211, {8});                           //  9: pi+
+    tauDecay.add(-16, {8});                           // 10: nubar_tau
+    tauDecay.add(22, {5});                            // 11: photon from the W
+    bad += check_record("tau decay", tauDecay, {0, H, H, 0, 0, 0, T, 0, T, T|H, T, 0});
+
+    // Mothers listed after their daughters, two mothers, and a diquark that stops the walk
+    Record unordered;
+    unordered.add(22, {3});                           //  1: photon from the tau below
+    unordered.add(13, {3, 4});                        //  2: muon from the tau and the pion
+    unordered.add(15, {0});                           //  3: tau-
+    unordered.add(-211, {0});                         //  4: pi-
+    unordered.add(11, {2});                           //  5: electron from the muon
+    unordered.add(2101, {4});                         //  6: ud_0 diquark from the pion
+    unordered.add(2112, {6});                         //  7: neutron from the diquark
+    bad += check_record("unordered", unordered, {0, T, T|H, T, H, T|H, 0, H});
+
+    return bad;
+  }
+
+  /// Compare EventAncestry with the recursive walks on random records
+  /// @return The number of particles for which they differ
+  int check_random_records(int nRecords, int& nParticles)
+  {
+    const vector<int> ids = {21, 1, -2, 5, -5, 6, 15, -15, 11, -13, 12, 22, 23, 24, 1000022, 2101, 211, -211, 111,
+                             130, 511, -521, 421, 5122, 2212, 2112};
+    mt19937_64 rng(2718);
+    int bad = 0;
+    nParticles = 0;
+    for (int r = 0; r < nRecords; ++r)
+    {
+      // Mothers come earlier in a random order, so that there are no loops, but not necessarily earlier
+      // in the record.  Most particles have one mother, as in a Pythia record.
+      const int n = 2 + rng() % 40;
+      vector<int> order(n);
+      for (int i = 0; i < n; ++i) order[i] = i + 1;
+      shuffle(order.begin(), order.end(), rng);
+      vector<int> id(n + 1);
+      vector<vector<int> > mothers(n + 1);
+      for (int k = 0; k < n; ++k)
+      {
+        const int i = order[k];
+        id[i] = ids[rng() % ids.size()];
+        const int nMothers = (k == 0 or rng() % 5 == 0) ? (k == 0 ? 1 : 2) : 1;
+        for (int m = 0; m < nMothers; ++m) mothers[i].push_back(k == 0 ? 0 : order[rng() % k]);
+      }
+      Record record;
+      for (int i = 1; i <= n; ++i) record.add(id[i], mothers[i]);
+      bad += check_record("random record " + to_string(r), record);
+      nParticles += record.size();
+    }
+    return bad;
+  }
+
+  /// Whether two collections of particles hold the same objects, in the same order
+  bool same(const vector<HEPUtils::Particle*>& a, const vector<HEPUtils::Particle*>& b)
+  {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+      if (a[i]->pid() != b[i]->pid() or a[i]->mom().px() != b[i]->mom().px() or a[i]->mom().py() != b[i]->mom().py()
+          or a[i]->mom().pz() != b[i]->mom().pz() or a[i]->mom().E() != b[i]->mom().E()) return false;
+    return true;
+  }
+
+  /// Whether two collections of jets hold the same jets and tags, in the same order
+  bool same(const vector<HEPUtils::Jet*>& a, const vector<HEPUtils::Jet*>& b)
+  {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+      if (a[i]->btag() != b[i]->btag() or a[i]->ctag() != b[i]->ctag() or a[i]->mom().px() != b[i]->mom().px()
+          or a[i]->mom().py() != b[i]->mom().py() or a[i]->mom().pz() != b[i]->mom().pz()
+          or a[i]->mom().E() != b[i]->mom().E()) return false;
+    return true;
+  }
+
+  /// Whether two detector-level events are the same, object for object
+  bool same(const HEPUtils::Event& a, const HEPUtils::Event& b)
+  {
+    return same(a.electrons(), b.electrons()) and same(a.muons(), b.muons()) and same(a.taus(), b.taus())
+       and same(a.photons(), b.photons()) and same(a.invisible_particles(), b.invisible_particles())
+       and same(a.jets(), b.jets()) and a.missingmom().px() == b.missingmom().px()
+       and a.missingmom().py() == b.missingmom().py();
+  }
+
+  /// Convert and smear @a event with and without EventAncestry, from the same random numbers.
+  /// @return Whether both give the same detector-level event
+  bool check_detector(BuckFastBase& onePass, BuckFastBase& recursive, const Pythia8::Event& event, uint64_t seed)
+  {
+    HEPUtils::Event oneOut, recursiveOut;
+    set_random_seed(seed);
+    onePass.processEvent(event, oneOut);
+    set_random_seed(seed);
+    recursive.processEvent(event, recursiveOut);
+    return same(oneOut, recursiveOut);
+  }
+
+}
+
+int main(int argc, char* argv[])
+{
+  initialise_standalone_logs("runs/ColliderBit_ancestry_check/logs/");
+
+  int nEvents = 1000;
+  vector<string> args;
+  for (int i = 1; i < argc; i++)
+  {
+    if (string(argv[i]) == "-n" and i + 1 < argc) nEvents = atoi(argv[++i]);
+    else args.push_back(argv[i]);
+  }
+  if (not args.empty() and args.size() != 2)
+  {
+    cerr << "Usage: " << argv[0] << " [<Pythia xmldoc path> <SLHA file> [-n nevents]]" << endl;
+    return 1;
+  }
+
+  const int badKnown = check_known_records();
+  cout << (badKnown == 0 ? "OK   " : "FAIL ") << "hand-made records: " << badKnown
+       << " particles with wrong ancestry flags" << endl;
+  const int nRandom = 100000;
+  int nRandomParticles;
+  const int badRandom = check_random_records(nRandom, nRandomParticles);
+  cout << (badRandom == 0 ? "OK   " : "FAIL ") << "random records: " << badRandom << " of " << nRandomParticles
+       << " particles in " << nRandom << " records differ from the recursive walks" << endl;
+  if (args.empty()) return (badKnown > 0 or badRandom > 0) ? 1 : 0;
+
+  if (not Backends::backendInfo().works["Pythia8.212"]) backend_error().raise(LOCAL_INFO, "Pythia 8.212 is missing!");
+
+  SLHAea::Coll slha;
+  ifstream in(args[1]);
+  if (!in)
+  {
+    cerr << "Could not read " << args[1] << endl;
+    return 1;
+  }
+  slha.read(in);
+
+  SpecializablePythia pythia;
+  vector<string> options = {"SLHA:file = slhaea", "Next:numberCount = 0", "Random:seed = 12345"};
+  stringstream initOutput;
+  pythia.resetSpecialization("Pythia_SUSY_LHC_8TeV");
+  pythia.init(args[0], options, &slha, initOutput);
+
+  BuckFastSmearATLAS atlas, atlasRecursive;
+  BuckFastSmearCMS cms, cmsRecursive;
+  atlasRecursive.recursiveAncestry = true;
+  cmsRecursive.recursiveAncestry = true;
+
+  EventAncestry ancestry;
+  Pythia8::Event event;
+  int generated = 0, badFlags = 0, badATLAS = 0, badCMS = 0;
+  for (int i = 0; i < nEvents; i++)
+  {
+    try
+    {
+      pythia.nextEvent(event);
+    }
+    catch (SpecializablePythia::EventGenerationError&)
+    {
+      continue;
+    }
+    generated++;
+
+    ancestry.classify(event);
+    for (int j = 0; j < event.size(); ++j)
+    {
+      if (ancestry.fromBottom(j) != fromBottom(j, event) or ancestry.fromTau(j) != fromTau(j, event)
+          or ancestry.fromHadron(j) != fromHadron(j, event))
+      {
+        if (badFlags++ < 5)
+          cout << "  event " << i << ": ancestry of particle " << j << " (ID " << event[j].id()
+               << ") differs from the recursive walks" << endl;
+      }
+    }
+
+    if (not check_detector(atlas, atlasRecursive, event, 2*i + 1)) badATLAS++;
+    if (not check_detector(cms, cmsRecursive, event, 2*i + 2)) badCMS++;
+  }
+
+  cout << (badFlags == 0 ? "OK   " : "FAIL ") << "ancestry flags: " << badFlags << " particles differ in "
+       << generated << " events" << endl;
+  cout << (badATLAS == 0 ? "OK   " : "FAIL ") << "BuckFast ATLAS: " << badATLAS << " of " << generated
+       << " smeared events differ" << endl;
+  cout << (badCMS == 0 ? "OK   " : "FAIL ") << "BuckFast CMS: " << badCMS << " of " << generated
+       << " smeared events differ" << endl;
+
+  return (badKnown > 0 or badRandom > 0 or badFlags > 0 or badATLAS > 0 or badCMS > 0) ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Benchmark of the event cache of the
+///  ColliderBit event loop: the time to record,
+///  write, read and replay the events of one
+///  collider, against the time to run all
+///  analyses on them.  Replayed events are
+///  checked to give the same signal as the
+///  recorded ones, with the same random numbers
+///  for the analyses.
+///
+///  Events are synthetic, as no event generator
+///  is run here; the time the cache saves on
+///  replay is the generation and detector
+///  simulation time, which this does not measure.
+///
+///  Usage: ColliderBit_event_cache_benchmark [nevents] [cache file]
+///
+///  *********************************************
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gambit/ColliderBit/EventCache.hpp"
+#include "gambit/ColliderBit/Utils.hpp"
+#include "gambit/ColliderBit/analyses/HEPUtilsAnalysisContainer.hpp"
+#include "ColliderBit_example_events.hpp"
+
+using namespace Gambit::ColliderBit;
+
+namespace
+{
+
+  typedef std::chrono::steady_clock Clock;
+
+  double seconds_since(Clock::time_point start)
+  {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  }
+
+  /// Seed the random numbers of the analyses, which are drawn from both ColliderBit's generator and std::rand
+  void reseed(unsigned seed)
+  {
+    set_random_seed(seed);
+    std::srand(seed);
+  }
+
+  /// Total signal over all signal regions of all analyses
+  double total_signal(HEPUtilsAnalysisContainer& container)
+  {
+    double total = 0;
+    for (HEPUtilsAnalysis* analysis : container.analyses)
+      for (const SignalRegionData& sr : analysis->peek_results()) total += sr.n_signal;
+    return total;
+  }
+
+}
+
+int main(int argc, char* argv[])
+{
+  const int nevents = (argc > 1 ? std::atoi(argv[1]) : 100000);
+  const std::string filename = (argc > 2 ? argv[2] : "ColliderBit_event_cache_benchmark.events");
+
+  // Perf needs external output, and is left out.
+  std::vector<std::string> names = analysisNames();
+  names.erase(std::remove(names.begin(), names.end(), "Perf"), names.end());
+  HEPUtilsAnalysisContainer generated, replayed;
+  generated.init(names);
+  replayed.init(names);
+
+  // Some analyses print per event
+  std::stringstream silenced;
+  std::streambuf* coutbuf = std::cout.rdbuf(silenced.rdbuf());
+  std::streambuf* cerrbuf = std::cerr.rdbuf(silenced.rdbuf());
+
+  std::mt19937_64 gen(12345);
+  HEPUtils::Event event;
+  EventCache cache;
+  double makeTime = 0, recordTime = 0, analysisTime = 0, replayTime = 0, replayAnalysisTime = 0;
+
+  cache.startRecording(nevents, 12345);
+  for (int i = 0; i < nevents; i++)
+  {
+    Clock::time_point start = Clock::now();
+    make_event(gen, event);
+    makeTime += seconds_since(start);
+    start = Clock::now();
+    cache.record(i, event);
+    recordTime += seconds_since(start);
+    reseed(i + 1);
+    start = Clock::now();
+    generated.analyze(event);
+    analysisTime += seconds_since(start);
+    silenced.str("");
+  }
+  cache.set_xsec(1., 0.1, 2.);
+
+  Clock::time_point start = Clock::now();
+  const bool written = cache.write(filename);
+  const double writeTime = seconds_since(start);
+  start = Clock::now();
+  EventCache readCache;
+  const bool read = readCache.read(filename);
+  const double readTime = seconds_since(start);
+  std::remove(filename.c_str());
+
+  int replayedEvents = 0;
+  for (int i = 0; i < readCache.size(); i++)
+  {
+    start = Clock::now();
+    const bool held = readCache.replay(i, event);
+    replayTime += seconds_since(start);
+    if (not held) continue;
+    replayedEvents++;
+    reseed(i + 1);
+    start = Clock::now();
+    replayed.analyze(event);
+    replayAnalysisTime += seconds_since(start);
+    silenced.str("");
+  }
+  const double signal = total_signal(generated), replayedSignal = total_signal(replayed);
+  std::cout.rdbuf(coutbuf);
+  std::cerr.rdbuf(cerrbuf);
+
+  if (not written or not read)
+  {
+    std::cerr << "Could not " << (written ? "read " : "write ") << filename << std::endl;
+    return 1;
+  }
+
+  const double perEvent = 1e6 / nevents;
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << nevents << " events, " << names.size() << " analyses" << std::endl;
+  std::cout << "  make event (synthetic): " << makeTime*perEvent << " us/event" << std::endl;
+  std::cout << "  record:                 " << recordTime*perEvent << " us/event" << std::endl;
+  std::cout << "  write:                  " << writeTime*perEvent << " us/event" << std::endl;
+  std::cout << "  read:                   " << readTime*perEvent << " us/event" << std::endl;
+  std::cout << "  replay:                 " << replayTime*perEvent << " us/event" << std::endl;
+  std::cout << "  analyses:               " << analysisTime*perEvent << " us/event (generated), "
+            << replayAnalysisTime*perEvent << " us/event (replayed)" << std::endl;
+
+  const bool same = (replayedEvents == nevents and signal == replayedSignal);
+  std::cout << (same ? "OK   " : "FAIL ") << replayedEvents << " of " << nevents << " events replayed, signal "
+            << replayedSignal << " replayed against " << signal << " generated" << std::endl;
+  return same ? 0 : 1;
+}
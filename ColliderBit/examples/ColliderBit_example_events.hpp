@@ -0,0 +1,43 @@
+#pragma once
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Synthetic detector-level events for the
+///  ColliderBit benchmarks, which run the analyses
+///  without an event generator.
+///
+///  *********************************************
+
+#include <cmath>
+#include <random>
+
+#include "HEPUtils/Event.h"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+    /// Make an event with a few jets and leptons and some missing momentum.
+    inline void make_event(std::mt19937_64& gen, HEPUtils::Event& event)
+    {
+      std::exponential_distribution<double> jetPt(1./150.), lepPt(1./60.), met(1./200.);
+      std::uniform_real_distribution<double> eta(-2.5, 2.5), phi(0, 2*M_PI), flat(0, 1);
+      event.clear();
+      const int nJets = 2 + int(5*flat(gen)), nLeptons = int(4*flat(gen));
+      for (int i = 0; i < nJets; i++)
+      {
+        HEPUtils::P4 p = HEPUtils::P4::mkEtaPhiMPt(eta(gen), phi(gen), 5., 25. + jetPt(gen));
+        event.add_jet(new HEPUtils::Jet(p, flat(gen) < 0.3));
+      }
+      for (int i = 0; i < nLeptons; i++)
+      {
+        HEPUtils::P4 p = HEPUtils::P4::mkEtaPhiMPt(eta(gen), phi(gen), 0., 10. + lepPt(gen));
+        HEPUtils::Particle* lepton = new HEPUtils::Particle(p, (flat(gen) < 0.5 ? 11 : 13) * (flat(gen) < 0.5 ? 1 : -1));
+        lepton->set_prompt();
+        event.add_particle(lepton);
+      }
+      event.set_missingmom(HEPUtils::P4::mkXYZM(met(gen)*cos(phi(gen)), met(gen)*sin(phi(gen)), 0, 0));
+    }
+
+  }
+}
@@ -0,0 +1,93 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///
+///  Microbenchmark of the anti-kt jet clustering
+///  in the ColliderBit event converters, comparing
+///  a fresh ClusterSequence per event with the
+///  reusable JetClusteringWorkspace, at typical
+///  final-state multiplicities of SUSY events.
+///
+///  Usage: ColliderBit_jet_clustering_benchmark [nevents]
+///
+///  *********************************************
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "gambit/ColliderBit/detectors/JetClusteringWorkspace.hpp"
+
+using namespace Gambit::ColliderBit;
+
+namespace
+{
+  const double R = 0.4, ptmin = 10.;
+
+  /// Make an event of n massless particles, soft and roughly uniform in eta and phi, plus a few hard ones.
+  void make_event(std::mt19937_64& gen, int n, std::vector<FJNS::PseudoJet>& particles)
+  {
+    std::exponential_distribution<double> soft(1./2.), hard(1./100.);
+    std::uniform_real_distribution<double> eta(-4.9, 4.9), phi(0, 2*M_PI);
+    particles.clear();
+    for (int i = 0; i < n; i++)
+    {
+      double pt = (i < 6 ? 20. + hard(gen) : 0.2 + soft(gen)), y = eta(gen), ph = phi(gen);
+      particles.push_back(FJNS::PseudoJet(pt*cos(ph), pt*sin(ph), pt*sinh(y), pt*cosh(y)));
+    }
+  }
+
+  /// Time both clustering methods on nevents events of multiplicity n, and compare their jets.
+  void benchmark(int n, int nevents)
+  {
+    typedef std::chrono::steady_clock clock;
+    std::mt19937_64 gen(12345);
+    std::vector<std::vector<FJNS::PseudoJet> > events(nevents);
+    for (auto& event : events) make_event(gen, n, event);
+
+    double tFresh = 0, tReused = 0;
+    int nDiffer = 0;
+    JetClusteringWorkspace workspace;
+    for (const auto& event : events)
+    {
+      clock::time_point start = clock::now();
+      const FJNS::JetDefinition jet_def(FJNS::antikt_algorithm, R);
+      FJNS::ClusterSequence cseq(event, jet_def);
+      std::vector<FJNS::PseudoJet> fresh = sorted_by_pt(cseq.inclusive_jets(ptmin));
+      tFresh += std::chrono::duration<double>(clock::now() - start).count();
+
+      start = clock::now();
+      workspace.particles().assign(event.begin(), event.end());
+      const std::vector<FJNS::PseudoJet>& reused = workspace.cluster(R, ptmin);
+      tReused += std::chrono::duration<double>(clock::now() - start).count();
+
+      bool same = (fresh.size() == reused.size());
+      for (size_t i = 0; same and i < fresh.size(); i++)
+        same = (fresh[i].px() == reused[i].px() and fresh[i].py() == reused[i].py() and fresh[i].pz() == reused[i].pz()
+                and fresh[i].E() == reused[i].E() and fresh[i].constituents().size() == reused[i].constituents().size());
+      if (not same) nDiffer++;
+    }
+
+    std::cout << std::setw(12) << n
+              << std::setw(14) << std::setprecision(3) << 1e6*tFresh/nevents << " us"
+              << std::setw(14) << 1e6*tReused/nevents << " us"
+              << std::setw(10) << tFresh/tReused << "x"
+              << std::setw(10) << nDiffer << std::endl;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int nevents = (argc > 1 ? std::atoi(argv[1]) : 2000);
+
+  std::cout << "Anti-kt R = " << R << " clustering of " << nevents << " events, time per event:" << std::endl;
+  std::cout << std::setw(12) << "particles" << std::setw(17) << "fresh" << std::setw(17) << "reused"
+            << std::setw(11) << "speedup" << std::setw(10) << "differ" << std::endl;
+
+  for (int n : {50, 100, 200, 400, 800}) benchmark(n, nevents);
+
+  return 0;
+}
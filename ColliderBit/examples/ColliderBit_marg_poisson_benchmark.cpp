@@ -0,0 +1,156 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///
+///  Check and microbenchmark of the marginalised
+///  Poisson signal region likelihoods in
+///  ColliderBit, comparing the native batched
+///  lnlike_marg_poisson with the nulike backend
+///  functions lnlike_marg_poisson_lognormal_error
+///  and lnlike_marg_poisson_gaussian_error:
+///   - on a grid of observed counts n, predictions
+///     lambda and relative errors, reporting the
+///     largest difference in ln L, which must be
+///     below 1e-4;
+///   - in timing, on random analyses, against one
+///     backend call per likelihood as done in
+///     calc_LHC_LogLike with use_marg_poisson_backend.
+///
+///  Usage: ColliderBit_marg_poisson_benchmark [nanalyses] [nSRs]
+///
+///  *********************************************
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Always required for the standalone main file
+#include "gambit/Elements/standalone_module.hpp"
+#include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
+#include "gambit/ColliderBit/MargPoissonLikelihoods.hpp"
+
+using namespace Gambit::ColliderBit;
+
+namespace
+{
+
+  /// Largest difference in ln L between native and backend likelihoods that the check accepts
+  const double tolerance = 1e-4;
+
+  /// One likelihood from the nulike backend, with the whole prediction uncertain
+  double lnlike_backend(int n, double lambda, double relerr, MargPoissonErrorType type)
+  {
+    if (type == LOGNORMAL_ERROR) return Backends::nulike_1_0_5::Functown::nulike_lnpiln(n, 0., lambda, relerr);
+    return Backends::nulike_1_0_5::Functown::nulike_lnpin(n, 0., lambda, relerr);
+  }
+
+  /// Compare native and backend likelihoods on a grid of n, lambda and relative error
+  /// @return Whether all differences are within the tolerance
+  bool check_grid(MargPoissonErrorType type)
+  {
+    const std::vector<int> ns = {0, 1, 2, 3, 5, 10, 20, 50, 100, 300, 1000};
+    const std::vector<double> lambdas = {0.01, 0.1, 0.5, 1, 2, 5, 10, 30, 100, 300, 1000, 3000};
+    const std::vector<double> relerrs = {1e-3, 0.01, 0.05, 0.1, 0.2, 0.3, 0.5, 0.7, 1, 2};
+    double maxDiff = 0;
+    int worstN = 0;
+    double worstLambda = 0, worstRelerr = 0;
+    for (int n : ns)
+      for (double lambda : lambdas)
+        for (double relerr : relerrs)
+        {
+          const double diff = std::abs(lnlike_marg_poisson(n, lambda, relerr, type) - lnlike_backend(n, lambda, relerr, type));
+          if (!(diff <= maxDiff))
+          {
+            maxDiff = diff;
+            worstN = n;
+            worstLambda = lambda;
+            worstRelerr = relerr;
+          }
+        }
+    const bool ok = (maxDiff <= tolerance);
+    std::cout << (ok ? "OK   " : "FAIL ") << std::left << std::setw(10) << (type == LOGNORMAL_ERROR ? "lognormal" : "Gaussian")
+              << std::right << "max |dlnL| = " << std::setprecision(3) << maxDiff << " over " << ns.size()*lambdas.size()*relerrs.size()
+              << " points, at n = " << worstN << ", lambda = " << worstLambda << ", relative error = " << worstRelerr << std::endl;
+    return ok;
+  }
+
+  /// Time both methods on nanalyses random analyses of nSRs signal regions each, and compare them
+  /// @return Whether all differences are within the tolerance
+  bool benchmark(MargPoissonErrorType type, int nanalyses, int nSRs)
+  {
+    typedef std::chrono::steady_clock clock;
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<double> lnUniform(std::log(0.1), std::log(2000.)), sysFrac(0.02, 0.6), sigFrac(0, 2);
+    std::vector<std::vector<SignalRegionData> > analyses(nanalyses);
+    for (auto& srs : analyses)
+      for (int i = 0; i < nSRs; ++i)
+      {
+        const double b = std::exp(lnUniform(gen)), s = b*sigFrac(gen);
+        std::poisson_distribution<int> nobs(b);
+        srs.push_back(SignalRegionData("bench", "SR", nobs(gen), s, b, s*sysFrac(gen), b*sysFrac(gen), s));
+      }
+
+    std::vector<SRLogLikes> batched;
+    double tBatched = 0, tBackend = 0, maxDiff = 0;
+    for (const auto& srs : analyses)
+    {
+      clock::time_point start = clock::now();
+      lnlike_marg_poisson(srs, type, batched);
+      tBatched += std::chrono::duration<double>(clock::now() - start).count();
+
+      start = clock::now();
+      std::vector<SRLogLikes> backend(srs.size());
+      for (size_t i = 0; i < srs.size(); ++i)
+      {
+        const SignalRegionData& sr = srs[i];
+        const int n_obs = (int) round(sr.n_observed), n_exp = (int) round(sr.n_background);
+        const double sb = sr.n_signal_at_lumi + sr.n_background;
+        const double relerr_b = sr.background_sys/sr.n_background;
+        const double relerr_sb = std::sqrt(sr.background_sys*sr.background_sys + sr.signal_sys*sr.signal_sys)/sb;
+        backend[i].b_exp = lnlike_backend(n_exp, sr.n_background, relerr_b, type);
+        backend[i].sb_exp = lnlike_backend(n_exp, sb, relerr_sb, type);
+        backend[i].b_obs = lnlike_backend(n_obs, sr.n_background, relerr_b, type);
+        backend[i].sb_obs = lnlike_backend(n_obs, sb, relerr_sb, type);
+      }
+      tBackend += std::chrono::duration<double>(clock::now() - start).count();
+
+      for (size_t i = 0; i < srs.size(); ++i)
+        for (auto member : {&SRLogLikes::b_exp, &SRLogLikes::sb_exp, &SRLogLikes::b_obs, &SRLogLikes::sb_obs})
+          maxDiff = std::max(maxDiff, std::abs(batched[i].*member - backend[i].*member));
+    }
+
+    const int nSRsTotal = nanalyses*nSRs;
+    std::cout << std::left << std::setw(12) << (type == LOGNORMAL_ERROR ? "lognormal" : "Gaussian") << std::right
+              << std::setw(12) << std::setprecision(3) << 1e6*tBackend/nSRsTotal << " us"
+              << std::setw(12) << 1e6*tBatched/nSRsTotal << " us"
+              << std::setw(10) << tBackend/tBatched << "x"
+              << std::setw(16) << maxDiff << std::endl;
+    return maxDiff <= tolerance;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  initialise_standalone_logs("runs/ColliderBit_marg_poisson_benchmark/logs/");
+  if (not Backends::backendInfo().works["nulike1.0.5"]) backend_error().raise(LOCAL_INFO, "nulike 1.0.5 is missing!");
+
+  int nanalyses = (argc > 1 ? std::atoi(argv[1]) : 200);
+  int nSRs = (argc > 2 ? std::atoi(argv[2]) : 30);
+
+  std::cout << "Native against nulike marginalised Poisson likelihoods, tolerance |dlnL| <= " << tolerance << ":" << std::endl;
+  bool ok = check_grid(LOGNORMAL_ERROR);
+  ok = check_grid(GAUSSIAN_ERROR) and ok;
+
+  std::cout << std::endl << "Marginalised Poisson likelihoods of " << nanalyses << " analyses with " << nSRs
+            << " signal regions each, time per signal region (four likelihoods):" << std::endl;
+  std::cout << std::left << std::setw(12) << "Error" << std::right << std::setw(15) << "nulike" << std::setw(15) << "batched"
+            << std::setw(11) << "speedup" << std::setw(16) << "max |dlnL|" << std::endl;
+
+  ok = benchmark(LOGNORMAL_ERROR, nanalyses, nSRs) and ok;
+  ok = benchmark(GAUSSIAN_ERROR, nanalyses, nSRs) and ok;
+
+  return ok ? 0 : 1;
+}
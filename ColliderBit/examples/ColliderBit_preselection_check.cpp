@@ -0,0 +1,244 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Check on fixed random events that the shared
+///  baseline selections of EventPreselection give
+///  the same results as the per-analysis loops
+///  they replaced:
+///   - every (object type, pT, |eta|) selection
+///     used by the analyses, asked for in varying
+///     order and more than once per event, against
+///     the plain loop over the event's objects;
+///   - the cached jet-electron distance table
+///     against the distances computed directly;
+///   - the signal region counts of all analyses
+///     sharing one cache against those of analyses
+///     each using a private cache, with the same
+///     random numbers for each analysis and event.
+///
+///  Usage: ColliderBit_preselection_check [nevents]
+///
+///  *********************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gambit/ColliderBit/Utils.hpp"
+#include "gambit/ColliderBit/analyses/HEPUtilsAnalysisContainer.hpp"
+
+using namespace Gambit::ColliderBit;
+
+namespace
+{
+
+  enum Kind { ELECTRON, MUON, TAU, PHOTON, JET, BJET };
+  const char* kindNames[] = {"electrons", "muons", "taus", "photons", "jets", "bjets"};
+
+  /// A baseline selection as made by the analyses before they used EventPreselection
+  struct Cut
+  {
+    Kind kind;
+    double ptmin, absetamax;
+  };
+
+  /// The selections of all analyses that use EventPreselection
+  const std::vector<Cut> cuts =
+  {
+    {ELECTRON, 10., 2.47}, {MUON, 10., 2.4}, {JET, 20., 4.5},   // ATLAS_0LEP, ATLAS_2LEPEW, Minimum
+    {JET, 20., 2.5},                                            // ATLAS_3LEPEW, ATLAS_2LEPStop
+    {TAU, 10., 2.47},                                           // ATLAS_0LEPStop, ATLAS_2LEPStop
+    {BJET, 20., 2.5},                                           // ATLAS_2LEPStop
+    {ELECTRON, 7., 2.47}, {MUON, 6., 2.4}, {JET, 20., 4.9},     // ATLAS_2bStop
+    {JET, 20., 2.8}, {MUON, 10., 2.7},                          // ATLAS_13TeV_0LEP
+    {ELECTRON, 30., 2.5}, {MUON, 30., 2.1},                     // CMS_1LEPDMTOP
+    {ELECTRON, 20., 2.5}, {MUON, 20., 2.4},                     // CMS_2LEPDMTOP
+    {ELECTRON, 10., 2.5}, {MUON, 10., 2.5}, {TAU, 20., 2.3}, {JET, 30., 4.5},  // CMS_MONOJET
+    {ELECTRON, 10., 2.4}, {TAU, 20., 2.4}, {JET, 30., 2.5}, {BJET, 30., 2.5},  // CMS_3LEPEW
+  };
+
+  /// Make an event with objects of every type, with pTs and |eta|s around the cut values.
+  /// Some pTs are exactly at a cut, to check that the cuts stay strict.  At most one jet
+  /// per event is, as jets of equal pT may swap places each time the event sorts its jets.
+  void make_check_event(std::mt19937_64& gen, HEPUtils::Event& event)
+  {
+    const std::vector<double> cutPts = {6., 7., 10., 20., 30.};
+    const std::vector<int> pids = {11, 13, 15, 22};
+    std::uniform_real_distribution<double> eta(-5., 5.), phi(0, 2*M_PI), flat(0, 1), pt(0., 60.);
+    std::uniform_int_distribution<int> nObjects(0, 6), cutPt(0, cutPts.size() - 1);
+    event.clear();
+    const int nJets = nObjects(gen);
+    bool jetAtCut = false;
+    for (int i = 0; i < nJets; i++)
+    {
+      const bool atCut = (not jetAtCut and flat(gen) < 0.2);
+      jetAtCut = jetAtCut or atCut;
+      const double jetPt = (atCut ? cutPts[cutPt(gen)] : pt(gen));
+      event.add_jet(new HEPUtils::Jet(HEPUtils::P4::mkEtaPhiMPt(eta(gen), phi(gen), 5., jetPt), flat(gen) < 0.4));
+    }
+    for (int pid : pids)
+    {
+      const int n = nObjects(gen);
+      for (int i = 0; i < n; i++)
+      {
+        const double particlePt = (flat(gen) < 0.2 ? cutPts[cutPt(gen)] : pt(gen));
+        HEPUtils::P4 p = HEPUtils::P4::mkEtaPhiMPt(eta(gen), phi(gen), 0., particlePt);
+        HEPUtils::Particle* particle = new HEPUtils::Particle(p, pid * (pid != 22 and flat(gen) < 0.5 ? -1 : 1));
+        particle->set_prompt();
+        event.add_particle(particle);
+      }
+    }
+    event.set_missingmom(HEPUtils::P4::mkXYZM(200*flat(gen), 200*flat(gen), 0, 0));
+  }
+
+  /// The objects of @a all passing the cuts, as the analyses used to select them
+  template <typename T>
+  std::vector<T*> loop_select(const std::vector<T*>& all, const Cut& cut)
+  {
+    std::vector<T*> rtn;
+    for (T* object : all)
+      if (object->pT() > cut.ptmin && fabs(object->eta()) < cut.absetamax) rtn.push_back(object);
+    return rtn;
+  }
+
+  /// Compare the cached selection for @a cut with the plain loop.
+  /// @return Whether they hold the same objects in the same order
+  bool check_cut(EventPreselection& preselection, const HEPUtils::Event& event, const Cut& cut)
+  {
+    switch (cut.kind)
+    {
+      case ELECTRON: return preselection.electrons(cut.ptmin, cut.absetamax) == loop_select(event.electrons(), cut);
+      case MUON: return preselection.muons(cut.ptmin, cut.absetamax) == loop_select(event.muons(), cut);
+      case TAU: return preselection.taus(cut.ptmin, cut.absetamax) == loop_select(event.taus(), cut);
+      case PHOTON: return preselection.photons(cut.ptmin, cut.absetamax) == loop_select(event.photons(), cut);
+      case JET: return preselection.jets(cut.ptmin, cut.absetamax) == loop_select(event.jets(), cut);
+      case BJET:
+      {
+        std::vector<HEPUtils::Jet*> bjets;
+        for (HEPUtils::Jet* jet : loop_select(event.jets(), cut)) if (jet->btag()) bjets.push_back(jet);
+        return preselection.bjets(cut.ptmin, cut.absetamax) == bjets;
+      }
+    }
+    return false;
+  }
+
+  /// Compare the cached jet-electron distances of ATLAS_0LEP with those computed directly.
+  bool check_deltaR(EventPreselection& preselection)
+  {
+    const std::vector<HEPUtils::Particle*>& electrons = preselection.electrons(10., 2.47);
+    const std::vector<HEPUtils::Jet*>& jets = preselection.jets(20., 4.5);
+    const std::vector<double>& dR = preselection.jet_deltaR_eta(jets, electrons);
+    if (dR.size() != jets.size()*electrons.size()) return false;
+    for (size_t i = 0; i < jets.size(); ++i)
+      for (size_t j = 0; j < electrons.size(); ++j)
+        if (dR[i*electrons.size() + j] != fabs(electrons[j]->mom().deltaR_eta(jets[i]->mom()))) return false;
+    return true;
+  }
+
+  /// Random number seed for one analysis and event, the same for both runs of the analyses
+  uint64_t seed(int iEvent, size_t iAnalysis)
+  {
+    return 1000003ULL * uint64_t(iEvent) + iAnalysis + 1;
+  }
+
+}
+
+int main(int argc, char* argv[])
+{
+  const int nevents = (argc > 1 ? std::atoi(argv[1]) : 10000);
+  int failed = 0;
+
+  // Selections against the plain loops
+  std::mt19937_64 gen(12345);
+  HEPUtils::Event event;
+  EventPreselection preselection;
+  std::vector<size_t> order(cuts.size());
+  for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+  int badSelections = 0, badDistances = 0;
+  for (int i = 0; i < nevents; i++)
+  {
+    make_check_event(gen, event);
+    preselection.reset(&event);
+    std::shuffle(order.begin(), order.end(), gen);
+    // Each selection twice: once made, once from the cache
+    for (int pass = 0; pass < 2; pass++)
+      for (size_t j : order)
+        if (not check_cut(preselection, event, cuts[j]) and badSelections++ < 5)
+          std::cout << "  event " << i << ": " << kindNames[cuts[j].kind] << " with pT > " << cuts[j].ptmin
+                    << " and |eta| < " << cuts[j].absetamax << " differ from the loop" << std::endl;
+    if (not check_deltaR(preselection)) badDistances++;
+  }
+  std::cout << (badSelections == 0 ? "OK   " : "FAIL ") << "selections: " << badSelections << " of "
+            << 2*nevents*cuts.size() << " differ from the loops" << std::endl;
+  std::cout << (badDistances == 0 ? "OK   " : "FAIL ") << "jet-electron distances: " << badDistances << " of "
+            << nevents << " events differ" << std::endl;
+  if (badSelections > 0) failed++;
+  if (badDistances > 0) failed++;
+
+  // Signal region counts of all analyses with a shared cache against private caches.
+  // Perf needs external output, and is left out.
+  std::vector<std::string> names = analysisNames();
+  names.erase(std::remove(names.begin(), names.end(), "Perf"), names.end());
+  std::sort(names.begin(), names.end());
+  std::vector<std::unique_ptr<HEPUtilsAnalysis> > shared, separate;
+  EventPreselection sharedPreselection;
+  for (const std::string& name : names)
+  {
+    shared.emplace_back(mkAnalysis(name));
+    shared.back()->set_preselection(&sharedPreselection);
+    separate.emplace_back(mkAnalysis(name));
+  }
+
+  // Some analyses print per event
+  std::stringstream silenced;
+  std::streambuf* coutbuf = std::cout.rdbuf(silenced.rdbuf());
+  std::streambuf* cerrbuf = std::cerr.rdbuf(silenced.rdbuf());
+  gen.seed(54321);
+  for (int i = 0; i < nevents; i++)
+  {
+    make_check_event(gen, event);
+    sharedPreselection.reset(&event);
+    for (size_t a = 0; a < names.size(); ++a)
+    {
+      set_random_seed(seed(i, a));
+      shared[a]->analyze(event);
+      set_random_seed(seed(i, a));
+      separate[a]->analyze(event);
+    }
+    silenced.str("");
+  }
+  std::vector<std::vector<SignalRegionData> > sharedResults, separateResults;
+  for (size_t a = 0; a < names.size(); ++a)
+  {
+    sharedResults.push_back(shared[a]->get_results());
+    separateResults.push_back(separate[a]->get_results());
+  }
+  std::cout.rdbuf(coutbuf);
+  std::cerr.rdbuf(cerrbuf);
+
+  for (size_t a = 0; a < names.size(); ++a)
+  {
+    int differences = 0;
+    double total = 0;
+    const std::vector<SignalRegionData>& s = sharedResults[a];
+    const std::vector<SignalRegionData>& p = separateResults[a];
+    if (s.size() != p.size()) differences = std::max(s.size(), p.size());
+    else for (size_t r = 0; r < s.size(); ++r)
+    {
+      total += s[r].n_signal;
+      if (s[r].n_signal != p[r].n_signal) differences++;
+    }
+    std::cout << (differences == 0 ? "OK   " : "FAIL ") << names[a] << ": " << differences << " of " << s.size()
+              << " signal regions differ (" << total << " events in all signal regions)" << std::endl;
+    if (differences > 0) failed++;
+  }
+
+  return failed > 0 ? 1 : 0;
+}
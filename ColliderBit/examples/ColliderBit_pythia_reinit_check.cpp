@@ -0,0 +1,148 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Check that keeping SpecializablePythia's
+///  base instances between parameter points gives
+///  the same events, bit for bit, as building
+///  every instance from scratch as before.
+///
+///  The points are given as SLHA files, and are
+///  run in turn through both colliders
+///  Pythia_SUSY_LHC_8TeV and Pythia_SUSY_LHC_13TeV,
+///  as in a scan with two colliders:
+///   - "kept": one SpecializablePythia for the
+///     whole run, keeping its base instances;
+///   - "fresh": a new SpecializablePythia for every
+///     point and collider, which reads the xml
+///     documentation and all settings again.
+///  The events and cross-sections of the two are
+///  compared.
+///
+///  Usage: ColliderBit_pythia_reinit_check <Pythia xmldoc path> <SLHA file> [<SLHA file> ...] [-n nevents]
+///
+///  *********************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// Always required for the standalone main file
+#include "gambit/Elements/standalone_module.hpp"
+#include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
+
+using namespace Gambit::ColliderBit;
+using namespace std;
+
+namespace
+{
+
+  /// Initialise @a pythia for one point and collider, as getPythia does.
+  void init(SpecializablePythia& pythia, const string& docPath, const string& collider,
+            const SLHAea::Coll& slha, int seed)
+  {
+    vector<string> options = {"SLHA:file = slhaea", "Next:numberCount = 0",
+                              "Random:seed = " + to_string(seed)};
+    stringstream initOutput;
+    pythia.resetSpecialization(collider);
+    pythia.init(docPath, options, &slha, initOutput);
+  }
+
+  /// Generate the next event, and report whether Pythia managed to.
+  bool next(const SpecializablePythia& pythia, Pythia8::Event& event)
+  {
+    try
+    {
+      pythia.nextEvent(event);
+    }
+    catch (SpecializablePythia::EventGenerationError&)
+    {
+      return false;
+    }
+    return true;
+  }
+
+  /// Number of particles that differ in ID, status or four-momentum between two events
+  int compare(const Pythia8::Event& a, const Pythia8::Event& b)
+  {
+    if (a.size() != b.size()) return max(a.size(), b.size());
+    int differences = 0;
+    for (int i = 0; i < a.size(); ++i)
+    {
+      const Pythia8::Particle& p = a[i];
+      const Pythia8::Particle& q = b[i];
+      if (p.id() != q.id() or p.status() != q.status() or p.px() != q.px() or p.py() != q.py() or
+          p.pz() != q.pz() or p.e() != q.e()) differences++;
+    }
+    return differences;
+  }
+
+}
+
+int main(int argc, char* argv[])
+{
+  initialise_standalone_logs("runs/ColliderBit_pythia_reinit_check/logs/");
+
+  vector<string> slhaFiles;
+  int nEvents = 100;
+  for (int i = 2; i < argc; i++)
+  {
+    if (string(argv[i]) == "-n" and i + 1 < argc) nEvents = atoi(argv[++i]);
+    else slhaFiles.push_back(argv[i]);
+  }
+  if (argc < 3 or slhaFiles.empty())
+  {
+    cerr << "Usage: " << argv[0] << " <Pythia xmldoc path> <SLHA file> [<SLHA file> ...] [-n nevents]" << endl;
+    return 1;
+  }
+  const string docPath = argv[1];
+  if (not Backends::backendInfo().works["Pythia8.212"]) backend_error().raise(LOCAL_INFO, "Pythia 8.212 is missing!");
+  const vector<string> colliders = {"Pythia_SUSY_LHC_8TeV", "Pythia_SUSY_LHC_13TeV"};
+
+  int failed = 0, seed = 12345;
+  SpecializablePythia kept;
+  Pythia8::Event keptEvent, freshEvent;
+  cout << setprecision(17);
+
+  for (const string& slhaFile : slhaFiles)
+  {
+    SLHAea::Coll slha;
+    ifstream in(slhaFile);
+    if (!in)
+    {
+      cerr << "Could not read " << slhaFile << endl;
+      return 1;
+    }
+    slha.read(in);
+
+    for (const string& collider : colliders)
+    {
+      SpecializablePythia fresh;
+      init(kept, docPath, collider, slha, seed);
+      init(fresh, docPath, collider, slha, seed);
+      seed++;
+
+      int differentEvents = 0, differentParticles = 0;
+      for (int i = 0; i < nEvents; i++)
+      {
+        const bool keptOK = next(kept, keptEvent), freshOK = next(fresh, freshEvent);
+        const int differences = (keptOK == freshOK ? compare(keptEvent, freshEvent) : 1);
+        if (differences > 0)
+        {
+          differentEvents++;
+          differentParticles += differences;
+        }
+      }
+      const bool sameXsec = (kept.xsec_pb() == fresh.xsec_pb() and kept.xsecErr_pb() == fresh.xsecErr_pb());
+
+      cout << (differentEvents == 0 and sameXsec ? "OK   " : "FAIL ") << slhaFile << ", " << collider << ": "
+           << differentEvents << " of " << nEvents << " events differ (" << differentParticles << " particles); "
+           << "xsec " << kept.xsec_pb() << " +- " << kept.xsecErr_pb() << " pb kept, "
+           << fresh.xsec_pb() << " +- " << fresh.xsecErr_pb() << " pb fresh" << endl;
+      if (differentEvents > 0 or not sameXsec) failed++;
+    }
+  }
+
+  return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,162 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///
+///  Microbenchmark of the analysis result
+///  collection path of the ColliderBit event loop:
+///  combining the analyses of the threads of each
+///  collider into the global analyses, then scaling
+///  them and collecting their signal regions at the
+///  end of the collider.  Memory allocations are
+///  counted for each stage.
+///
+///  Usage: ColliderBit_result_collection_benchmark [nevents per thread] [npoints]
+///
+///  *********************************************
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <vector>
+#include <omp.h>
+
+#include "gambit/ColliderBit/Utils.hpp"
+#include "gambit/ColliderBit/analyses/HEPUtilsAnalysisContainer.hpp"
+#include "ColliderBit_example_events.hpp"
+
+using namespace Gambit::ColliderBit;
+
+namespace
+{
+  std::atomic<long> nAllocations(0);
+}
+
+void* operator new(size_t size)
+{
+  ++nAllocations;
+  if (void* p = std::malloc(size)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+namespace
+{
+
+  /// Total signal over all signal regions of all analyses, without fixing their results
+  double total_signal(HEPUtilsAnalysisContainer& container)
+  {
+    double total = 0;
+    for (HEPUtilsAnalysis* analysis : container.analyses)
+      for (const SignalRegionData& sr : analysis->peek_results()) total += sr.n_signal;
+    return total;
+  }
+
+  /// Time, in seconds, and number of allocations of each stage
+  struct Stage
+  {
+    double time = 0;
+    long allocations = 0;
+  };
+
+  /// Run the result collection of one point with nColliders colliders.
+  /// @return The largest difference between the collected signal and the signal of the threads
+  double run_point(const std::vector<std::string>& names, int nColliders, int nThreads, int nevents,
+                   int seed, Stage& combine, Stage& collect)
+  {
+    typedef std::chrono::steady_clock clock;
+    std::vector<std::vector<SignalRegionData> > result;
+    double lost = 0;
+
+    for (int iCollider = 0; iCollider < nColliders; iCollider++)
+    {
+      // COLLIDER_INIT
+      HEPUtilsAnalysisContainer global;
+      global.init(names);
+      double expected = 0;
+
+      // The event loop of each thread
+      std::vector<HEPUtilsAnalysisContainer*> containers(nThreads);
+      for (int t = 0; t < nThreads; t++)
+      {
+        containers[t] = new HEPUtilsAnalysisContainer();
+        containers[t]->init(names);
+        std::mt19937_64 gen(seed + 100*iCollider + t);
+        set_random_seed(seed + 100*iCollider + t);
+        HEPUtils::Event event;
+        for (int i = 0; i < nevents; i++)
+        {
+          make_event(gen, event);
+          containers[t]->analyze(event);
+        }
+        containers[t]->add_xsec(1. + 0.01*t, 0.1);
+        expected += total_signal(*containers[t]);
+      }
+
+      // END_SUBPROCESS
+      long allocations = nAllocations;
+      clock::time_point start = clock::now();
+      reduce_analyses(containers);
+      global.improve_xsec(containers.front());
+      global.add(containers.front());
+      combine.time += std::chrono::duration<double>(clock::now() - start).count();
+      combine.allocations += nAllocations - allocations;
+      for (HEPUtilsAnalysisContainer* container : containers) delete container;
+
+      // COLLIDER_FINALIZE
+      allocations = nAllocations;
+      start = clock::now();
+      global.scale();
+      const size_t first = result.size();
+      for (HEPUtilsAnalysis* analysis : global.analyses) result.push_back(analysis->get_results());
+      collect.time += std::chrono::duration<double>(clock::now() - start).count();
+      collect.allocations += nAllocations - allocations;
+
+      double total = 0;
+      for (size_t i = first; i < result.size(); i++)
+        for (const SignalRegionData& sr : result[i]) total += sr.n_signal;
+      lost = std::max(lost, std::abs(total - expected));
+    }
+    return lost;
+  }
+
+}
+
+int main(int argc, char* argv[])
+{
+  int nevents = (argc > 1 ? std::atoi(argv[1]) : 200);
+  int npoints = (argc > 2 ? std::atoi(argv[2]) : 20);
+  const int nColliders = 2;
+
+  // All analyses that do not need external output
+  std::vector<std::string> names = analysisNames();
+  names.erase(std::remove(names.begin(), names.end(), "Perf"), names.end());
+  std::sort(names.begin(), names.end());
+
+  std::cout << "Collecting " << names.size() << " analyses from " << nColliders << " colliders per point, "
+            << nevents << " events per thread, " << npoints << " points:" << std::endl;
+  std::cout << std::setw(8) << "Threads" << std::setw(17) << "combine" << std::setw(14) << "allocs"
+            << std::setw(17) << "collect" << std::setw(14) << "allocs" << std::setw(16) << "signal lost" << std::endl;
+
+  const int maxThreads = omp_get_max_threads();
+  for (int nThreads = 1; ; nThreads = std::min(2*nThreads, maxThreads))
+  {
+    omp_set_num_threads(nThreads);
+    Stage combine, collect;
+    double lost = 0;
+    for (int i = 0; i < npoints; i++)
+      lost = std::max(lost, run_point(names, nColliders, nThreads, nevents, 1000 + 1000*i, combine, collect));
+    std::cout << std::setw(8) << nThreads << std::setw(14) << std::setprecision(3) << 1e3*combine.time/npoints << " ms"
+              << std::setw(14) << combine.allocations/npoints
+              << std::setw(14) << 1e3*collect.time/npoints << " ms" << std::setw(14) << collect.allocations/npoints
+              << std::setw(16) << lost << std::endl;
+    if (nThreads == maxThreads) break;
+  }
+
+  return 0;
+}
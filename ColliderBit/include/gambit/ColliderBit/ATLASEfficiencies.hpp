@@ -11,7 +11,7 @@
 #include "HEPUtils/BinnedFn.h"
 #include "HEPUtils/Event.h"
 
-#include <random>
+#include <cfloat>
 
 namespace Gambit {
   namespace ColliderBit {
@@ -104,9 +104,6 @@ namespace Gambit {
           // Function that mimics the DELPHES electron energy resolution
           // We need to smear E, then recalculate pT, then reset 4 vector
 
-          std::random_device rd;
-          std::mt19937 gen(rd());
-
           static HEPUtils::BinnedFn2D<double> coeffE2({{0, 2.5, 3., 5.}}, //< |eta|
                                                       {{0, 0.1, 25., DBL_MAX}}, //< pT
                                                       {{0.,          0.015*0.015, 0.005*0.005,
@@ -125,19 +122,24 @@ namespace Gambit {
                                                        0.25*0.25,0.25*0.25,0.25*0.25,
                                                        0.,       0.,       0.}});
 
+          // Draw the Gaussian deviates for the whole collection at once
+          static thread_local std::vector<double> gaus;
+          random_gaussians(gaus, electrons.size());
+
           // Now loop over the electrons and smear the 4-vectors
-          for (HEPUtils::Particle* e : electrons) {
+          for (size_t i = 0; i < electrons.size(); ++i) {
+            HEPUtils::Particle* e = electrons[i];
             if (e->abseta() > 5) continue;
 
-            // Look up / calculate resolution
-            const double c1 = coeffE2.get_at(e->abseta(), e->pT());
-            const double c2 = coeffE.get_at(e->abseta(), e->pT());
-            const double c3 = coeffC.get_at(e->abseta(), e->pT());
+            // Look up / calculate resolution; the three coefficient maps share a binning, so search it once
+            const size_t ibin = coeffE2.get_index(e->abseta(), e->pT());
+            const double c1 = coeffE2.get_at_index(ibin);
+            const double c2 = coeffE.get_at_index(ibin);
+            const double c3 = coeffC.get_at_index(ibin);
             const double resolution = sqrt(c1*HEPUtils::sqr(e->E()) + c2*e->E() + c3);
 
             // Smear by a Gaussian centered on the current energy, with width given by the resolution
-            std::normal_distribution<> d(e->E(), resolution);
-            double smeared_E = d(gen);
+            double smeared_E = e->E() + resolution*gaus[i];
             if (smeared_E < 0) smeared_E = 0;
             // double smeared_pt = smeared_E/cosh(e->eta()); ///< @todo Should be cosh(|eta|)?
             // std::cout << "BEFORE eta " << electron->eta() << std::endl;
@@ -152,24 +154,25 @@ namespace Gambit {
           // Function that mimics the DELPHES muon momentum resolution
           // We need to smear pT, then recalculate E, then reset 4 vector
 
-          std::random_device rd;
-          std::mt19937 gen(rd());
-
           static HEPUtils::BinnedFn2D<double> _muEff({{0,1.5,2.5}},
                                                      {{0,0.1,1.,10.,200.,DBL_MAX}},
                                                      {{0.,0.03,0.02,0.03,0.05,
                                                        0.,0.04,0.03,0.04,0.05}});
 
+          // Draw the Gaussian deviates for the whole collection at once
+          static thread_local std::vector<double> gaus;
+          random_gaussians(gaus, muons.size());
+
           // Now loop over the muons and smear the 4-vectors
-          for (HEPUtils::Particle* mu : muons) {
+          for (size_t i = 0; i < muons.size(); ++i) {
+            HEPUtils::Particle* mu = muons[i];
             if (mu->abseta() > 2.5) continue;
 
             // Look up resolution
             const double resolution = _muEff.get_at(mu->abseta(), mu->pT());
 
             // Smear by a Gaussian centered on the current energy, with width given by the resolution
-            std::normal_distribution<> d(mu->pT(), resolution*mu->pT());
-            double smeared_pt = d(gen);
+            double smeared_pt = mu->pT() * (1 + resolution*gaus[i]);
             if (smeared_pt < 0) smeared_pt = 0;
             // const double smeared_E = smeared_pt*cosh(mu->eta()); ///< @todo Should be cosh(|eta|)?
             // std::cout << "Muon pt " << mu_pt << " smeared " << smeared_pt << endl;
@@ -187,12 +190,12 @@ namespace Gambit {
           const double resolution = 0.03;
 
           // Now loop over the jets and smear the 4-vectors
-          std::random_device rd;
-          std::mt19937 gen(rd());
-          std::normal_distribution<> d(1., resolution);
-          for (HEPUtils::Jet* jet : jets) {
+          static thread_local std::vector<double> gaus;
+          random_gaussians(gaus, jets.size());
+          for (size_t i = 0; i < jets.size(); ++i) {
+            HEPUtils::Jet* jet = jets[i];
             // Smear by a Gaussian centered on 1 with width given by the (fractional) resolution
-            double smear_factor = d(gen);
+            const double smear_factor = 1 + resolution*gaus[i];
             /// @todo Is this the best way to smear? Should we preserve the mean jet energy, or pT, or direction?
             jet->set_mom(HEPUtils::P4::mkXYZM(jet->mom().px()*smear_factor, jet->mom().py()*smear_factor, jet->mom().pz()*smear_factor, jet->mass()));
           }
@@ -208,12 +211,12 @@ namespace Gambit {
           const double resolution = 0.03;
 
           // Now loop over the jets and smear the 4-vectors
-          std::random_device rd;
-          std::mt19937 gen(rd());
-          std::normal_distribution<> d(1., resolution);
-          for (HEPUtils::Particle* p : taus) {
+          static thread_local std::vector<double> gaus;
+          random_gaussians(gaus, taus.size());
+          for (size_t i = 0; i < taus.size(); ++i) {
+            HEPUtils::Particle* p = taus[i];
             // Smear by a Gaussian centered on 1 with width given by the (fractional) resolution
-            double smear_factor = d(gen);
+            const double smear_factor = 1 + resolution*gaus[i];
             /// @todo Is this the best way to smear? Should we preserve the mean jet energy, or pT, or direction?
             p->set_mom(HEPUtils::P4::mkXYZM(p->mom().px()*smear_factor, p->mom().py()*smear_factor, p->mom().pz()*smear_factor, p->mass()));
           }
@@ -11,7 +11,7 @@
 #include "HEPUtils/BinnedFn.h"
 #include "HEPUtils/Event.h"
 
-#include <random>
+#include <cfloat>
 #include <algorithm>
 
 namespace Gambit {
@@ -92,11 +92,13 @@ namespace Gambit {
       /// We need to smear E, then recalculate pT, then reset the 4-vector.
       inline void smearElectronEnergy(std::vector<HEPUtils::Particle*>& electrons) {
 
-        std::random_device rd;
-        std::mt19937 gen(rd());
+        // Draw the Gaussian deviates for the whole collection at once
+        static thread_local std::vector<double> gaus;
+        random_gaussians(gaus, electrons.size());
 
         // Now loop over the electrons and smear the 4-vectors
-        for (HEPUtils::Particle* e : electrons) {
+        for (size_t i = 0; i < electrons.size(); ++i) {
+          HEPUtils::Particle* e = electrons[i];
 
           // Calculate resolution
           // for pT > 0.1 GeV, E resolution = |eta| < 0.5 -> sqrt(0.06^2 + pt^2 * 1.3e-3^2)
@@ -116,8 +118,7 @@ namespace Gambit {
 
           // Smear by a Gaussian centered on the current energy, with width given by the resolution
           if (resolution > 0) {
-            std::normal_distribution<> d(e->E(), resolution);
-            double smeared_E = d(gen);
+            double smeared_E = e->E() + resolution*gaus[i];
             if (smeared_E < 0) smeared_E = 0;
             // double smeared_pt = smeared_E/cosh(e->eta()); ///< @todo Should be cosh(|eta|)?
             // std::cout << "BEFORE eta " << electron->eta() << std::std::endl;
@@ -134,11 +135,13 @@ namespace Gambit {
       /// We need to smear pT, then recalculate E, then reset the 4-vector.
       inline void smearMuonMomentum(std::vector<HEPUtils::Particle*>& muons) {
 
-        std::random_device rd;
-        std::mt19937 gen(rd());
+        // Draw the Gaussian deviates for the whole collection at once
+        static thread_local std::vector<double> gaus;
+        random_gaussians(gaus, muons.size());
 
         // Now loop over the muons and smear the 4-vectors
-        for (HEPUtils::Particle* p : muons) {
+        for (size_t i = 0; i < muons.size(); ++i) {
+          HEPUtils::Particle* p = muons[i];
 
           // Calculate resolution
           // for pT > 0.1 GeV, mom resolution = |eta| < 0.5 -> sqrt(0.01^2 + pt^2 * 2.0e-4^2)
@@ -157,8 +160,7 @@ namespace Gambit {
           }
 
           // Smear by a Gaussian centered on the current pT, with width given by the resolution
-          std::normal_distribution<> d(p->pT(), resolution*p->pT());
-          double smeared_pt = d(gen);
+          double smeared_pt = p->pT() * (1 + resolution*gaus[i]);
           if (smeared_pt < 0) smeared_pt = 0;
           // const double smeared_E = smeared_pt*cosh(mu->eta()); ///< @todo Should be cosh(|eta|)?
           // std::cout << "Muon pt " << mu_pt << " smeared " << smeared_pt << std::endl;
@@ -181,12 +183,12 @@ namespace Gambit {
         const double resolution = 0.03;
 
         // Now loop over the jets and smear the 4-vectors
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::normal_distribution<> d(1., resolution);
-        for (HEPUtils::Jet* jet : jets) {
+        static thread_local std::vector<double> gaus;
+        random_gaussians(gaus, jets.size());
+        for (size_t i = 0; i < jets.size(); ++i) {
+          HEPUtils::Jet* jet = jets[i];
           // Smear by a Gaussian centered on 1 with width given by the (fractional) resolution
-          double smear_factor = d(gen);
+          const double smear_factor = 1 + resolution*gaus[i];
           /// @todo Is this the best way to smear? Should we preserve the mean jet energy, or pT, or direction?
           jet->set_mom(HEPUtils::P4::mkXYZM(jet->mom().px()*smear_factor, jet->mom().py()*smear_factor, jet->mom().pz()*smear_factor, jet->mass()));
         }
@@ -203,12 +205,12 @@ namespace Gambit {
         const double resolution = 0.03;
 
         // Now loop over the jets and smear the 4-vectors
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::normal_distribution<> d(1., resolution);
-        for (HEPUtils::Particle* p : taus) {
+        static thread_local std::vector<double> gaus;
+        random_gaussians(gaus, taus.size());
+        for (size_t i = 0; i < taus.size(); ++i) {
+          HEPUtils::Particle* p = taus[i];
           // Smear by a Gaussian centered on 1 with width given by the (fractional) resolution
-          double smear_factor = d(gen);
+          const double smear_factor = 1 + resolution*gaus[i];
           /// @todo Is this the best way to smear? Should we preserve the mean jet energy, or pT, or direction?
           p->set_mom(HEPUtils::P4::mkXYZM(p->mom().px()*smear_factor, p->mom().py()*smear_factor, p->mom().pz()*smear_factor, p->mass()));
         }
@@ -24,9 +24,9 @@
   HEPUtilsAnalysis* create_Analysis_ ## ANAME() {                          \
     return new Analysis_ ## ANAME();                                       \
   }
-/// For the string based factory function mkAnalysis()
-#define IF_X_RTN_CREATE_ANA_X(A)                                           \
-  if (name == #A) return create_Analysis_ ## A()
+/// For the name-to-factory table of the string based factory function mkAnalysis()
+#define ANALYSIS_FACTORY_ENTRY(A)                                          \
+  { #A, &create_Analysis_ ## A }
 
 /// For the string based SpecializablePythia function resetSpecialization()
 #define IF_X_SPECIALIZEX(X)                                                \
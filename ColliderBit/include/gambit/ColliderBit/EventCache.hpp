@@ -0,0 +1,83 @@
+#pragma once
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  A compact binary cache of simulated events,
+///  so that the events of a point can be replayed
+///  through the analyses without generating them
+///  again.
+///
+///  *********************************************
+
+#include <string>
+#include <vector>
+
+#include "HEPUtils/Event.h"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    /// @brief The HEPUtils::Events of one collider and detector at one point, by event number
+    ///
+    /// Events are recorded into a slot per event number, so that threads can record their events
+    /// at the same time without locking, and are written to file in one go at the end.  A file is
+    /// read into memory in one go, after which any number of threads can replay events at once.
+    /// Momenta and weights are stored as doubles, so replayed events are identical to the recorded ones.
+    ///
+    /// The file holds, in native byte order: the string "GAMBITEV", the format version, the seed,
+    /// the cross-section, its error and Pythia's upper estimate of it in fb and the number of event
+    /// slots; then the encoded size of each event (0 for events that were not recorded); then the
+    /// encoded events.
+    class EventCache {
+      public:
+
+        /// Start recording up to @a nEvents events, generated with random number seed base @a seed,
+        /// dropping any events held.
+        void startRecording(int nEvents, int seed);
+
+        /// Record event number @a iEvent.
+        void record(int iEvent, const HEPUtils::Event& event);
+
+        /// Write the recorded events, seed and cross-section to @a filename.
+        /// @return false if the file could not be written.
+        bool write(const std::string& filename) const;
+
+        /// Read the events in @a filename, dropping any events held.
+        /// @return false if there is no such file, or it is not an event cache.
+        bool read(const std::string& filename);
+
+        /// Replay event number @a iEvent into @a event.
+        /// @return false if that event is not held.
+        bool replay(int iEvent, HEPUtils::Event& event) const;
+
+        /// Number of event slots, up to the last event held
+        int size() const;
+
+        /// Random number seed base of the events
+        int seed() const { return _seed; }
+
+        /// Cross-section the events were generated with, its error, and the upper estimate of it
+        /// that the cross-section veto is applied to, in fb
+        double xsec_fb() const { return _xsec_fb; }
+        double xsecErr_fb() const { return _xsecErr_fb; }
+        double xsecMaxEstimate_fb() const { return _xsecMaxEstimate_fb; }
+        void set_xsec(double xsec_fb, double xsecErr_fb, double xsecMaxEstimate_fb) {
+          _xsec_fb = xsec_fb; _xsecErr_fb = xsecErr_fb; _xsecMaxEstimate_fb = xsecMaxEstimate_fb;
+        }
+
+        /// Drop all events.
+        void clear();
+
+      private:
+
+        /// Encoded events by event number, empty if not held
+        std::vector<std::vector<char> > _events;
+        int _seed = 0;
+        double _xsec_fb = -1, _xsecErr_fb = -1, _xsecMaxEstimate_fb = -1;
+    };
+
+
+  }
+}
@@ -0,0 +1,81 @@
+#pragma once
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Memoised HiggsBounds/HiggsSignals likelihoods,
+///  so that points with the same Higgs sector (e.g.
+///  differing only in nuisance parameters or in
+///  coloured sparticles) do not run the backends
+///  again.
+///
+///  *********************************************
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "gambit/Backends/backend_types/HiggsBounds.hpp"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    /// @brief Log-likelihoods by HiggsBounds/HiggsSignals input
+    ///
+    /// Inputs match if every number in them agrees after rounding to a relative precision of
+    /// tolerance, or exactly if the tolerance is 0.  Beyond capacity entries, the least recently
+    /// used entry is dropped.
+    class HiggsLikelihoodCache {
+      public:
+
+        /// The rounded input
+        typedef std::vector<long long> Key;
+
+        HiggsLikelihoodCache(double tolerance=0, size_t capacity=1000)
+          : _tolerance(tolerance), _capacity(capacity), _lookups(0), _hits(0) {  }
+
+        /// Change the tolerance and capacity, dropping all entries if the tolerance changes.
+        void configure(double tolerance, size_t capacity);
+
+        /// Key of the input @a params
+        Key key(const hb_ModelParameters& params) const;
+
+        /// Look up the log-likelihood of the input with key @a k.
+        /// @return false if it is not held.
+        bool find(const Key& k, double& loglike);
+
+        /// Keep the log-likelihood of the input with key @a k.
+        void insert(const Key& k, double loglike);
+
+        /// Numbers of lookups and of lookups that found their input, and the fraction that did
+        size_t lookups() const { return _lookups; }
+        size_t hits() const { return _hits; }
+        double hitRate() const { return _lookups > 0 ? double(_hits)/_lookups : 0; }
+
+      private:
+
+        struct KeyHash { size_t operator()(const Key&) const; };
+        typedef std::list<Key> Order;
+        typedef std::unordered_map<Key, std::pair<double, Order::iterator>, KeyHash> Entries;
+
+        /// Append the rounded @a x to @a k
+        void addToKey(Key& k, double x) const;
+
+        /// Append the rounded elements of the array @a a to @a k
+        template <size_t N>
+        void addToKey(Key& k, const double (&a)[N]) const { for (double x : a) addToKey(k, x); }
+        template <size_t N, size_t M>
+        void addToKey(Key& k, const double (&a)[N][M]) const { for (const auto& row : a) addToKey(k, row); }
+
+        double _tolerance;
+        size_t _capacity;
+        /// Keys from the most to the least recently used
+        Order _order;
+        Entries _entries;
+        size_t _lookups, _hits;
+    };
+
+
+  }
+}
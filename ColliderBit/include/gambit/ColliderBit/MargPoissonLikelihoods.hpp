@@ -0,0 +1,57 @@
+#pragma once
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Poisson likelihoods of signal region counts,
+///  marginalised over the systematic error on the
+///  predicted number of events.
+///
+///  The predicted number of events lambda is
+///  scaled by a nuisance parameter xi, with either
+///    lognormal:  ln(xi) ~ N(0, sigma)
+///    Gaussian:   xi ~ N(1, sigma), xi > 0
+///  where sigma is the relative error on lambda,
+///  as in the nulike functions
+///  lnlike_marg_poisson_{lognormal,gaussian}_error:
+///    L(n) = int dxi P(xi) Poisson(n | xi*lambda)
+///  (the Gaussian is not renormalised for xi > 0).
+///
+///  *********************************************
+
+#include <vector>
+
+#include "gambit/ColliderBit/analyses/BaseAnalysis.hpp"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    /// Distributions of the nuisance parameter scaling the predicted number of events
+    enum MargPoissonErrorType { LOGNORMAL_ERROR, GAUSSIAN_ERROR };
+
+
+    /// Marginalised log-likelihoods of one signal region, for the background-only and
+    /// signal+background predictions, of the observed count and of the background count
+    /// expected from the background prediction.
+    struct SRLogLikes {
+      double b_exp = 0, sb_exp = 0, b_obs = 0, sb_obs = 0;
+    };
+
+
+    /// Log-likelihood of observing @a n events for a prediction @a lambda with relative error @a relerr.
+    double lnlike_marg_poisson(int n, double lambda, double relerr, MargPoissonErrorType type);
+
+
+    /// @brief All four log-likelihoods for each of the signal regions @a srs of an analysis
+    ///
+    /// The four integrals of a signal region are done on one shared grid of nodes, so that
+    /// the quadrature weights and the nuisance parameter's density are only evaluated once.
+    /// With @a includeSignalMCError, the Monte Carlo error of the signal is added in quadrature
+    /// to the systematic errors of the signal+background predictions.
+    void lnlike_marg_poisson(const std::vector<SignalRegionData>& srs, MargPoissonErrorType type,
+                             std::vector<SRLogLikes>& result, bool includeSignalMCError=false);
+
+
+  }
+}
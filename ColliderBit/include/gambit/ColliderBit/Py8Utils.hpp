@@ -60,10 +60,11 @@ namespace Gambit {
 
 
     /// @todo Rewrite using the Py8 > 176 particle-based methods
-    inline bool fromBottom(int n, const Pythia8::Event& evt) {
+    template <typename EventT>
+    inline bool fromBottom(int n, const EventT& evt) {
       // Root particle is invalid
       if (n == 0) return false;
-      const Pythia8::Particle& p = evt[n];
+      const auto& p = evt[n];
       if (abs(p.id()) == 5 || MCUtils::PID::hasBottom(p.id())) return true;
       /// @todo What about partonic decays?
       if (p.isParton()) return false; // stop the walking at hadron level
@@ -75,10 +76,11 @@ namespace Gambit {
 
 
     /// @todo Rewrite using the Py8 > 176 particle-based methods
-    inline bool fromTau(int n, const Pythia8::Event& evt) {
+    template <typename EventT>
+    inline bool fromTau(int n, const EventT& evt) {
       // Root particle is invalid
       if (n == 0) return false;
-      const Pythia8::Particle& p = evt[n];
+      const auto& p = evt[n];
       if (abs(p.id()) == 15) return true;
       if (p.isParton()) return false; // stop the walking at the end of the hadron level
       for (int m : p.motherList()) {
@@ -89,10 +91,11 @@ namespace Gambit {
 
 
     /// @todo Rewrite using the Py8 > 176 particle-based methods
-    inline bool fromHadron(int n, const Pythia8::Event& evt) {
+    template <typename EventT>
+    inline bool fromHadron(int n, const EventT& evt) {
       // Root particle is invalid
       if (n == 0) return false;
-      const Pythia8::Particle& p = evt[n];
+      const auto& p = evt[n];
       if (p.isHadron()) return true;
       if (p.isParton()) return false; // stop the walking at the end of the hadron level
       for (int m : p.motherList()) {
@@ -102,6 +105,72 @@ namespace Gambit {
     }
 
 
+    /// @brief The fromBottom, fromTau and fromHadron ancestry of every particle in an event record
+    ///
+    /// The recursive functions above walk the whole mother chain of each particle they are
+    /// asked about, so calling them for every particle of an event repeats the same walks
+    /// many times over.  classify() instead visits each particle once, combining the flags of
+    /// its mothers, and gives identical answers.  The memory is kept for the next event.
+    /// @note Like the recursive functions, classify() takes any record with Pythia8::Event's
+    /// interface, so that both can be checked on hand-made records.
+    class EventAncestry {
+      public:
+
+        /// Find the ancestry flags of all particles in @a evt
+        template <typename EventT>
+        void classify(const EventT& evt) {
+          const int n = evt.size();
+          _flags.assign(n, 0);
+          _state.assign(n, UNVISITED);
+          for (int i = 0; i < n; ++i) {
+            if (_state[i] == DONE) continue;
+            _stack.push_back(i);
+            while (!_stack.empty()) {
+              const int j = _stack.back();
+              // Root particle is invalid
+              if (j == 0) { _state[j] = DONE; _stack.pop_back(); continue; }
+              const auto& p = evt[j];
+              if (_state[j] == UNVISITED) {
+                // First visit: queue the mothers, unless the walk stops here at parton level
+                _state[j] = VISITING;
+                if (!p.isParton())
+                  for (int m : p.motherList()) if (_state[m] == UNVISITED) _stack.push_back(m);
+                continue;
+              }
+              _stack.pop_back();
+              if (_state[j] == DONE) continue;
+              // Second visit: the mothers are done, so combine their flags with this particle's own
+              unsigned char flags = 0;
+              if (abs(p.id()) == 5 || MCUtils::PID::hasBottom(p.id())) flags |= FROM_BOTTOM;
+              if (abs(p.id()) == 15) flags |= FROM_TAU;
+              if (p.isHadron()) flags |= FROM_HADRON;
+              if (!p.isParton())
+                for (int m : p.motherList()) flags |= _flags[m];
+              _flags[j] = flags;
+              _state[j] = DONE;
+            }
+          }
+        }
+
+        /// @name Ancestry of particle @a n of the last classified event
+        //@{
+        bool fromBottom(int n) const { return _flags[n] & FROM_BOTTOM; }
+        bool fromTau(int n) const { return _flags[n] & FROM_TAU; }
+        bool fromHadron(int n) const { return _flags[n] & FROM_HADRON; }
+        /// Not from a hadron decay, as the BuckFast converters define promptness
+        bool prompt(int n) const { return !fromHadron(n); }
+        //@}
+
+      private:
+
+        enum Flag { FROM_BOTTOM = 1, FROM_TAU = 2, FROM_HADRON = 4 };
+        enum State { UNVISITED, VISITING, DONE };
+        std::vector<unsigned char> _flags, _state;
+        std::vector<int> _stack;
+
+    };
+
+
     inline bool isReplica(int n, const Pythia8::Event& evt) {
       // Root particle is invalid
       if (n == 0) return false;
@@ -3,16 +3,94 @@
 #include "HEPUtils/BinnedFn.h"
 #include "HEPUtils/Event.h"
 
+#include <cstdint>
+#include <cmath>
+#include <vector>
+
 namespace Gambit {
   namespace ColliderBit {
 
 
+    /// @name Per-thread random numbers for detector simulation and efficiencies
+    //@{
+
+    /// @brief Small, fast pseudo-random generator (xoshiro256**)
+    ///
+    /// Cheap to seed and to copy, unlike std::mt19937, so that it can be reseeded for every event.
+    class FastRNG {
+      public:
+        FastRNG(uint64_t seed=1) { set_seed(seed); }
+
+        /// Reset the state from a single seed, via SplitMix64
+        void set_seed(uint64_t seed) {
+          for (int i = 0; i < 4; ++i) {
+            uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            _s[i] = z ^ (z >> 31);
+          }
+          _hasSpare = false;
+        }
+
+        /// Next 64 random bits
+        uint64_t next() {
+          const uint64_t rtn = _rotl(_s[1] * 5, 7) * 9;
+          const uint64_t t = _s[1] << 17;
+          _s[2] ^= _s[0]; _s[3] ^= _s[1]; _s[1] ^= _s[2]; _s[0] ^= _s[3];
+          _s[2] ^= t;
+          _s[3] = _rotl(_s[3], 45);
+          return rtn;
+        }
+
+        /// Uniform random number in [0,1)
+        double uniform() { return (next() >> 11) * (1.0/9007199254740992.0); }
+
+        /// Standard normal random number (Marsaglia polar method)
+        double gaussian() {
+          if (_hasSpare) { _hasSpare = false; return _spare; }
+          double u, v, s;
+          do {
+            u = 2*uniform() - 1;
+            v = 2*uniform() - 1;
+            s = u*u + v*v;
+          } while (s >= 1 || s == 0);
+          const double f = std::sqrt(-2*std::log(s)/s);
+          _spare = v*f; _hasSpare = true;
+          return u*f;
+        }
+
+      private:
+        static uint64_t _rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+        uint64_t _s[4];
+        bool _hasSpare;
+        double _spare;
+    };
+
+    /// This thread's generator, non-reproducibly seeded until set_random_seed is called on the thread
+    FastRNG& thread_rng();
+
+    /// Seed this thread's generator
+    inline void set_random_seed(uint64_t seed) { thread_rng().set_seed(seed); }
+
+    /// Uniform random number in [0,1) from this thread's generator
+    inline double random_uniform() { return thread_rng().uniform(); }
+
+    /// Fill @a x with @a n standard normal random numbers from this thread's generator
+    inline void random_gaussians(std::vector<double>& x, size_t n) {
+      FastRNG& rng = thread_rng();
+      x.resize(n);
+      for (size_t i = 0; i < n; ++i) x[i] = rng.gaussian();
+    }
+
+    //@}
+
+
     /// Return a random true/false at a success rate given by a number
     // inline
     bool random_bool(double eff);
     // {
     //   /// @todo Handle out-of-range eff values
-    //   return HEPUtils::rand01() < eff;
+    //   return random_uniform() < eff;
     // }
 
 
@@ -68,7 +146,9 @@ namespace Gambit {
 
     /// Check if there's a physics object above ptmin in an annulus rmin..rmax around the given four-momentum p4
     inline bool object_in_cone(const HEPUtils::Event& e, const HEPUtils::P4& p4, double ptmin, double rmax, double rmin=0.05) {
-      for (const HEPUtils::Particle* p : e.visible_particles())
+      static thread_local std::vector<HEPUtils::Particle*> visibles;
+      e.visible_particles(visibles);
+      for (const HEPUtils::Particle* p : visibles)
         if (p->pT() > ptmin && HEPUtils::in_range(HEPUtils::deltaR_eta(p4, *p), rmin, rmax)) return true;
       for (const HEPUtils::Jet* j : e.jets())
         if (j->pT() > ptmin && HEPUtils::in_range(HEPUtils::deltaR_eta(p4, *j), rmin, rmax)) return true;
@@ -7,6 +7,7 @@
 
 #include "gambit/ColliderBit/ColliderBit_macros.hpp"
 #include "gambit/ColliderBit/Utils.hpp"
+#include "gambit/ColliderBit/analyses/EventPreselection.hpp"
 
 #include "HEPUtils/MathUtils.h"
 #include "HEPUtils/Event.h"
@@ -28,6 +29,16 @@ namespace Gambit {
     static const double GeV = 1, MeV = 1e-3, TeV = 1e3;
 
 
+    /// The simulated events passing the selection of one signal region: the sum of their weights,
+    /// and the sum of their squared weights, which gives the Monte Carlo error of the former.
+    struct WeightedCount {
+      double sumw = 0, sumw2 = 0;
+      /// Count an event of weight @a w
+      void fill(double w) { sumw += w; sumw2 += w*w; }
+      WeightedCount& operator+=(const WeightedCount& other) { sumw += other.sumw; sumw2 += other.sumw2; return *this; }
+    };
+
+
     /// A simple container for the result of one signal region from one analysis.
     struct SignalRegionData {
 
@@ -39,6 +50,15 @@ namespace Gambit {
                            nsig.second, nbkg.second, nsigatlumi)
       {    }
 
+      /// Constructor with the weighted count of signal events, without signal systematic error
+      SignalRegionData(const std::string& name, const std::string& sr,
+                       double nobs, const WeightedCount& nsig, std::pair<double,double> nbkg,
+                       double nsigatlumi=-1)
+        : SignalRegionData(name, sr, nobs, nsig.sumw, nbkg.first, 0, nbkg.second, nsigatlumi)
+      {
+        n_signal_sq = nsig.sumw2;
+      }
+
       /// Constructor with separate n & nsys args
       SignalRegionData(const std::string& name, const std::string& sr,
                        double nobs, double nsig, double nbkg,
@@ -60,13 +80,19 @@ namespace Gambit {
       /// @name Signal region data
       //@{
       double n_observed = 0; ///< The number of events passing selection for this signal region as reported by the experiment
-      double n_signal = 0; ///< The number of simulated model events passing selection for this signal region
+      double n_signal = 0; ///< The number of simulated model events passing selection for this signal region, or the sum of their weights if weighted
+      double n_signal_sq = 0; ///< The sum of the squared weights of the events in n_signal (their number, if unweighted)
       double n_signal_at_lumi = -1; ///< n_signal, scaled to the experimental luminosity
       double n_background = 0; ///< The number of standard model events expected to pass the selection for this signal region, as reported by the experiment.
       double signal_sys = 0; ///< The absolute systematic error of n_signal
       double background_sys = 0; ///< The absolute systematic error of n_background
       //@}
 
+      /// The Monte Carlo statistical error of n_signal_at_lumi
+      double signal_mc_error_at_lumi() const {
+        return (n_signal > 0 and n_signal_at_lumi > 0) ? n_signal_at_lumi / n_signal * std::sqrt(n_signal_sq) : 0;
+      }
+
     };
 
 
@@ -74,18 +100,20 @@ namespace Gambit {
     template <typename EventT>
     class BaseAnalysis {
       private:
-        double _ntot, _xsec, _xsecerr, _luminosity;
+        double _ntot, _ntot2, _xsec, _xsecerr, _luminosity;
         std::vector<SignalRegionData> _results;
+        EventPreselection* _sharedPreselection;
+        EventPreselection _ownPreselection;
         typedef EventT EventType;
 
       public:
       /// @name Construction, Destruction, and Recycling:
       //@{
-        BaseAnalysis() : _ntot(0), _xsec(-1), _xsecerr(-1), _luminosity(-1) {  }
+        BaseAnalysis() : _ntot(0), _ntot2(0), _xsec(-1), _xsecerr(-1), _luminosity(-1), _sharedPreselection(nullptr) {  }
         virtual ~BaseAnalysis() { }
         /// Reset this instance for reuse, avoiding the need for "new" or "delete".
         virtual void clear() {
-          _ntot = 0; _xsec = -1; _xsecerr = -1; _luminosity = -1;
+          _ntot = 0; _ntot2 = 0; _xsec = -1; _xsecerr = -1; _luminosity = -1;
           _results.clear();
         }
       //@}
@@ -96,11 +124,23 @@ namespace Gambit {
         /// Analyze the event (accessed by reference).
         void analyze(const EventT& e) { analyze(&e); }
         /// Analyze the event (accessed by pointer).
-        /// @note Needs to be called from Derived::analyze().
-        virtual void analyze(const EventT*) { _ntot += 1; }
+        /// @note Needs to be called from Derived::analyze().  Derived classes fill their signal region
+        /// WeightedCounts with e->weight(), so that weighted events are counted right.
+        virtual void analyze(const EventT* e) {
+          const double w = e->weight();
+          _ntot += w;
+          _ntot2 += w*w;
+          if (_sharedPreselection == nullptr) _ownPreselection.reset(e);
+        }
+
+        /// Use a preselection cache shared with other analyses, reset by its owner for each event.
+        /// @note Pass nullptr to go back to a private cache.
+        void set_preselection(EventPreselection* p) { _sharedPreselection = p; }
 
-        /// Return the total number of events seen so far.
+        /// Return the total number of events seen so far, or the sum of their weights if weighted.
         double num_events() const { return _ntot; }
+        /// Return the sum of the squared weights of the events seen so far.
+        double num_events_sq() const { return _ntot2; }
         /// Return the cross-section (in pb).
         double xsec() const { return _xsec; }
         /// Return the cross-section error (in pb).
@@ -121,6 +161,16 @@ namespace Gambit {
           if (_results.empty()) collect_results();
           return _results;
         }
+
+        /// Get the SignalRegionData for the events seen so far, while still analyzing.
+        /// @note Unlike get_results, this does not fix the results, so more events can be added.
+        std::vector<SignalRegionData> peek_results() {
+          if (!_results.empty()) return _results;
+          collect_results();
+          std::vector<SignalRegionData> rtn;
+          rtn.swap(_results);
+          return rtn;
+        }
       //@}
 
       /// @name Protected collection functions:
@@ -130,6 +180,10 @@ namespace Gambit {
         void add_result(const SignalRegionData& res) { _results.push_back(res);}
         /// Gather together the info for likelihood calculation.
         virtual void collect_results() = 0;
+        /// The baseline object selections of the event being analyzed.
+        EventPreselection& preselection() {
+          return _sharedPreselection ? *_sharedPreselection : _ownPreselection;
+        }
       //@}
 
       /// @name (Re-)Initialization functions:
@@ -141,6 +195,7 @@ namespace Gambit {
         virtual void init() { }
         /// Scale by number of input events and xsec.
         virtual void scale(double factor=-1) {
+          if (_results.empty()) collect_results();
           if (factor < 0)
             factor = _luminosity * _xsec / _ntot;
           auto myIter = _results.begin();
@@ -155,16 +210,13 @@ namespace Gambit {
       //@{
       public:
         /// An operator to do xsec-weighted combination of analysis runs.
+        /// @note Derived classes add their own signal region counters, from which the results are
+        /// collected again when next asked for, so only the event count is added here and no
+        /// SignalRegionData are copied.
         virtual void add(BaseAnalysis* other) {
-          if (_results.empty()) collect_results();
-          std::vector<SignalRegionData> otherResults = other->get_results();
-          assert(otherResults.size() == _results.size());
-          auto myIter = _results.begin();
-          auto otherIter = otherResults.begin();
-          while (myIter != _results.end()) {
-            (*myIter++).n_signal += (*otherIter++).n_signal;
-          }
           _ntot += other->num_events();
+          _ntot2 += other->num_events_sq();
+          _results.clear();
         }
         /// Add cross-sections and errors for two different process types.
         void add_xsec(double xs, double xserr) {
@@ -188,6 +240,22 @@ namespace Gambit {
             }
           }
         }
+        /// Combine cross-sections and errors for the same process type, as the mean weighted by the
+        /// numbers of events they were estimated from: this analysis's, and @a otherEvents for @a xs.
+        /// @note Call before adding the other run's events, so that num_events is still this run's own.
+        void improve_xsec(double xs, double xserr, double otherEvents) {
+          const double nEvents = num_events(), total = nEvents + otherEvents;
+          if (total <= 0) {
+            improve_xsec(xs, xserr);
+          } else if (xs > 0) {
+            if (xsec() <= 0) {
+              set_xsec(xs, xserr);
+            } else {
+              _xsec = (nEvents*_xsec + otherEvents*xs) / total;
+              _xsecerr = HEPUtils::add_quad(nEvents*xsec_err(), otherEvents*xserr) / total;
+            }
+          }
+        }
       //@}
     };
 
@@ -0,0 +1,163 @@
+#pragma once
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  The EventPreselection class: a per-event cache
+///  of the baseline object selections shared by
+///  several analyses.
+
+#include "HEPUtils/Event.h"
+
+#include <deque>
+#include <vector>
+#include <cmath>
+#include <cassert>
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    /// @brief Per-event cache of baseline physics-object selections
+    ///
+    /// Analyses declare a selection by object type, minimum pT and maximum |eta|,
+    /// and get back the objects of the current event that pass it, in the event's
+    /// own order (jets sorted by descending pT).  Each selection is made once per
+    /// event, however many analyses ask for it, so that analyses sharing baseline
+    /// cuts no longer each loop over the whole event.  The cuts are the strict
+    /// inequalities pT > ptmin and |eta| < absetamax used throughout the analyses.
+    ///
+    /// Returned references stay valid until the next call to reset().
+    class EventPreselection {
+      private:
+
+        enum Kind { ELECTRON, MUON, TAU, PHOTON, JET, BJET };
+
+        /// A cached selection of one object type.
+        struct Selection {
+          Kind kind;
+          double ptmin, absetamax;
+          bool filled;
+          std::vector<HEPUtils::Particle*> particles;
+          std::vector<HEPUtils::Jet*> jets;
+        };
+
+        /// A cached table of jet-particle distances.
+        struct DeltaRTable {
+          const std::vector<HEPUtils::Jet*>* jets;
+          const std::vector<HEPUtils::Particle*>* particles;
+          bool filled;
+          std::vector<double> values;
+        };
+
+        const HEPUtils::Event* _event;
+        /// Deques, so that references to entries survive later insertions.
+        std::deque<Selection> _selections;
+        std::deque<DeltaRTable> _tables;
+
+        /// Find the entry for a selection, adding it the first time it is asked for.
+        Selection& _find(Kind kind, double ptmin, double absetamax) {
+          for (Selection& s : _selections)
+            if (s.kind == kind && s.ptmin == ptmin && s.absetamax == absetamax) return s;
+          _selections.push_back(Selection());
+          Selection& s = _selections.back();
+          s.kind = kind; s.ptmin = ptmin; s.absetamax = absetamax; s.filled = false;
+          return s;
+        }
+
+        const std::vector<HEPUtils::Particle*>& _particles(Kind kind, const std::vector<HEPUtils::Particle*>& all,
+                                                           double ptmin, double absetamax) {
+          Selection& s = _find(kind, ptmin, absetamax);
+          if (!s.filled) {
+            s.particles.clear();
+            for (HEPUtils::Particle* p : all)
+              if (p->pT() > ptmin && fabs(p->eta()) < absetamax) s.particles.push_back(p);
+            s.filled = true;
+          }
+          return s.particles;
+        }
+
+        const std::vector<HEPUtils::Jet*>& _jets(Kind kind, double ptmin, double absetamax) {
+          Selection& s = _find(kind, ptmin, absetamax);
+          if (!s.filled) {
+            s.jets.clear();
+            for (HEPUtils::Jet* j : _event->jets())
+              if (j->pT() > ptmin && fabs(j->eta()) < absetamax && (kind != BJET || j->btag())) s.jets.push_back(j);
+            s.filled = true;
+          }
+          return s.jets;
+        }
+
+      public:
+
+        EventPreselection() : _event(nullptr) { }
+
+        /// Start a new event, keeping the memory of the previous event's selections.
+        void reset(const HEPUtils::Event* event) {
+          _event = event;
+          for (Selection& s : _selections) s.filled = false;
+          for (DeltaRTable& t : _tables) t.filled = false;
+        }
+
+        /// The event currently being preselected.
+        const HEPUtils::Event* event() const { return _event; }
+
+        /// @name Baseline object selections for the current event:
+        //@{
+        const std::vector<HEPUtils::Particle*>& electrons(double ptmin, double absetamax) {
+          assert(_event);
+          return _particles(ELECTRON, _event->electrons(), ptmin, absetamax);
+        }
+        const std::vector<HEPUtils::Particle*>& muons(double ptmin, double absetamax) {
+          assert(_event);
+          return _particles(MUON, _event->muons(), ptmin, absetamax);
+        }
+        const std::vector<HEPUtils::Particle*>& taus(double ptmin, double absetamax) {
+          assert(_event);
+          return _particles(TAU, _event->taus(), ptmin, absetamax);
+        }
+        const std::vector<HEPUtils::Particle*>& photons(double ptmin, double absetamax) {
+          assert(_event);
+          return _particles(PHOTON, _event->photons(), ptmin, absetamax);
+        }
+        const std::vector<HEPUtils::Jet*>& jets(double ptmin, double absetamax) {
+          assert(_event);
+          return _jets(JET, ptmin, absetamax);
+        }
+        /// Jets carrying the detector-sim b-tag.
+        /// @note Analyses applying their own (random) tagging efficiencies must still do so themselves.
+        const std::vector<HEPUtils::Jet*>& bjets(double ptmin, double absetamax) {
+          assert(_event);
+          return _jets(BJET, ptmin, absetamax);
+        }
+        //@}
+
+        /// @brief |deltaR_eta| between every jet and every particle of two selections of this event
+        ///
+        /// The entry for jets[i] and particles[j] is at [i*particles.size() + j].
+        /// Both collections must be references returned by this object for the current event.
+        const std::vector<double>& jet_deltaR_eta(const std::vector<HEPUtils::Jet*>& jets,
+                                                  const std::vector<HEPUtils::Particle*>& particles) {
+          DeltaRTable* t = nullptr;
+          for (DeltaRTable& tt : _tables)
+            if (tt.jets == &jets && tt.particles == &particles) { t = &tt; break; }
+          if (t == nullptr) {
+            _tables.push_back(DeltaRTable());
+            t = &_tables.back();
+            t->jets = &jets; t->particles = &particles; t->filled = false;
+          }
+          if (!t->filled) {
+            t->values.resize(jets.size() * particles.size());
+            for (size_t i = 0; i < jets.size(); ++i)
+              for (size_t j = 0; j < particles.size(); ++j)
+                t->values[i*particles.size() + j] = fabs(particles[j]->mom().deltaR_eta(jets[i]->mom()));
+            t->filled = true;
+          }
+          return t->values;
+        }
+
+    };
+
+
+  }
+}
@@ -11,10 +11,15 @@ namespace Gambit {
     /// @note The caller is responsible for deleting the returned analysis object.
     HEPUtilsAnalysis* mkAnalysis(const std::string& name);
 
+    /// The names of all analyses known to mkAnalysis
+    std::vector<std::string> analysisNames();
+
     /// More sophisticated than just std::vector<HEPUtilsAnalysis*>
     struct HEPUtilsAnalysisContainer {
         std::vector<HEPUtilsAnalysis*> analyses;
         bool ready;
+        /// Baseline selections shared by all analyses, redone for each event.
+        mutable EventPreselection preselection;
 
       /// @name Construction, Destruction, and Recycling:
       //@{
@@ -42,9 +47,10 @@ namespace Gambit {
         void add_xsec(const HEPUtilsAnalysisContainer*);
         /// Combine cross-sections and errors for the same process type
         void improve_xsec(double, double);
-        /// Combine cross-sections and errors for the same process type
+        /// Combine cross-sections and errors for the same process type, weighted by numbers of events
         void improve_xsec(const HEPUtilsAnalysisContainer& e) { improve_xsec(&e); }
-        /// Combine cross-sections and errors for the same process type
+        /// Combine cross-sections and errors for the same process type, weighted by numbers of events.
+        /// @note Call before add, so that each analysis still holds only its own events.
         void improve_xsec(const HEPUtilsAnalysisContainer*);
         /// Add the results of all analyses from this instance to the given one.
         void add(const HEPUtilsAnalysisContainer& e) { add(&e); }
@@ -56,5 +62,12 @@ namespace Gambit {
       //@}
     };
 
+    /// Combine the results and cross-sections of a set of containers of the same analyses, such as
+    /// one per thread, into the first one.  Pairs of containers are combined in parallel, in log2(n)
+    /// rounds, with improve_xsec and add.  Each merged container carries the events of both, so the
+    /// cross-section is the mean over all n containers weighted by their numbers of events, for any n.
+    /// @note The other containers are left holding partial results.
+    void reduce_analyses(const std::vector<HEPUtilsAnalysisContainer*>& containers);
+
   }
 }
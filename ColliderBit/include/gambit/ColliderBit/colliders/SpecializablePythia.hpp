@@ -6,6 +6,9 @@
 ///  The SpecializablePythia class.
 
 #include <ostream>
+#include <map>
+#include <string>
+#include <vector>
 // #include "gambit/Elements/gambit_module_headers.hpp"
 // #include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
 #include "gambit/ColliderBit/colliders/BaseCollider.hpp"
@@ -17,17 +20,48 @@ namespace Gambit {
     /// A specializable, recyclable class interfacing ColliderBit and Pythia.
     class SpecializablePythia : public BaseCollider<Pythia8::Event>
     {
+      public:
+        /// Pythia's estimate at initialization of the maximum cross-section of one subprocess.
+        struct ProcessXsecEstimate
+        {
+          int code;
+          double xsecMax_pb;
+        };
+
       protected:
         Pythia8::Pythia* _pythiaInstance;
         Pythia8::Pythia* _pythiaBase;
         std::vector<std::string> _pythiaSettings;
         void (*_specialInit)(SpecializablePythia*);
+        /// Name of the current specialization
+        std::string _specName;
+        /// Base instances, one per specialization, kept between parameter points.
+        /// Each holds the settings that are the same at every point.  A new _pythiaInstance
+        /// is still made from the base and fully initialized at every point.
+        std::map<std::string, Pythia8::Pythia*> _pythiaBases;
+        /// The settings each base instance has been given so far.
+        std::map<std::string, std::vector<std::string> > _pythiaBaseSettings;
+        /// Make a new _pythiaInstance from the base instance of the current specialization and initialize it.
+        void _initInstance(const std::string& pythiaDocPath, const SLHAea::Coll* slhaea, std::ostream& os);
+        /// Subprocess cross-section estimates from the last initialization.
+        std::vector<ProcessXsecEstimate> _processXsecEstimates;
+        /// Read the subprocess cross-section estimates of the last initialization from _pythiaInstance.
+        void _readProcessXsecEstimates();
 
       /// @name Getters:
       //@{
       public:
         /// Get the Pythia instance.
         const Pythia8::Pythia* pythia() const { return _pythiaInstance; }
+        /// Get Pythia's estimates of the maximum cross-section of each subprocess, made at initialization.
+        const std::vector<ProcessXsecEstimate>& processXsecEstimates() const { return _processXsecEstimates; }
+        /// Get the sum over subprocesses of Pythia's maximum cross-section estimates (in pb).
+        double xsecMaxEstimate_pb() const
+        {
+          double total = 0.;
+          for (const auto& process : _processXsecEstimates) total += process.xsecMax_pb;
+          return total;
+        }
       //@}
 
       /// @name Custom exceptions:
@@ -54,7 +88,7 @@ namespace Gambit {
       /// @name Construction, Destruction, and Recycling:
       ///@{
       public:
-        SpecializablePythia() : _pythiaInstance(nullptr), _pythiaBase(nullptr) {}
+        SpecializablePythia() : _pythiaInstance(nullptr), _pythiaBase(nullptr), _specialInit(nullptr) {}
         ~SpecializablePythia();
         void clear();
       ///@}
@@ -122,6 +156,18 @@ namespace Gambit {
           }
         }
 
+        /// Event generation starting from a fresh random number sequence with the given seed,
+        /// so that the event does not depend on the events generated before it.
+        void nextEvent(EventType& event, int seed) const
+        {
+          _pythiaInstance->rndm.init(seed);
+          nextEvent(event);
+        }
+
+        /// Report the weight of the last event, which is 1 unless the phase space is biased
+        /// (e.g. with PhaseSpace:bias2Selection).
+        double event_weight() const { return _pythiaInstance->info.weight(); }
+
         /// Report the cross section (in pb) at the end of the subprocess.
         double xsec_pb() const { return _pythiaInstance->info.sigmaGen() * 1e9; }
         /// Report the cross section uncertainty (in pb) at the end of the subprocess.
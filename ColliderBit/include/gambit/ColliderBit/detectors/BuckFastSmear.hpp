@@ -1,6 +1,7 @@
 #pragma once
 
 #include "gambit/ColliderBit/detectors/BaseDetector.hpp"
+#include "gambit/ColliderBit/detectors/JetClusteringWorkspace.hpp"
 
 namespace Gambit {
   namespace ColliderBit {
@@ -11,19 +12,32 @@ namespace Gambit {
       //@{
         bool partonOnly; ///< Chooses between parton only and full event conversion.
         double antiktR; ///< The jet radius used for the anti-kt jet clustering.
+        bool recursiveAncestry; ///< Finds promptness with the per-particle recursive walks, as before EventAncestry (for checks).
         /// A converter for a Pythia8::Event which considers all final state particles.
         /// @note Also performs the jet clustering algorithm.
         void convertPythia8ParticleEvent(const EventInType&, EventOutType&) const;
         /// A converter for a Pythia8::Event which considers only partonic final states.
         /// @note Also performs the jet clustering algorithm.
         void convertPythia8PartonEvent(const EventInType&, EventOutType&) const;
+        /// Convert the next collider event by reference, before any smearing.
+        void convertEvent(const EventInType&, EventOutType&) const;
+        /// Apply the smearing and efficiencies of the detector to a converted event.
+        virtual void smearEvent(EventOutType&) const = 0;
         /// Perform the BuckFast simple smearing on the next collider event by reference.
-        virtual void processEvent(const EventInType&, EventOutType&) const = 0;
+        void processEvent(const EventInType& eventIn, EventOutType& eventOut) const {
+          convertEvent(eventIn, eventOut);
+          smearEvent(eventOut);
+        }
+        /// Jet clustering inputs and state, kept from event to event.
+        /// @note Each thread has its own detector simulation, and so its own workspace.
+        mutable JetClusteringWorkspace jetWorkspace;
+        /// Ancestry of the particles in the event being converted, kept from event to event.
+        mutable EventAncestry ancestry;
       //@}
 
       /// @name Construction, Destruction, and Recycling
       //@{
-        BuckFastBase() : partonOnly(false), antiktR(0.4) { }
+        BuckFastBase() : partonOnly(false), antiktR(0.4), recursiveAncestry(false) { }
         virtual ~BuckFastBase() { }
       //@}
 
@@ -42,7 +56,7 @@ namespace Gambit {
     struct BuckFastSmearATLAS : BuckFastBase {
       /// @name Event detection simulation.
       //@{
-        void processEvent(const EventInType&, EventOutType&) const;
+        void smearEvent(EventOutType&) const;
       //@}
 
       /// @name Construction, Destruction, and Recycling
@@ -56,7 +70,7 @@ namespace Gambit {
     struct BuckFastSmearCMS : BuckFastBase {
       /// @name Event detection simulation.
       //@{
-        void processEvent(const EventInType&, EventOutType&) const;
+        void smearEvent(EventOutType&) const;
       //@}
 
       /// @name Construction, Destruction, and Recycling
@@ -70,7 +84,7 @@ namespace Gambit {
     struct BuckFastIdentity : BuckFastBase {
       /// @name Event detection simulation.
       //@{
-        void processEvent(const EventInType&, EventOutType&) const;
+        void smearEvent(EventOutType&) const;
       //@}
 
       /// @name Construction, Destruction, and Recycling
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include "gambit/cmake/cmake_variables.hpp"
 #include "gambit/ColliderBit/detectors/BaseDetector.hpp"
 
@@ -14,12 +15,20 @@ namespace Gambit {
 
 
     /// A class for Delphes detector simulations within ColliderBit.
+    ///
+    /// Building the modular Delphes chain from a configuration card is expensive, so each card
+    /// is only read once, by the first init with it.  Later inits with a card that was read
+    /// before switch back to its chain, which is reused for the rest of the run, and seed ROOT's
+    /// random generator from the card again, as building the chain does.
     class DelphesVanilla : public BaseDetector<Pythia8::Event, HEPUtils::Event> 
     {
       protected:
 
         DelphesVanillaImpl* _impl; ///< Member variable abstraction via a forward-declared type.
 
+        /// The Delphes chain of each configuration card read so far
+        std::map<std::string, DelphesVanillaImpl*> _impls;
+
       public:
 
         /// @name Construction, destruction, and recycling
@@ -28,7 +37,7 @@ namespace Gambit {
 
         ~DelphesVanilla() { clear(); }
 
-        /// Reset this instance
+        /// Reset this instance, dropping the Delphes chains of all configuration cards
         void clear();
         //@}
 
@@ -36,6 +45,7 @@ namespace Gambit {
       //@{
       public:
         /// @brief Settings parsing and initialization for each sub-class.
+        /// The first setting is the Delphes configuration card.
         void init(const std::vector<std::string>&);
       //@}
 
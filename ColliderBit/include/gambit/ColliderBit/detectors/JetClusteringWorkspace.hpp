@@ -0,0 +1,73 @@
+#pragma once
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  The JetClusteringWorkspace class: anti-kt
+///  clustering state reused from event to event.
+
+#include <vector>
+
+#include "HEPUtils/FastJet.h"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    /// @brief Anti-kt jet clustering with inputs, outputs and cluster sequence reused between events
+    ///
+    /// Fill particles() with the clustering inputs of an event, then call cluster().  The
+    /// input and output vectors, the jet definition and the cluster sequence's own jet and
+    /// history tables keep their memory from one event to the next, instead of being
+    /// reallocated for every event.  A workspace must only be used by one thread at a time.
+    ///
+    /// The returned jets, and their constituents(), stay valid until the next call to cluster().
+    class JetClusteringWorkspace {
+      private:
+
+        /// A ClusterSequence that can be rerun on the particles of a new event.
+        class ReusableClusterSequence : public FJNS::ClusterSequence {
+          public:
+            void run(const std::vector<FJNS::PseudoJet>& particles, const FJNS::JetDefinition& jet_def) {
+              // Detach the jets of the last event from this sequence, as the destructor would
+              if (_structure_shared_ptr())
+                static_cast<FJNS::ClusterSequenceStructure*>(_structure_shared_ptr())->set_associated_cs(NULL);
+              _jets.clear();
+              _history.clear();
+              _transfer_input_jets(particles);
+              _initialise_and_run(jet_def, false);
+            }
+        };
+
+        double _R;
+        FJNS::JetDefinition _jetDef;
+        ReusableClusterSequence _cseq;
+        std::vector<FJNS::PseudoJet> _particles, _jets;
+
+      public:
+
+        JetClusteringWorkspace() : _R(-1) { }
+        /// Copies start with fresh workspaces, as there is no state worth copying.
+        JetClusteringWorkspace(const JetClusteringWorkspace&) : _R(-1) { }
+        JetClusteringWorkspace& operator = (const JetClusteringWorkspace&) { return *this; }
+
+        /// The clustering inputs, to be cleared and refilled for each event
+        std::vector<FJNS::PseudoJet>& particles() { return _particles; }
+
+        /// Cluster the current inputs with the anti-kt algorithm and radius @a R, returning
+        /// the jets above @a ptmin sorted by decreasing pT.
+        const std::vector<FJNS::PseudoJet>& cluster(double R, double ptmin) {
+          if (R != _R) {
+            _jetDef = FJNS::JetDefinition(FJNS::antikt_algorithm, R);
+            _R = R;
+          }
+          _cseq.run(_particles, _jetDef);
+          _jets = FJNS::sorted_by_pt(_cseq.inclusive_jets(ptmin));
+          return _jets;
+        }
+
+    };
+
+
+  }
+}
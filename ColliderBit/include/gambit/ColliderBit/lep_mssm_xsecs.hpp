@@ -1,3 +1,4 @@
+#pragma once
 //   GAMBIT: Global and Modular BSM Inference Tool
 //   *********************************************
 ///  \file
@@ -46,6 +47,9 @@
 
 #include <vector>
 
+#include "gambit/Utils/util_types.hpp"
+#include "gambit/Elements/spectrum.hpp"
+
 
 namespace Gambit
 {
@@ -54,41 +58,72 @@ namespace Gambit
   {
     
     typedef std::vector< std::vector<double> > MixMatrix;
-    
+
+    /// Pole mass of a sparticle and its relative 1 sigma upper and lower uncertainties
+    struct LEPSparticleMass
+    {
+      double m, uncert_high, uncert_low;
+    };
+
+    /// Spectrum inputs to the cross sections of all pairs at all LEP energies, so that they
+    /// are looked up in the spectrum once per point rather than once per pair and energy.
+    struct LEPSpectrumInputs
+    {
+      /// Z pole mass and width
+      double mZ, gammaZ;
+      /// sin^2(theta_W), alpha and tan(beta)
+      double sinW2, alpha, tanb;
+      /// Neutralinos 1-4, and charginos 1-2 (~chi+) and their antiparticles (~chi-)
+      LEPSparticleMass neutralino[4], chargino[2], antichargino[2];
+      /// Signed neutralino masses
+      double neutmass[4];
+      /// Charged slepton mass eigenstates ~e-_1 to ~e-_6, and sneutrino mass eigenstates ~nu_1 to ~nu_3
+      LEPSparticleMass slepton[6], sneutrino[3];
+      /// Neutralino and chargino mixing matrices, converted to BFM conventions
+      MixMatrix neutmix, charginomixV, charginomixU;
+
+      /// The charged slepton or sneutrino mass eigenstate called @a mass_es
+      const LEPSparticleMass& sfermion(const str& mass_es) const;
+    };
+
     /// High-level cross section routines.
     /// @{
+    /// Retrieve the spectrum inputs to the cross sections.
+    void get_LEP_spectrum_inputs(LEPSpectrumInputs& result, const Spectrum& spec, const double gammaZ);
     /// Retrieve the production cross-section at an e+e- collider for slepton pairs.
     ///  If l_are_gauge_es = T, then l(bar)_chirality = 1 => (anti-)left-type  slepton
     ///                                               = 2 => (anti-)right-type slepton
     ///  If l_are_gauge_es = F, then l(bar)_chirality = 1 => (anti-)slepton is lightest family state
     ///                                               = 2 => (anti-)slepton is heaviest family state
+    /// The spectrum is only used to identify the slepton mass eigenstates.
     void get_sigma_ee_ll(triplet<double>& result, const double sqrts, const int generation, const int l_chirality, 
                          const int lbar_chirality, const double gtol, const double ftol, const bool gpt_error,
-                         const bool fpt_error, const Spectrum& spec, const double gammaZ, const bool l_are_gauge_es);
+                         const bool fpt_error, const Spectrum& spec, const LEPSpectrumInputs& inputs,
+                         const bool l_are_gauge_es);
     /// Retrieve the production cross-section at an e+e- collider for neutralino pairs
     void get_sigma_ee_chi00(triplet<double>& result, const double sqrts, const int chi_first, const int chi_second,
-                            const double tol, const bool pt_error, const Spectrum& spec, const double gammaZ);
+                            const double tol, const bool pt_error, const Spectrum& spec, const LEPSpectrumInputs& inputs);
     /// Retrieve the production cross-section at an e+e- collider for chargino pairs
     void get_sigma_ee_chipm(triplet<double>& result, const double sqrts, const int chi_plus, const int chi_minus,
-                            const double tol, const bool pt_error, const Spectrum& spec, const double gammaZ);    
+                            const double tol, const bool pt_error, const Spectrum& spec, const LEPSpectrumInputs& inputs);
     /// @}
 
     /// Low-level cross section routines.
     /// @{
     /// Cross section [pb] for \f$ e^+e^- -> \tilde l_i \tilde l_j^* \f$
     /// To use, call SLHA2BFM first on SLHA mixing matrices constructed as a vector of vectors
-    double xsec_sleislej(int pid1, int pid2, double sqrts, double m1, double m2, MixMatrix F, 
-                         MixMatrix N, const double mN[4], double alpha, double mZ, double gZ,
+    double xsec_sleislej(int pid1, int pid2, double sqrts, double m1, double m2, const MixMatrix& F,
+                         const MixMatrix& N, const double mN[4], double alpha, double mZ, double gZ,
                          double sin2thetaW, bool warn_on_CP_violating_masses = true);
     /// Cross section [pb] for \f$ e^+e^- -> \tilde\chi^0_i \tilde\chi^0_j \f$
     /// Masses mi and mj for the neutralinos are signed. mS are the selectron masses (left = 0, right = 1).
     /// Warning! BFM uses inverted \f$\tan\beta\f$! Use tanb = 1 / tanb in converting from SLHA.
-    double xsec_neuineuj(int pid1, int pid2, double sqrts, double m1, double m2, MixMatrix N,
+    double xsec_neuineuj(int pid1, int pid2, double sqrts, double m1, double m2, const MixMatrix& N,
                          const double mS[2], double tanb, double alpha, double mZ, double gZ, double sin2thetaW);
     /// Cross section [pb] for \f$ e^+e^- -> \tilde\chi^+_i \tilde\chi^-_j \f$
     /// Masses mi and mj for the charginos are signed. msn is electron sneutrino mass.
-    double xsec_chaichaj(int pid1, int pid2, double sqrts, double m1, double m2, MixMatrix V, 
-                         MixMatrix U, double msn, double alpha, double mZ, double gZ, double sin2thetaW);
+    double xsec_chaichaj(int pid1, int pid2, double sqrts, double m1, double m2, const MixMatrix& V,
+                         const MixMatrix& U, double msn, double alpha, double mZ, double gZ, double sin2thetaW);
     /// @}
     
     /// Conversion between SLHA and BFM conventions. \f$\tan\beta\f$ is as per SLHA.
@@ -27,6 +27,7 @@
 #include <iostream>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -66,6 +67,11 @@ namespace Gambit
         // Some point external to all limit contours
         P2 _externalPoint;
 
+      private:
+        // Segment index of each limit contour, built from _limitContours on first use
+        mutable std::vector<LineSegmentGrid> _contourGrids;
+        mutable std::once_flag _contourGridsBuilt;
+
       //@}
 
       /// @name Construction and Destruction
@@ -77,6 +83,13 @@ namespace Gambit
 
         virtual ~BaseLimitContainer();
 
+      protected:
+
+        /// @brief Fill the limit values and contours from ColliderBit/data/LEP_limits/<name>.dat
+        /// @note Call from the constructor of the derived class, as the pixel coordinates
+        ///       in the file are converted with its convertPt.
+        void readContours(const std::string& name);
+
       //@}
       
       /// @name Point interpolation, conversion, and region checks
@@ -96,6 +109,10 @@ namespace Gambit
         /// @brief Two-pi averaging interpolator to find limits between limit curves
         double limitAverage(double x, double y, double mZ) const;
 
+        /// @brief limitAverage, testing every contour segment rather than using the segment index
+        /// @note Reference implementation, for validating and benchmarking the index.
+        double limitAverageFullScan(double x, double y, double mZ) const;
+
         /// @brief Dump limit average data into a file for average debugging
         void dumpPlotData(double xlow, double xhigh, double ylow, double yhigh,
                           double mZ, std::string filename, int ngrid=100) const;
@@ -104,6 +121,19 @@ namespace Gambit
         void dumpLightPlotData(std::string filename, int nperLine=20) const;
 
       //@}
+
+      /// @name Contour segment lookup
+      //@{
+
+      private:
+
+        /// @brief Interpolation shared by limitAverage and limitAverageFullScan
+        double _limitAverage(double x, double y, double mZ, bool useIndex) const;
+
+        /// @brief Indices of the segments of contour @a index that @a line might intersect
+        const std::vector<unsigned>& _segmentsNear(unsigned index, const LineSegment& line, bool useIndex) const;
+
+      //@}
     };
 
   }
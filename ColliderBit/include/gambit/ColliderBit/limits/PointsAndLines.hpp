@@ -3,6 +3,8 @@
 #include <sstream>
 #include <iostream>
 #include <limits>
+#include <vector>
+#include <algorithm>
 
 namespace Gambit {
   namespace ColliderBit {
@@ -228,6 +230,144 @@ namespace Gambit {
       //@}
     };
 
+    /// @brief A uniform grid over a collection of line segments.
+    ///
+    /// Finds the segments that a given line segment might intersect without testing all of them.
+    /// Each segment is listed in every cell overlapped by its bounding box, and a query visits
+    /// every cell that the query segment passes through.  Both are widened by a small tolerance,
+    /// so that the candidates always include every segment for which LineSegment::intersectsAt
+    /// finds an intersection, despite rounding.
+    class LineSegmentGrid {
+      /// @name Storage
+      //@{
+      private:
+        double _x0, _y0, _w, _h, _invw, _invh, _eps;
+        int _nx, _ny;
+        unsigned _nSegments;
+        /// Segments in cell (ix, iy) are _cellSegments[_cellStart[ix*_ny+iy] ... _cellStart[ix*_ny+iy+1]-1]
+        std::vector<unsigned> _cellStart, _cellSegments;
+      //@}
+
+      /// @name Cell lookup
+      //@{
+      private:
+        int cellX(double x) const { const double u = (x - _x0) * _invw; return u <= 0. ? 0 : u >= _nx ? _nx-1 : int(u); }
+        int cellY(double y) const { const double v = (y - _y0) * _invh; return v <= 0. ? 0 : v >= _ny ? _ny-1 : int(v); }
+      //@}
+
+      public:
+        LineSegmentGrid() : _x0(0.), _y0(0.), _w(1.), _h(1.), _invw(1.), _invh(1.), _eps(0.), _nx(0), _ny(0), _nSegments(0) { }
+
+        /// Index the given segments, which are referred to by their position in the vector.
+        void build(const std::vector<LineSegment>& segments) {
+          _nx = _ny = 0;
+          _nSegments = segments.size();
+          _cellStart.clear();
+          _cellSegments.clear();
+          if (segments.empty()) return;
+
+          double xmin = std::numeric_limits<double>::infinity(), ymin = xmin;
+          double xmax = -xmin, ymax = -xmin;
+          for (const LineSegment& seg : segments) {
+            xmin = std::min(xmin, seg.getp1().getx());
+            xmax = std::max(xmax, seg.getp2().getx());
+            ymin = std::min(ymin, std::min(seg.getp1().gety(), seg.getp2().gety()));
+            ymax = std::max(ymax, std::max(seg.getp1().gety(), seg.getp2().gety()));
+          }
+
+          // About two cells per side for every sqrt(n) segments keeps a few segments per occupied cell.
+          _nx = _ny = std::min(256, std::max(1, 2 * int(std::sqrt(double(segments.size())))));
+          _x0 = xmin;
+          _y0 = ymin;
+          _w = xmax > xmin ? (xmax - xmin) / _nx : 1.;
+          _h = ymax > ymin ? (ymax - ymin) / _ny : 1.;
+          _invw = 1. / _w;
+          _invh = 1. / _h;
+          _eps = 1e-6 * std::max(_w, _h);
+
+          // Count the segments in each cell, then fill them in
+          _cellStart.assign(_nx*_ny + 1, 0);
+          for (int pass = 0; pass < 2; ++pass) {
+            std::vector<unsigned> fill;
+            if (pass == 1) {
+              for (size_t i = 1; i < _cellStart.size(); ++i) _cellStart[i] += _cellStart[i-1];
+              _cellSegments.resize(_cellStart.back());
+              fill.assign(_cellStart.begin(), _cellStart.end() - 1);
+            }
+            for (unsigned iseg = 0; iseg < segments.size(); ++iseg) {
+              const LineSegment& seg = segments[iseg];
+              const double ylow = std::min(seg.getp1().gety(), seg.getp2().gety());
+              const double yhigh = std::max(seg.getp1().gety(), seg.getp2().gety());
+              for (int ix = cellX(seg.getp1().getx() - _eps); ix <= cellX(seg.getp2().getx() + _eps); ++ix)
+                for (int iy = cellY(ylow - _eps); iy <= cellY(yhigh + _eps); ++iy) {
+                  if (pass == 0) _cellStart[ix*_ny + iy + 1]++;
+                  else _cellSegments[fill[ix*_ny + iy]++] = iseg;
+                }
+            }
+          }
+        }
+
+        /// Get the indices of all segments that the given line segment might intersect, each listed once.
+        void candidates(const LineSegment& line, std::vector<unsigned>& result) const {
+          result.clear();
+          if (_nx == 0) return;
+
+          // Segments already listed are marked with the number of this query
+          static thread_local std::vector<unsigned> listed;
+          static thread_local unsigned query = 0;
+          if (listed.size() < _nSegments) listed.resize(_nSegments, 0);
+          if (++query == 0) {
+            std::fill(listed.begin(), listed.end(), 0);
+            query = 1;
+          }
+
+          // Clip the line to the (widened) grid, parameterising it as p1 + t*(p2 - p1)
+          const double ax = line.getp1().getx(), ay = line.getp1().gety();
+          const double dx = line.getp2().getx() - ax, dy = line.getp2().gety() - ay;
+          const double p[4] = {-dx, dx, -dy, dy};
+          const double q[4] = {ax - (_x0 - _eps), (_x0 + _nx*_w + _eps) - ax,
+                               ay - (_y0 - _eps), (_y0 + _ny*_h + _eps) - ay};
+          double t0 = 0., t1 = 1.;
+          for (int i = 0; i < 4; ++i) {
+            if (p[i] == 0.) {
+              if (q[i] < 0.) return;
+            } else if (p[i] < 0.) {
+              t0 = std::max(t0, q[i] / p[i]);
+            } else {
+              t1 = std::min(t1, q[i] / p[i]);
+            }
+          }
+          if (t0 > t1) return;
+          const double xa = ax + t0*dx, xb = ax + t1*dx;
+          const double ya = ay + t0*dy, yb = ay + t1*dy;
+
+          // Sweep the columns crossed by the line, visiting the rows it spans within each one
+          const double slope = (xb > xa ? (yb - ya) / (xb - xa) : 0.);
+          const int ixEnd = cellX(xb + _eps);
+          for (int ix = cellX(xa - _eps); ix <= ixEnd; ++ix) {
+            double ylow = std::min(ya, yb), yhigh = std::max(ya, yb);
+            if (xb > xa) {
+              double cx0 = std::max(xa, _x0 + ix*_w), cx1 = std::min(xb, _x0 + (ix+1)*_w);
+              if (cx0 > cx1) cx0 = cx1 = (xa > cx1 ? xa : xb);
+              const double y0 = ya + (cx0 - xa) * slope;
+              const double y1 = ya + (cx1 - xa) * slope;
+              ylow = std::min(y0, y1);
+              yhigh = std::max(y0, y1);
+            }
+            for (int iy = cellY(ylow - _eps); iy <= cellY(yhigh + _eps); ++iy) {
+              const unsigned cell = ix*_ny + iy;
+              for (unsigned i = _cellStart[cell]; i < _cellStart[cell+1]; ++i) {
+                const unsigned iseg = _cellSegments[i];
+                if (listed[iseg] != query) {
+                  listed[iseg] = query;
+                  result.push_back(iseg);
+                }
+              }
+            }
+          }
+        }
+    };
+
     /// @name String representation for LineSegment
     //@{
       /// Make a string representation of the LineSegment
@@ -24,6 +24,7 @@ class mt2
       void   set_momenta(double *pa0, double *pb0, double* pmiss0);
       void   set_mn(double mn);
       double get_mt2();
+      bool   is_above(double threshold);  // Same as get_mt2() > threshold, but stops bisecting once the bounds decide it
       void   print();
       int    nevt;
    private:  
@@ -31,6 +32,9 @@ class mt2
       bool   solved;
       bool   momenta_set;
       double mt2_b;
+      bool   use_threshold;   // set by is_above for mt2_bisect
+      bool   above;
+      double threshold;
 
       int    nsols(double Dsq);
       int    nsols_massless(double Dsq);
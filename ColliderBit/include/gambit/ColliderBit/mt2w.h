@@ -8,3 +8,13 @@ using namespace std;
 double calculateMT2wHepUtils(vector<HEPUtils::P4>& jets, vector<bool>& btag, HEPUtils::P4& lep, float met, float metphi);
 
 double mt2wWrapperHepUtils(HEPUtils::P4& lep, HEPUtils::P4& jet_o, HEPUtils::P4& jet_b, float met, float metphi);
+
+// The MT2W of each (b1, b2) jet pairing with the lepton, as mt2wWrapperHepUtils would give them one by one,
+// setting up the lepton and missing momentum once for all of them
+void mt2wBatchHepUtils(HEPUtils::P4& lep, vector<pair<const HEPUtils::P4*, const HEPUtils::P4*> >& pairings,
+                       float met, float metphi, vector<double>& results);
+
+// Whether calculateMT2wHepUtils(jets, btag, lep, met, metphi) > cut, for analyses that only cut on MT2W.
+// Each pairing is only bisected until it is known to be above or below the cut, and the first one below
+// it decides the minimum.
+bool mt2wAboveHepUtils(vector<HEPUtils::P4>& jets, vector<bool>& btag, HEPUtils::P4& lep, float met, float metphi, double cut);
@@ -46,6 +46,9 @@ class mt2w
       //    b2 is the other bottom (paired with the invisible W)
       //    pmiss is missing momentum with only x and y components.
       double get_mt2w();  // Calculates result, which is cached until set_momenta is called.
+      bool   is_above(double threshold, bool single_precision=false);
+      // Same as get_mt2w() > threshold, but stops bisecting as soon as the bounds decide it.
+      //    single_precision:  compare float(get_mt2w()) instead, as after storing the result in a float
       void   print();
       
    protected:
@@ -55,12 +58,17 @@ class mt2w
 
       bool   solved;
       bool   momenta_set;
+      bool   use_threshold;   // set by is_above for mt2w_bisect
+      bool   threshold_float;
+      bool   above;
+      double threshold;
 	  double upper_bound;
 	  double error_value;
 	  double scan_step;
       double mt2w_b;
 
       int    teco(double mtop);   // test the compatibility of a given trial top mass mtop
+      bool   threshold_decides(double lowest, double highest);  // for is_above, given bounds on mt2w
       inline int    signchange_n( long double t1, long double t2, long double t3, long double t4, long double t5);
       inline int    signchange_p( long double t1, long double t2, long double t3, long double t4, long double t5);
 
@@ -80,6 +88,10 @@ class mt2w
       double a1, b1, c1, a2, b2, c2, d1, e1, f1, d2, e2, f2;
 	  double d2o, e2o, f2o;
 
+      //parts of the coefficients that do not depend on mtop, set with the momenta
+      double ETb2sq, del1, Elb1, aa, bb, cc_den;
+      double pb1xa, pb1yb;
+
       double precision;
 };
 
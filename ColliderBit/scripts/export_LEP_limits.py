@@ -0,0 +1,155 @@
+#!/usr/bin/env python
+#
+#  GAMBIT: Global and Modular BSM Inference Tool
+#*********************************************
+#  \file
+#
+#  One-time export of the LEP limit contours that
+#  used to be hard-coded in the constructors of the
+#  ColliderBit limit containers (ColliderBit/src/limits)
+#  to the data files in ColliderBit/data/LEP_limits.
+#
+#  The digitised pixel coordinates are written out
+#  exactly as they appeared in the source, so the
+#  containers reproduce the original contours when
+#  they convert them with their own convertPt.
+#
+#  Usage: export_LEP_limits.py [source files]
+#
+#*********************************************
+#
+#  Authors (add name and date if you modify):
+#
+#  \author The GAMBIT Collaboration
+#  \date 2026 Oct
+#
+#*********************************************
+
+import os
+import re
+import sys
+
+gambit_dir = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+source_dir = os.path.join(gambit_dir, "ColliderBit", "src", "limits")
+header_dir = os.path.join(gambit_dir, "ColliderBit", "include", "gambit", "ColliderBit", "limits")
+data_dir = os.path.join(gambit_dir, "ColliderBit", "data", "LEP_limits")
+
+default_sources = ["ALEPHSleptonLimits.cpp", "L3GauginoLimits.cpp", "L3SleptonLimits.cpp",
+                   "L3SmallDeltaMGauginoLimits.cpp", "OPALGauginoLimits.cpp"]
+
+ctor_re = re.compile(r"^\s*(\w+)::(\w+)\(\)\s*\{?\s*$")
+value_re = re.compile(r"_limitValuesSorted\.push_back\(\s*([^)]+?)\s*\)")
+point_re = re.compile(r"corners\.push_back\(convertPt\(\s*([-+.\deE]+)\s*,\s*([-+.\deE]+)\s*\)\)")
+insert_re = re.compile(r"_limitContours\.insert\(LimitContourEntry\(\s*(\d+)\s*,")
+brief_re = re.compile(r"@brief\s+(.*)\s+\*?/?$")
+class_re = re.compile(r"class\s+(\w+)\s*:")
+
+known_statements = ["Corners corners;", "ContoursPointer contoursPointer;", "size_t oldSize;", "corners.clear();",
+                    "oldSize = contoursPointer->size();", "contoursPointer = new Contours();",
+                    "contoursPointer->resize(oldSize + corners.size() - 1);",
+                    "contoursPointer->resize(corners.size() - 1);",
+                    "std::transform(corners.begin(), --corners.end(), ++corners.begin(),",
+                    "contoursPointer->begin() + oldSize, makeLine);",
+                    "contoursPointer->begin(), makeLine);"]
+
+
+def fail(msg):
+  sys.exit("export_LEP_limits.py: " + msg)
+
+
+def descriptions():
+  """The @brief of each limit class, taken from the headers."""
+  result = {}
+  for name in sorted(os.listdir(header_dir)):
+    brief = None
+    for line in open(os.path.join(header_dir, name)):
+      m = brief_re.search(line)
+      if m: brief = m.group(1).strip().replace("A class to contain the ", "")
+      m = class_re.search(line)
+      if m and brief is not None:
+        result[m.group(1)] = brief
+        brief = None
+  return result
+
+
+def parse(filename):
+  """Replay the contour-building statements of each constructor in a source file."""
+  limits = {}
+  current = None
+  for lineno, line in enumerate(open(filename), 1):
+    stripped = line.strip()
+    m = ctor_re.match(line)
+    if m and m.group(1) == m.group(2):
+      current = {"values": [], "contours": {}, "polylines": None, "corners": None}
+      limits[m.group(1)] = current
+      continue
+    if current is None or stripped in ("", "{") or stripped.startswith("//") or stripped.startswith("/*"):
+      continue
+    if stripped == "}":
+      current = None
+      continue
+    where = "%s:%d: " % (os.path.basename(filename), lineno)
+    m = value_re.search(stripped)
+    if m:
+      current["values"].append(m.group(1))
+      continue
+    m = point_re.search(stripped)
+    if m:
+      current["corners"].append((m.group(1), m.group(2)))
+      continue
+    m = insert_re.search(stripped)
+    if m:
+      current["contours"][int(m.group(1))] = current["polylines"]
+      continue
+    if stripped == "contoursPointer = new Contours();":
+      current["polylines"] = []
+    elif stripped == "corners.clear();":
+      current["corners"] = []
+    elif stripped == "Corners corners;":
+      current["corners"] = []
+    elif stripped == "contoursPointer->resize(corners.size() - 1);":
+      # Overwrites the contour from its start, so only valid for the first polyline
+      if current["polylines"]:
+        fail(where + "polyline overwrites a non-empty contour")
+    elif stripped in ("contoursPointer->begin() + oldSize, makeLine);", "contoursPointer->begin(), makeLine);"):
+      # Polylines without corners (undefined behaviour in the original code) are dropped
+      if len(current["corners"]) > 1:
+        current["polylines"].append(list(current["corners"]))
+      else:
+        print(where + "skipping polyline with fewer than two corners")
+    elif stripped not in known_statements:
+      fail(where + "unrecognised statement in constructor: " + stripped)
+  return limits
+
+
+def write(name, limit, brief):
+  values = limit["values"]
+  if sorted(limit["contours"].keys()) != list(range(len(values))):
+    fail(name + ": contours do not match the limit values")
+  with open(os.path.join(data_dir, name + ".dat"), "w") as f:
+    f.write("# " + name + ": " + brief + "\n")
+    f.write("# Exported from the original hard-coded contours by ColliderBit/scripts/export_LEP_limits.py.\n")
+    f.write("#\n")
+    f.write("# 'limit <value/pb>' starts the contour of the next limit value, in increasing order.\n")
+    f.write("# 'line' starts a polyline of that contour; its corners follow as digitised\n")
+    f.write("# 'x y' pixel coordinates, converted to masses by the class's convertPt.\n")
+    for i, value in enumerate(values):
+      f.write("limit " + value + "\n")
+      for polyline in limit["contours"][i]:
+        f.write("line\n")
+        for x, y in polyline:
+          f.write(x + " " + y + "\n")
+
+
+def main(sources):
+  briefs = descriptions()
+  if not os.path.isdir(data_dir): os.makedirs(data_dir)
+  for source in sources:
+    path = source if os.path.isfile(source) else os.path.join(source_dir, source)
+    for name, limit in sorted(parse(path).items()):
+      write(name, limit, briefs.get(name, "").rstrip("."))
+      print("Wrote " + os.path.join(data_dir, name + ".dat"))
+
+
+if __name__ == "__main__":
+  main(sys.argv[1:] if len(sys.argv) > 1 else default_sources)
@@ -31,6 +31,7 @@
 ///  *********************************************
 
 #include <cmath>
+#include <algorithm>
 #include <string>
 #include <iostream>
 #include <fstream>
@@ -43,6 +44,8 @@
 #include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
 #include "gambit/Elements/mssm_slhahelp.hpp"
 #include "gambit/ColliderBit/lep_mssm_xsecs.hpp"
+#include "gambit/ColliderBit/MargPoissonLikelihoods.hpp"
+#include "gambit/ColliderBit/EventCache.hpp"
 #include "HEPUtils/FastJet.h"
 
 //#define COLLIDERBIT_DEBUG
@@ -130,7 +133,8 @@ namespace Gambit
                              START_SUBPROCESS = -3,
                              END_SUBPROCESS = -4,
                              COLLIDER_FINALIZE = -5,
-                             BASE_FINALIZE = -6};
+                             BASE_FINALIZE = -6,
+                             CHECK_CONVERGENCE = -7};
 
     /// Pythia stuff
     std::vector<str> pythiaNames;
@@ -138,9 +142,36 @@ namespace Gambit
     unsigned int indexPythiaNames;
     bool eventsGenerated;
     bool tooManyFailedEvents;
+    /// Events of the current collider dropped after throwing std::domain_error.  These are not
+    /// analysed, so they do not enter the event counts by which the analyses are normalised.
+    int nDroppedEvents;
     std::vector<int> nEvents;
     int seedBase;
 
+    /// Pythia random number seed for a single event.  This depends only on the seedBase for the
+    /// current point and collider and on the event number, so that a given event is the same
+    /// whichever thread generates it.
+    int eventSeed(int iEvent)
+    {
+      unsigned long long h = (unsigned long long)seedBase;
+      h = h * 0x9E3779B97F4A7C15ULL + indexPythiaNames;
+      h = h * 0x9E3779B97F4A7C15ULL + (unsigned long long)iEvent;
+      // SplitMix64 finalizer
+      h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+      h ^= h >> 31;
+      // Pythia accepts seeds from 1 to 900000000
+      return int(1 + h % 899999999ULL);
+    }
+
+    /// Seed this thread's smearing and efficiency random numbers for a single event.  Each module
+    /// function drawing them reseeds with its own tag, so that its random numbers do not depend on
+    /// which other module functions ran before it on this thread.
+    void seedEventRandoms(int iEvent, int tag)
+    {
+      set_random_seed((unsigned long long)eventSeed(iEvent) * 16 + tag);
+    }
+
     /// Analysis stuff
     bool useBuckFastATLASDetector;
     HEPUtilsAnalysisContainer globalAnalysesATLAS;
@@ -163,6 +194,239 @@ namespace Gambit
     bool haveUsedDelphesDetector;
 #endif
 
+    /// The analysis container of each thread for the current collider, by detector.  Only resized outside
+    /// of the parallel regions.
+    std::map<str, std::vector<HEPUtilsAnalysisContainer*> > threadAnalyses;
+
+    /// The global analysis container of a detector
+    HEPUtilsAnalysisContainer& globalAnalyses(const str& detector)
+    {
+#ifndef EXCLUDE_DELPHES
+      if (detector == "Det") return globalAnalysesDet;
+#endif
+      if (detector == "ATLAS") return globalAnalysesATLAS;
+      if (detector == "CMS") return globalAnalysesCMS;
+      return globalAnalysesIdentity;
+    }
+
+    /// Adaptive event loop: the signal region counts of one analysis, summed over threads at a convergence check
+    struct AnalysisTally
+    {
+      double nEvents = 0, nEventsSq = 0, xsecTimesEvents_fb = 0, luminosity = 0;
+      std::vector<SignalRegionData> signalRegions;
+    };
+    std::map<str, AnalysisTally> convergenceTallies;
+
+    /// Add the counts of this thread's analyses to the convergence tallies.
+    void tallyForConvergence(const str& detector, const HEPUtilsAnalysisContainer& container, double xsec_fb)
+    {
+      #pragma omp critical (access_convergenceTallies)
+      {
+        for (HEPUtilsAnalysis* analysis : container.analyses)
+        {
+          std::vector<SignalRegionData> srs = analysis->peek_results();
+          if (srs.empty()) continue;
+          AnalysisTally& tally = convergenceTallies[detector + ":" + srs.front().analysis_name];
+          if (tally.signalRegions.empty()) tally.signalRegions = srs;
+          else for (size_t i = 0; i < srs.size(); ++i)
+          {
+            tally.signalRegions[i].n_signal += srs[i].n_signal;
+            tally.signalRegions[i].n_signal_sq += srs[i].n_signal_sq;
+          }
+          tally.nEvents += analysis->num_events();
+          tally.nEventsSq += analysis->num_events_sq();
+          tally.xsecTimesEvents_fb += xsec_fb * analysis->num_events();
+          tally.luminosity = analysis->luminosity();
+        }
+      }
+    }
+
+    /// Check whether the Monte Carlo uncertainty on the predicted signal in every signal region
+    /// is below tolerance times the uncertainty on its background, so that more events would
+    /// not change the likelihood appreciably.
+    bool yieldsConverged(double tolerance)
+    {
+      for (auto it = convergenceTallies.begin(); it != convergenceTallies.end(); ++it)
+      {
+        const AnalysisTally& tally = it->second;
+        if (tally.nEvents <= 0 or tally.xsecTimesEvents_fb <= 0) return false;
+        // Predicted signal events at the analysis luminosity per generated event (of unit weight)
+        const double weight = tally.xsecTimesEvents_fb / tally.nEvents * tally.luminosity / tally.nEvents;
+        // Mean weight of the events, weighted by their weights: 1 unless the phase space is biased
+        const double meanWeight = tally.nEventsSq / tally.nEvents;
+        for (const SignalRegionData& srData : tally.signalRegions)
+        {
+          // The Monte Carlo error of the sum of weights in the signal region is the square root of the
+          // sum of their squares.  Signal regions without any events so far count as having one of the
+          // mean weight.
+          const double mc_error = weight * sqrt(std::max(srData.n_signal_sq, meanWeight));
+          const double background_error = sqrt(srData.n_background + srData.background_sys*srData.background_sys);
+          if (mc_error > tolerance * background_error) return false;
+        }
+      }
+      return true;
+    }
+
+    /// Event cache: the simulated events of each detector for the current collider are recorded to file,
+    /// or replayed from file instead of being generated again (see the eventCache options of operateLHCLoop)
+    enum eventCacheModes {NO_EVENT_CACHE, RECORD_EVENTS, REPLAY_EVENTS};
+    eventCacheModes eventCacheMode;
+    bool cacheUnsmearedEvents;
+    str eventCacheDir;
+    /// Hash of the SLHA input for the current point, set by the HardScatteringSim functions
+    unsigned long long spectrumHash;
+    /// Hash of the Pythia settings common to all threads for the current collider, set by the HardScatteringSim functions
+    unsigned long long pythiaOptionsHash;
+    /// Pythia's upper estimate of the cross-section of the current collider in fb, as the xsec veto uses it
+    double xsecMaxEstimate_fb;
+    /// Whether the events of the current collider are replayed from the caches
+    bool replayingEvents;
+    /// Caches by detector name.  Only filled outside of the parallel regions.
+    std::map<str, EventCache> eventCaches;
+
+    /// 64-bit FNV-1a hash of a string
+    unsigned long long hashString(const str& s)
+    {
+      unsigned long long h = 0xCBF29CE484222325ULL;
+      for (unsigned char c : s) h = (h ^ c) * 0x100000001B3ULL;
+      return h;
+    }
+
+    /// 64-bit FNV-1a hash of a list of strings, each ended by a newline
+    unsigned long long hashStrings(const std::vector<str>& strings)
+    {
+      str joined;
+      for (const str& s : strings) joined += s + "\n";
+      return hashString(joined);
+    }
+
+    /// Names of the detectors simulated for the current collider
+    std::vector<str> detectorsInUse()
+    {
+      std::vector<str> detectors;
+      if (useBuckFastATLASDetector) detectors.push_back("ATLAS");
+      if (useBuckFastCMSDetector) detectors.push_back("CMS");
+      if (useBuckFastIdentityDetector) detectors.push_back("Identity");
+#ifndef EXCLUDE_DELPHES
+      if (useDelphesDetector) detectors.push_back("Det");
+#endif
+      return detectors;
+    }
+
+    /// Cache file for the events of a detector, for the current point, collider and Pythia settings.
+    /// Delphes events are always cached after detector simulation.
+    str eventCacheFile(const str& detector)
+    {
+      std::stringstream ss;
+      ss << eventCacheDir << *iterPythiaNames << "_" << detector << "_" << std::hex << spectrumHash << "_"
+         << pythiaOptionsHash << std::dec;
+      if (cacheUnsmearedEvents and detector != "Det") ss << "_unsmeared";
+      ss << ".events";
+      return ss.str();
+    }
+
+    /// Cross-section of the current collider in fb, and its error, as used for the analyses of a detector
+    double colliderXsec_fb(const str& detector, const SpecializablePythia& pythia)
+    {
+      return (replayingEvents ? eventCaches.at(detector).xsec_fb() : pythia.xsec_pb() * 1000.);
+    }
+    double colliderXsecErr_fb(const str& detector, const SpecializablePythia& pythia)
+    {
+      return (replayingEvents ? eventCaches.at(detector).xsecErr_fb() : pythia.xsecErr_pb() * 1000.);
+    }
+
+    /// Pythia's upper estimate of the cross-section of the current collider in fb, as recorded with
+    /// the events being replayed.  All detectors are recorded in the same run, so the first will do.
+    double replayedXsecMaxEstimate_fb()
+    {
+      return eventCaches.at(detectorsInUse().front()).xsecMaxEstimate_fb();
+    }
+
+    /// Detector timing (see the timeDetectors option of operateLHCLoop): the time spent simulating the
+    /// events of the current collider, summed over threads, and the number of events, by detector.
+    /// Only resized outside of the parallel regions.
+    struct DetectorTiming
+    {
+      double seconds = 0;
+      int nEvents = 0;
+    };
+    bool timeDetectors;
+    std::map<str, DetectorTiming> detectorTimings;
+
+    /// Add the time since @a start to the simulation time of @a detector.
+    void addDetectorTime(const str& detector, const tp& start)
+    {
+      const double seconds = std::chrono::duration<double>(steady_clock::now() - start).count();
+      DetectorTiming& timing = detectorTimings.at(detector);
+      #pragma omp atomic
+      timing.seconds += seconds;
+      #pragma omp atomic
+      timing.nEvents++;
+    }
+
+    /// Log the simulation throughput of each detector for the current collider.  All detectors
+    /// simulate the same events.
+    void logDetectorTimings()
+    {
+      std::stringstream ss;
+      ss << "operateLHCLoop: detector simulation throughput for " << *iterPythiaNames << ":";
+      for (auto it = detectorTimings.begin(); it != detectorTimings.end(); ++it)
+      {
+        const DetectorTiming& timing = it->second;
+        ss << "\n  " << it->first << ": " << timing.nEvents << " events in " << timing.seconds << " s";
+        if (timing.seconds > 0) ss << ", " << timing.nEvents / timing.seconds << " events/s per thread";
+      }
+      logger() << LogTags::info << ss.str() << EOM;
+    }
+
+    /// Convert and smear event number @a iEvent with a BuckFast detector, weighted as by its generator,
+    /// replaying it from or recording it to the event cache of that detector.  Unsmeared cached events are smeared again when replayed.
+    void simulateBuckFastEvent(const str& detector, const BuckFastBase& sim, const Pythia8::Event& eventIn,
+                               const SpecializablePythia& hardScatteringSim, int iEvent, HEPUtils::Event& result)
+    {
+      if (replayingEvents)
+      {
+        if (!eventCaches.at(detector).replay(iEvent, result))
+          throw std::domain_error("Event " + std::to_string(iEvent) + " is not in the " + detector + " event cache.");
+        if (cacheUnsmearedEvents) sim.smearEvent(result);
+        return;
+      }
+      EventCache* cache = (eventCacheMode == RECORD_EVENTS ? &eventCaches.at(detector) : NULL);
+      const tp start = (timeDetectors ? steady_clock::now() : tp());
+      sim.convertEvent(eventIn, result);
+      result.set_weight(hardScatteringSim.event_weight());
+      if (cache and cacheUnsmearedEvents) cache->record(iEvent, result);
+      sim.smearEvent(result);
+      if (timeDetectors) addDetectorTime(detector, start);
+      if (cache and !cacheUnsmearedEvents) cache->record(iEvent, result);
+    }
+
+    /// Combine the analyses of all threads into the global container of each detector in use.  The
+    /// thread containers are combined in pairs in parallel, rather than one by one in a critical section.
+    void combineThreadAnalyses()
+    {
+      for (const str& detector : detectorsInUse())
+      {
+        std::vector<HEPUtilsAnalysisContainer*> containers;
+        for (HEPUtilsAnalysisContainer* container : threadAnalyses[detector])
+          if (container != NULL) containers.push_back(container);
+        if (containers.empty()) continue;
+        reduce_analyses(containers);
+
+        HEPUtilsAnalysisContainer& global = globalAnalyses(detector);
+        // Use improve_xsec to combine results from the same process type
+        global.improve_xsec(containers.front());
+        global.add(containers.front());
+
+        // Keep the cross-section with the recorded events
+        if (eventCacheMode == RECORD_EVENTS)
+        {
+          const HEPUtilsAnalysis* combined = containers.front()->analyses.front();
+          eventCaches.at(detector).set_xsec(combined->xsec(), combined->xsec_err(), xsecMaxEstimate_fb);
+        }
+      }
+    }
+
 
 
 
@@ -218,6 +482,11 @@ namespace Gambit
       haveUsedDelphesDetector = false;
 #endif
 
+      spectrumHash = 0;
+      replayingEvents = false;
+      eventCaches.clear();
+      threadAnalyses.clear();
+
 
       // Retrieve run options from the YAML file (or standalone code)
       pythiaNames = runOptions->getValue<std::vector<str> >("pythiaNames");
@@ -236,6 +505,55 @@ namespace Gambit
       bool silenceLoop = runOptions->getValueOrDef<bool>(true, "silenceLoop");
       if (silenceLoop) std::cout.rdbuf(0);
 
+      // Number of events each thread takes at a time from the event loop
+      int eventChunkSize = runOptions->getValueOrDef<int>(10, "eventChunkSize");
+      if (eventChunkSize < 1)
+      {
+        ColliderBit_error().raise(LOCAL_INFO, "The option 'eventChunkSize' for the function 'operateLHCLoop' must be at least 1.");
+      }
+
+      // Adaptive event counts: generate at least minEvents and at most nEvents events, in batches of
+      // eventBatchSize, stopping once the signal region yields are converged (see yieldsConverged).
+      bool adaptiveEvents = runOptions->getValueOrDef<bool>(false, "adaptiveEvents");
+      std::vector<int> minEvents = nEvents;
+      int eventBatchSize = 0;
+      double yieldTolerance = 0;
+      if (adaptiveEvents)
+      {
+        for (int& n : minEvents) n /= 10;
+        minEvents = runOptions->getValueOrDef<std::vector<int> >(minEvents, "minEvents");
+        CHECK_EQUAL_VECTOR_LENGTH(minEvents, pythiaNames)
+        eventBatchSize = runOptions->getValueOrDef<int>(1000, "eventBatchSize");
+        yieldTolerance = runOptions->getValueOrDef<double>(0.2, "yieldTolerance");
+        if (eventBatchSize < 1 or yieldTolerance <= 0)
+        {
+          ColliderBit_error().raise(LOCAL_INFO, "The options 'eventBatchSize' and 'yieldTolerance' for the function 'operateLHCLoop' must be positive.");
+        }
+      }
+
+      // Event cache: "record" writes the simulated events of every collider and detector to a file in
+      // eventCacheDir, named after the collider, the detector and a hash of the spectrum; "replay" reads
+      // them back through the analyses, with the seed they were generated with, instead of generating
+      // them again, falling back to generating events when there is no complete set of files.  With
+      // eventCacheUnsmeared, BuckFast events are cached before detector smearing, so that the smearing
+      // can be changed on replay.
+      str eventCacheOption = runOptions->getValueOrDef<str>("none", "eventCache");
+      if (eventCacheOption == "none") eventCacheMode = NO_EVENT_CACHE;
+      else if (eventCacheOption == "record") eventCacheMode = RECORD_EVENTS;
+      else if (eventCacheOption == "replay") eventCacheMode = REPLAY_EVENTS;
+      else
+      {
+        ColliderBit_error().raise(LOCAL_INFO, "The option 'eventCache' for the function 'operateLHCLoop' must be 'none', 'record' or 'replay'.");
+      }
+      cacheUnsmearedEvents = runOptions->getValueOrDef<bool>(false, "eventCacheUnsmeared");
+      eventCacheDir = runOptions->getValueOrDef<str>(GAMBIT_DIR "/scratch/event_cache/", "eventCacheDir");
+      if (not Utils::endsWith(eventCacheDir, "/")) eventCacheDir += "/";
+      if (eventCacheMode == RECORD_EVENTS) Utils::ensure_path_exists(eventCacheDir);
+
+      // Log the time each detector takes to simulate the events of each collider
+      timeDetectors = runOptions->getValueOrDef<bool>(false, "timeDetectors");
+      detectorTimings.clear();
+
 
 
       // Do the base-level initialisation
@@ -264,10 +582,44 @@ namespace Gambit
         piped_warnings.check(ColliderBit_warning());
         piped_errors.check(ColliderBit_error());
 
+        // Set up the event caches of the detectors in use.  When replaying, every detector needs its
+        // cache file, since the events can only be generated for all detectors or none.
+        replayingEvents = false;
+        nDroppedEvents = 0;
+        int nCachedEvents = nEvents[indexPythiaNames];
+        if (eventCacheMode == RECORD_EVENTS)
+        {
+          for (const str& detector : detectorsInUse()) eventCaches[detector].startRecording(nEvents[indexPythiaNames], seedBase);
+        }
+        else if (eventCacheMode == REPLAY_EVENTS)
+        {
+          replayingEvents = true;
+          for (const str& detector : detectorsInUse())
+          {
+            if (not eventCaches[detector].read(eventCacheFile(detector)))
+            {
+              logger() << LogTags::info << "operateLHCLoop: no cached events in " << eventCacheFile(detector)
+                       << ", generating the events for " << *iterPythiaNames << " instead." << EOM;
+              replayingEvents = false;
+              break;
+            }
+            nCachedEvents = std::min(nCachedEvents, eventCaches[detector].size());
+            // Smear and analyse the events with the random numbers they were recorded with
+            seedBase = eventCaches[detector].seed();
+          }
+        }
+
+        // Make room for each thread to register its analysis containers at START_SUBPROCESS
+        for (const str& detector : detectorsInUse()) threadAnalyses[detector].assign(omp_get_max_threads(), NULL);
+        detectorTimings.clear();
+        if (timeDetectors and not replayingEvents)
+        {
+          for (const str& detector : detectorsInUse()) detectorTimings[detector] = DetectorTiming();
+        }
+
         //
         // OMP parallelized loop begins here
         //
-        int currentEvent = 0;
         #pragma omp parallel
         {
           Loop::executeIteration(START_SUBPROCESS);
@@ -276,23 +628,73 @@ namespace Gambit
         piped_warnings.check(ColliderBit_warning());
         piped_errors.check(ColliderBit_error());
 
-        // Main event loop
-        #pragma omp parallel
+        // Main event loop.
+        // Threads claim chunks of eventChunkSize consecutive events until all events of the batch are taken.
+        // Each event is generated with its own seed (see eventSeed), so the events do not depend
+        // on the number of threads or on which thread generates them.
+        // Without adaptive event counts there is a single batch of nEvents events.
+        // When replaying events, there are only as many as were cached.
+        const int maxEventsNow = (replayingEvents ? nCachedEvents : nEvents[indexPythiaNames]);
+        int batchEnd = (adaptiveEvents ? std::max(1, std::min(minEvents[indexPythiaNames], maxEventsNow)) : maxEventsNow);
+        int nextChunkStart = 0;
+        bool converged = false;
+        while (true)
         {
-          while(currentEvent<nEvents[indexPythiaNames] and not *Loop::done and not piped_errors.inquire())
+          #pragma omp parallel
           {
-            if (!eventsGenerated)
-              eventsGenerated = true;
-            try
-            {
-              Loop::executeIteration(currentEvent);
-              currentEvent++;
-            }
-            catch (std::domain_error& e)
+            while(not *Loop::done and not piped_errors.inquire())
             {
-              std::cerr<<"\n   Continuing to the next event...\n\n";
+              int chunkStart;
+              #pragma omp atomic capture
+              {
+                chunkStart = nextChunkStart;
+                nextChunkStart += eventChunkSize;
+              }
+              if (chunkStart >= batchEnd) break;
+              int chunkEnd = std::min(chunkStart + eventChunkSize, batchEnd);
+
+              for (int currentEvent = chunkStart; currentEvent < chunkEnd and not *Loop::done and not piped_errors.inquire(); currentEvent++)
+              {
+                if (!eventsGenerated)
+                  eventsGenerated = true;
+                try
+                {
+                  Loop::executeIteration(currentEvent);
+                }
+                catch (std::domain_error& e)
+                {
+                  // With its seed fixed by the event number, a retry would fail the same way,
+                  // so the event is dropped and left out of the normalisation.
+                  #pragma omp atomic
+                  nDroppedEvents++;
+                  std::cerr<<"\n   Continuing to the next event...\n\n";
+                }
+              }
             }
           }
+          nextChunkStart = batchEnd;
+          if (not adaptiveEvents or batchEnd >= maxEventsNow or *Loop::done or piped_errors.inquire()) break;
+
+          // Collect the signal region counts so far from all threads, and stop if they are good enough.
+          convergenceTallies.clear();
+          #pragma omp parallel
+          {
+            Loop::executeIteration(CHECK_CONVERGENCE);
+          }
+          converged = yieldsConverged(yieldTolerance);
+          if (converged) break;
+          batchEnd = std::min(batchEnd + eventBatchSize, maxEventsNow);
+        }
+        if (adaptiveEvents)
+        {
+          logger() << LogTags::info << "operateLHCLoop: generated " << batchEnd << " of at most " << maxEventsNow
+                   << " events for " << *iterPythiaNames << (converged ? ", as the signal region yields converged." : ".") << EOM;
+        }
+        if (nDroppedEvents > 0)
+        {
+          logger() << LogTags::info << "operateLHCLoop: dropped " << nDroppedEvents << " of " << batchEnd << " events for "
+                   << *iterPythiaNames << " that threw std::domain_error.  The analyses are normalised by the "
+                   << batchEnd - nDroppedEvents << " events they analysed." << EOM;
         }
         // Any problems during the main event loop?
         piped_warnings.check(ColliderBit_warning());
@@ -306,10 +708,28 @@ namespace Gambit
         piped_warnings.check(ColliderBit_warning());
         piped_errors.check(ColliderBit_error());
 
+        // Combine the analysis results of the threads
+        if (eventsGenerated and not tooManyFailedEvents) combineThreadAnalyses();
+        if (not detectorTimings.empty()) logDetectorTimings();
+
         //
         // OMP parallelized loop ends here
         //
 
+        // Write the recorded events, unless none were generated or they failed.
+        if (eventCacheMode == RECORD_EVENTS)
+        {
+          for (const str& detector : detectorsInUse())
+          {
+            EventCache& cache = eventCaches[detector];
+            if (eventsGenerated and not tooManyFailedEvents and cache.size() > 0 and not cache.write(eventCacheFile(detector)))
+            {
+              ColliderBit_warning().raise(LOCAL_INFO, "Could not write the event cache file " + eventCacheFile(detector) + ".");
+            }
+            cache.clear();
+          }
+        }
+
         Loop::executeIteration(COLLIDER_FINALIZE);
       }
 
@@ -372,6 +792,7 @@ namespace Gambit
         {
           ColliderBit_error().raise(LOCAL_INFO, "No spectrum object available for this model.");
         }
+        spectrumHash = hashString(slha.str());
 
         // Read xsec veto values and store in static variable 'xsec_vetos'
         std::vector<double> default_xsec_vetos(pythiaNames.size(), 0.0);
@@ -395,28 +816,35 @@ namespace Gambit
           pythiaCommonOptions.insert(pythiaCommonOptions.end(), addPythiaOptions.begin(), addPythiaOptions.end());
         }
 
-        // We need showProcesses for the xsec veto.
-        pythiaCommonOptions.push_back("Init:showProcesses = on");
-
         // We need "SLHA:file = slhaea" for the SLHAea interface.
         pythiaCommonOptions.push_back("SLHA:file = slhaea");
+
+        // Identify the Pythia settings for the event cache
+        pythiaOptionsHash = hashStrings(pythiaCommonOptions);
       }
 
       else if (*Loop::iteration == START_SUBPROCESS)
       {
-        // Variables needed for the xsec veto
+        // Pythia's initialization output (only needed for debugging)
         std::stringstream processLevelOutput;
-        str _junk, readline;
-        int code, nxsec;
-        double xsec, totalxsec;
 
         // Each thread needs an independent Pythia instance at the start
         // of each event generation loop.
         // Thus, the actual Pythia initialization is
         // *after* COLLIDER_INIT, within omp parallel.
+        // Every point gets a new instance and a full Pythia initialization,
+        // with the new spectrum and decays.
 
         result.clear();
 
+        // No Pythia is needed to replay cached events, but the xsec veto still applies,
+        // to the estimate the events were recorded with.
+        if (replayingEvents)
+        {
+          if (replayedXsecMaxEstimate_fb() < xsec_vetos[indexPythiaNames]) Loop::wrapup();
+          return;
+        }
+
         // Get the Pythia options that are common across all OMP threads ('pythiaCommonOptions')
         // and then add the thread-specific seed
         std::vector<str> pythiaOptions = pythiaCommonOptions;
@@ -457,31 +885,16 @@ namespace Gambit
         // - Get the xsec veto value for the current collider
         double totalxsec_fb_veto = xsec_vetos[indexPythiaNames];
 
-        // - Get the upper limt xsec as estimated by Pythia
-        code = -1;
-        nxsec = 0;
-        totalxsec = 0.;
-        while(true)
-        {
-          std::getline(processLevelOutput, readline);
-          std::istringstream issPtr(readline);
-          issPtr.seekg(47, issPtr.beg);
-          issPtr >> code;
-          if (!issPtr.good() && nxsec > 0) break;
-          issPtr >> _junk >> xsec;
-          if (issPtr.good())
-          {
-            totalxsec += xsec;
-            nxsec++;
-          }
-        }
+        // - Get the upper limit xsec as estimated by Pythia
+        double totalxsec_fb = result.xsecMaxEstimate_pb() * 1e3;
+        if (omp_get_thread_num() == 0) xsecMaxEstimate_fb = totalxsec_fb;
 
         #ifdef COLLIDERBIT_DEBUG
-          std::cerr << debug_prefix() << "totalxsec [fb] = " << totalxsec * 1e12 << ", veto limit [fb] = " << totalxsec_fb_veto << endl;
+          std::cerr << debug_prefix() << "totalxsec [fb] = " << totalxsec_fb << ", veto limit [fb] = " << totalxsec_fb_veto << endl;
         #endif
 
         // - Wrap up loop if veto applies
-        if (totalxsec * 1e12 < totalxsec_fb_veto)
+        if (totalxsec_fb < totalxsec_fb_veto)
         {
           #ifdef COLLIDERBIT_DEBUG
             std::cerr << debug_prefix() << "Cross-section veto applies. Will now call Loop::wrapup() to skip event generation for this collider." << endl;
@@ -530,6 +943,12 @@ namespace Gambit
 
         if (filenames.size() <= fileCounter) invalid_point().raise("No more SLHA files. My work is done.");
 
+        // Identify the spectrum for the event cache by the contents of the SLHA file
+        std::ifstream slhaFile(filenames.at(fileCounter));
+        std::stringstream slhaContents;
+        slhaContents << slhaFile.rdbuf();
+        spectrumHash = hashString(slhaContents.str());
+
         // Read xsec veto values and store in static variable 'xsec_vetos'
         std::vector<double> default_xsec_vetos(pythiaNames.size(), 0.0);
         xsec_vetos = runOptions->getValueOrDef<std::vector<double> >(default_xsec_vetos, "xsec_vetos");
@@ -552,21 +971,18 @@ namespace Gambit
           pythiaCommonOptions.insert(pythiaCommonOptions.end(), addPythiaOptions.begin(), addPythiaOptions.end());
         }
 
-        // We need showProcesses for the xsec veto.
-        pythiaCommonOptions.push_back("Init:showProcesses = on");
-
         // We need to control "SLHA:file" for the SLHA interface.
         pythiaCommonOptions.push_back("SLHA:file = " + filenames.at(fileCounter));
+
+        // Identify the Pythia settings for the event cache
+        pythiaOptionsHash = hashStrings(pythiaCommonOptions);
       }
 
 
       if (*Loop::iteration == START_SUBPROCESS)
       {
-        // variables for xsec veto
+        // Pythia's initialization output (only needed for debugging)
         std::stringstream processLevelOutput;
-        str _junk, readline;
-        int code, nxsec;
-        double xsec, totalxsec;
 
         // Each thread needs an independent Pythia instance at the start
         // of each event generation loop.
@@ -575,6 +991,14 @@ namespace Gambit
 
         result.clear();
 
+        // No Pythia is needed to replay cached events, but the xsec veto still applies,
+        // to the estimate the events were recorded with.
+        if (replayingEvents)
+        {
+          if (replayedXsecMaxEstimate_fb() < xsec_vetos[indexPythiaNames]) Loop::wrapup();
+          return;
+        }
+
         if (omp_get_thread_num() == 0) logger() << "Reading SLHA file: " << filenames.at(fileCounter) << EOM;
 
         // Get the Pythia options that are common across all OMP threads ('pythiaCommonOptions')
@@ -614,31 +1038,16 @@ namespace Gambit
         // - Get the xsec veto value for the current collider
         double totalxsec_fb_veto = xsec_vetos[indexPythiaNames];
 
-        // - Get the upper limt xsec as estimated by Pythia
-        code = -1;
-        nxsec = 0;
-        totalxsec = 0.;
-        while(true)
-        {
-          std::getline(processLevelOutput, readline);
-          std::istringstream issPtr(readline);
-          issPtr.seekg(47, issPtr.beg);
-          issPtr >> code;
-          if (!issPtr.good() && nxsec > 0) break;
-          issPtr >> _junk >> xsec;
-          if (issPtr.good())
-          {
-            totalxsec += xsec;
-            nxsec++;
-          }
-        }
+        // - Get the upper limit xsec as estimated by Pythia
+        double totalxsec_fb = result.xsecMaxEstimate_pb() * 1e3;
+        if (omp_get_thread_num() == 0) xsecMaxEstimate_fb = totalxsec_fb;
 
         #ifdef COLLIDERBIT_DEBUG
-          std::cerr << debug_prefix() << "totalxsec [fb] = " << totalxsec * 1e12 << ", veto limit [fb] = " << totalxsec_fb_veto << endl;
+          std::cerr << debug_prefix() << "totalxsec [fb] = " << totalxsec_fb << ", veto limit [fb] = " << totalxsec_fb_veto << endl;
         #endif
 
         // - Wrap up loop if veto applies
-        if (totalxsec * 1e12 < totalxsec_fb_veto)
+        if (totalxsec_fb < totalxsec_fb_veto)
         {
           #ifdef COLLIDERBIT_DEBUG
             std::cerr << debug_prefix() << "Cross-section veto applies. Will now call Loop::wrapup() to skip event generation for this collider." << endl;
@@ -653,6 +1062,21 @@ namespace Gambit
     }
 
 
+    /// Pythia's upper estimate of the total cross-section (in fb) of the current collider,
+    /// from the maximum cross-sections of the subprocesses found at initialization.
+    void getXsecMaxEstimate(double& result)
+    {
+      using namespace Pipes::getXsecMaxEstimate;
+
+      if (*Loop::iteration == START_SUBPROCESS)
+      {
+        // Replayed events come with the estimate they were recorded with
+        if (replayingEvents) result = replayedXsecMaxEstimate_fb();
+        else result = Dep::HardScatteringSim->xsecMaxEstimate_pb() * 1e3;
+      }
+    }
+
+
     /// *** Detector Simulators ***
 
 #ifndef EXCLUDE_DELPHES
@@ -689,14 +1113,13 @@ namespace Gambit
 
       if (*Loop::iteration == COLLIDER_INIT)
       {
-        result.clear();
-
         // Get useDetector setting for the current collider
         useDelphesDetector = useDetector[indexPythiaNames];
         if (!useDelphesDetector) return;
         else haveUsedDelphesDetector = true;
 
-        // Setup new Delphes for the current collider
+        // Setup Delphes for the current collider.  Delphes is only configured from each config
+        // file once per run, and then reused for every point.
         std::vector<str> delphesOptions;
         delphesOptions.push_back(delphesConfigFiles[indexPythiaNames]);
 
@@ -907,6 +1330,7 @@ namespace Gambit
         // Thus, their initialization is *after* COLLIDER_INIT, within omp parallel.
         result.clear();
         result.init(analyses[indexPythiaNames]);
+        threadAnalyses.at("Det").at(omp_get_thread_num()) = &result;
 
         #ifdef COLLIDERBIT_DEBUG
           if (omp_get_thread_num() == 0)
@@ -921,23 +1345,23 @@ namespace Gambit
         return;
       }
 
+      if (*Loop::iteration == CHECK_CONVERGENCE && eventsGenerated && !tooManyFailedEvents)
+      {
+        tallyForConvergence("Det", result, colliderXsec_fb("Det", *Dep::HardScatteringSim));
+        return;
+      }
+
       if (*Loop::iteration == END_SUBPROCESS && eventsGenerated && !tooManyFailedEvents)
       {
-        const double xs_fb = Dep::HardScatteringSim->xsec_pb() * 1000.;
-        const double xserr_fb = Dep::HardScatteringSim->xsecErr_pb() * 1000.;
+        const double xs_fb = colliderXsec_fb("Det", *Dep::HardScatteringSim);
+        const double xserr_fb = colliderXsecErr_fb("Det", *Dep::HardScatteringSim);
         result.add_xsec(xs_fb, xserr_fb);
 
         #ifdef COLLIDERBIT_DEBUG
           std::cerr << debug_prefix() << "xs_fb = " << xs_fb << " +/- " << xserr_fb << endl;
         #endif
 
-        // Combine results from the threads together
-        #pragma omp critical (access_globalAnalyses)
-        {
-          globalAnalysesDet.add(result);
-          // Use improve_xsec to combine results from the same process type
-          globalAnalysesDet.improve_xsec(result);
-        }
+        // The results of the threads are combined by operateLHCLoop
         return;
       }
 
@@ -986,6 +1410,7 @@ namespace Gambit
         // Thus, their initialization is *after* COLLIDER_INIT, within omp parallel.
         result.clear();
         result.init(analyses[indexPythiaNames]);
+        threadAnalyses.at("ATLAS").at(omp_get_thread_num()) = &result;
 
         #ifdef COLLIDERBIT_DEBUG
           if (omp_get_thread_num() == 0)
@@ -1000,23 +1425,23 @@ namespace Gambit
         return;
       }
 
+      if (*Loop::iteration == CHECK_CONVERGENCE && eventsGenerated && !tooManyFailedEvents)
+      {
+        tallyForConvergence("ATLAS", result, colliderXsec_fb("ATLAS", *Dep::HardScatteringSim));
+        return;
+      }
+
       if (*Loop::iteration == END_SUBPROCESS && eventsGenerated && !tooManyFailedEvents)
       {
-        const double xs_fb = Dep::HardScatteringSim->xsec_pb() * 1000.;
-        const double xserr_fb = Dep::HardScatteringSim->xsecErr_pb() * 1000.;
+        const double xs_fb = colliderXsec_fb("ATLAS", *Dep::HardScatteringSim);
+        const double xserr_fb = colliderXsecErr_fb("ATLAS", *Dep::HardScatteringSim);
         result.add_xsec(xs_fb, xserr_fb);
 
         #ifdef COLLIDERBIT_DEBUG
           std::cerr << debug_prefix() << "xs_fb = " << xs_fb << " +/- " << xserr_fb << endl;
         #endif
 
-        // Combine results from the threads together
-        #pragma omp critical (access_globalAnalyses)
-        {
-          globalAnalysesATLAS.add(result);
-          // Use improve_xsec to combine results from the same process type
-          globalAnalysesATLAS.improve_xsec(result);
-        }
+        // The results of the threads are combined by operateLHCLoop
         return;
       }
 
@@ -1064,6 +1489,7 @@ namespace Gambit
         // Thus, their initialization is *after* COLLIDER_INIT, within omp parallel.
         result.clear();
         result.init(analyses[indexPythiaNames]);
+        threadAnalyses.at("CMS").at(omp_get_thread_num()) = &result;
 
         #ifdef COLLIDERBIT_DEBUG
           if (omp_get_thread_num() == 0)
@@ -1078,23 +1504,23 @@ namespace Gambit
         return;
       }
 
+      if (*Loop::iteration == CHECK_CONVERGENCE && eventsGenerated && !tooManyFailedEvents)
+      {
+        tallyForConvergence("CMS", result, colliderXsec_fb("CMS", *Dep::HardScatteringSim));
+        return;
+      }
+
       if (*Loop::iteration == END_SUBPROCESS && eventsGenerated && !tooManyFailedEvents)
       {
-        const double xs_fb = Dep::HardScatteringSim->xsec_pb() * 1000.;
-        const double xserr_fb = Dep::HardScatteringSim->xsecErr_pb() * 1000.;
+        const double xs_fb = colliderXsec_fb("CMS", *Dep::HardScatteringSim);
+        const double xserr_fb = colliderXsecErr_fb("CMS", *Dep::HardScatteringSim);
         result.add_xsec(xs_fb, xserr_fb);
 
         #ifdef COLLIDERBIT_DEBUG
           std::cerr << debug_prefix() << "xs_fb = " << xs_fb << " +/- " << xserr_fb << endl;
         #endif
 
-        // Combine results from the threads together
-        #pragma omp critical (access_globalAnalyses)
-        {
-          globalAnalysesCMS.add(result);
-          // Use improve_xsec to combine results from the same process type
-          globalAnalysesCMS.improve_xsec(result);
-        }
+        // The results of the threads are combined by operateLHCLoop
         return;
       }
 
@@ -1142,6 +1568,7 @@ namespace Gambit
         // Thus, their initialization is *after* COLLIDER_INIT, within omp parallel.
         result.clear();
         result.init(analyses[indexPythiaNames]);
+        threadAnalyses.at("Identity").at(omp_get_thread_num()) = &result;
 
         #ifdef COLLIDERBIT_DEBUG
           if (omp_get_thread_num() == 0)
@@ -1156,23 +1583,23 @@ namespace Gambit
         return;
       }
 
+      if (*Loop::iteration == CHECK_CONVERGENCE && eventsGenerated && !tooManyFailedEvents)
+      {
+        tallyForConvergence("Identity", result, colliderXsec_fb("Identity", *Dep::HardScatteringSim));
+        return;
+      }
+
       if (*Loop::iteration == END_SUBPROCESS && eventsGenerated && !tooManyFailedEvents)
       {
-        const double xs_fb = Dep::HardScatteringSim->xsec_pb() * 1000.;
-        const double xserr_fb = Dep::HardScatteringSim->xsecErr_pb() * 1000.;
+        const double xs_fb = colliderXsec_fb("Identity", *Dep::HardScatteringSim);
+        const double xserr_fb = colliderXsecErr_fb("Identity", *Dep::HardScatteringSim);
         result.add_xsec(xs_fb, xserr_fb);
 
         #ifdef COLLIDERBIT_DEBUG
           std::cerr << debug_prefix() << "xs_fb = " << xs_fb << " +/- " << xserr_fb << endl;
         #endif
 
-        // Combine results from the threads together
-        #pragma omp critical (access_globalAnalyses)
-        {
-          globalAnalysesIdentity.add(result);
-          // Use improve_xsec to combine results from the same process type
-          globalAnalysesIdentity.improve_xsec(result);
-        }
+        // The results of the threads are combined by operateLHCLoop
         return;
       }
 
@@ -1188,11 +1615,12 @@ namespace Gambit
 
       if (*Loop::iteration <= BASE_INIT) return;
       result.clear();
+      if (replayingEvents) return;
 
       /// Get the next event from Pythia8
       try
       {
-        Dep::HardScatteringSim->nextEvent(result);
+        Dep::HardScatteringSim->nextEvent(result, eventSeed(*Loop::iteration));
       }
       catch (SpecializablePythia::EventGenerationError& e)
       {
@@ -1224,11 +1652,21 @@ namespace Gambit
         if (*Loop::iteration <= BASE_INIT or !useDelphesDetector) return;
         result.clear();
 
+        if (replayingEvents)
+        {
+          if (!eventCaches.at("Det").replay(*Loop::iteration, result))
+            throw std::domain_error("Event " + std::to_string(*Loop::iteration) + " is not in the Det event cache.");
+          return;
+        }
+
         #pragma omp critical (Delphes)
         {
           try
           {
+            const tp start = (timeDetectors ? steady_clock::now() : tp());
             (*Dep::DetectorSim).processEvent(*Dep::HardScatteringEvent, result);
+            result.set_weight(Dep::HardScatteringSim->event_weight());
+            if (timeDetectors) addDetectorTime("Det", start);
           }
           catch (std::runtime_error& e)
           {
@@ -1250,6 +1688,7 @@ namespace Gambit
             Loop::wrapup();
           }
         }
+        if (eventCacheMode == RECORD_EVENTS) eventCaches.at("Det").record(*Loop::iteration, result);
       }
     #endif // not defined EXCLUDE_DELPHES
 
@@ -1263,7 +1702,9 @@ namespace Gambit
       // Get the next event from Pythia8, convert to HEPUtils::Event, and smear it
       try
       {
-        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result);
+        seedEventRandoms(*Loop::iteration, 1);
+        simulateBuckFastEvent("ATLAS", *Dep::SimpleSmearingSim, *Dep::HardScatteringEvent, *Dep::HardScatteringSim,
+                              *Loop::iteration, result);
       }
       catch (Gambit::exception& e)
       {
@@ -1294,7 +1735,9 @@ namespace Gambit
       // Get the next event from Pythia8, convert to HEPUtils::Event, and smear it
       try
       {
-        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result);
+        seedEventRandoms(*Loop::iteration, 2);
+        simulateBuckFastEvent("CMS", *Dep::SimpleSmearingSim, *Dep::HardScatteringEvent, *Dep::HardScatteringSim,
+                              *Loop::iteration, result);
       }
       catch (Gambit::exception& e)
       {
@@ -1325,7 +1768,8 @@ namespace Gambit
       // Get the next event from Pythia8 and convert to HEPUtils::Event
       try
       {
-        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result);
+        simulateBuckFastEvent("Identity", *Dep::SimpleSmearingSim, *Dep::HardScatteringEvent, *Dep::HardScatteringSim,
+                              *Loop::iteration, result);
       }
       catch (Gambit::exception& e)
       {
@@ -1392,6 +1836,7 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT) return;
 
       // Loop over analyses and run them... Managed by HEPUtilsAnalysisContainer
+      seedEventRandoms(*Loop::iteration, 5);
       Dep::DetAnalysisContainer->analyze(*Dep::ReconstructedEvent);
     }
 #endif // not defined EXCLUDE_DELPHES
@@ -1438,6 +1883,7 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT) return;
 
       // Loop over analyses and run them... Managed by HEPUtilsAnalysisContainer
+      seedEventRandoms(*Loop::iteration, 3);
       Dep::ATLASAnalysisContainer->analyze(*Dep::ATLASSmearedEvent);
     }
 
@@ -1482,6 +1928,7 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT) return;
 
       // Loop over analyses and run them... Managed by HEPUtilsAnalysisContainer
+      seedEventRandoms(*Loop::iteration, 4);
       Dep::CMSAnalysisContainer->analyze(*Dep::CMSSmearedEvent);
     }
 
@@ -1526,6 +1973,7 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT) return;
 
       // Loop over analyses and run them... Managed by HEPUtilsAnalysisContainer
+      seedEventRandoms(*Loop::iteration, 6);
       Dep::IdentityAnalysisContainer->analyze(*Dep::CopiedEvent);
     }
 
@@ -1580,6 +2028,14 @@ namespace Gambit
         if (haveUsedDelphesDetector)
          analysisResults.insert(analysisResults.end(), Dep::DetAnalysisNumbers->begin(), Dep::DetAnalysisNumbers->end());
       #endif
+      // Marginalise over the systematic errors with the lognormal or Gaussian distribution chosen by the backend group,
+      // using the backend functions unless the native implementation is requested.
+      const MargPoissonErrorType errorType = (*BEgroup::lnlike_marg_poisson == "lnlike_marg_poisson_lognormal_error" ? LOGNORMAL_ERROR : GAUSSIAN_ERROR);
+      static const bool useBackend = runOptions->getValueOrDef<bool>(true, "use_marg_poisson_backend");
+      // Whether the Monte Carlo error of the signal is added in quadrature to its systematic error
+      static const bool includeSignalMCError = runOptions->getValueOrDef<bool>(false, "include_signal_mc_error");
+      static thread_local std::vector<SRLogLikes> srLogLikes;
+
       // Loop over analyses and calculate the total observed dll
       double total_dll_obs = 0;
       for (size_t analysis = 0; analysis < analysisResults.size(); ++analysis)
@@ -1589,6 +2045,10 @@ namespace Gambit
           std::cerr << debug_prefix() << "calc_LHC_LogLike: Analysis " << analysis << " has " << analysisResults[analysis].size() << " signal regions." << endl;
         #endif
 
+        // The (log) likelihoods of all signal regions, for the b and s+b predictions, of the observed and the expected counts
+        if (useBackend) srLogLikes.resize(analysisResults[analysis].size());
+        else lnlike_marg_poisson(analysisResults[analysis], errorType, srLogLikes, includeSignalMCError);
+
         // Loop over the signal regions inside the analysis, and work out the total (delta) log likelihood for this analysis
         /// @note In general each analysis could/should work out its own likelihood so they can handle SR combination if possible.
         /// @note For now we just take the result from the SR *expected* to be most constraining, i.e. with highest expected dll
@@ -1608,27 +2068,47 @@ namespace Gambit
           const double n_predicted_uncertain_b = srData.n_background;
           const double n_predicted_uncertain_sb = srData.n_signal_at_lumi + srData.n_background;
 
-          // Relative error for n_predicted_uncertain
+          // Relative error for n_predicted_uncertain, optionally including the Monte Carlo error of the signal
           const double uncertainty_b = srData.background_sys/srData.n_background;
-          const double uncertainty_sb = sqrt(srData.background_sys*srData.background_sys + srData.signal_sys*srData.signal_sys) / n_predicted_uncertain_sb;
+          const double signal_mc_error = (includeSignalMCError ? srData.signal_mc_error_at_lumi() : 0);
+          const double uncertainty_sb = sqrt(srData.background_sys*srData.background_sys + srData.signal_sys*srData.signal_sys
+                                             + signal_mc_error*signal_mc_error) / n_predicted_uncertain_sb;
 
           const int n_predicted_total_b_int = (int) round(n_predicted_exact + n_predicted_uncertain_b);
 
-          double llb_exp = 0, llsb_exp = 0, llb_obs = 0, llsb_obs = 0;
-          // Use a log-normal distribution for the nuisance parameter (more correct)
-          if (*BEgroup::lnlike_marg_poisson == "lnlike_marg_poisson_lognormal_error") {
-            llb_exp = BEreq::lnlike_marg_poisson_lognormal_error(n_predicted_total_b_int, n_predicted_exact, n_predicted_uncertain_b, uncertainty_b);
-            llsb_exp = BEreq::lnlike_marg_poisson_lognormal_error(n_predicted_total_b_int, n_predicted_exact, n_predicted_uncertain_sb, uncertainty_sb);
-            llb_obs = BEreq::lnlike_marg_poisson_lognormal_error(n_obs, n_predicted_exact, n_predicted_uncertain_b, uncertainty_b);
-            llsb_obs = BEreq::lnlike_marg_poisson_lognormal_error(n_obs, n_predicted_exact, n_predicted_uncertain_sb, uncertainty_sb);
-          }
-          // Use a Gaussian distribution for the nuisance parameter (marginally faster)
-          else if (*BEgroup::lnlike_marg_poisson == "lnlike_marg_poisson_gaussian_error") {
-            llb_exp = BEreq::lnlike_marg_poisson_gaussian_error(n_predicted_total_b_int, n_predicted_exact, n_predicted_uncertain_b, uncertainty_b);
-            llsb_exp = BEreq::lnlike_marg_poisson_gaussian_error(n_predicted_total_b_int, n_predicted_exact, n_predicted_uncertain_sb, uncertainty_sb);
-            llb_obs = BEreq::lnlike_marg_poisson_gaussian_error(n_obs, n_predicted_exact, n_predicted_uncertain_b, uncertainty_b);
-            llsb_obs = BEreq::lnlike_marg_poisson_gaussian_error(n_obs, n_predicted_exact, n_predicted_uncertain_sb, uncertainty_sb);
+          // The backend function for the nuisance parameter distribution: log-normal (more correct) or Gaussian (marginally faster)
+          auto lnlike_marg_poisson_BE = [&](int n, double n_exact, double n_uncertain, double uncertainty)
+          {
+            if (errorType == LOGNORMAL_ERROR) return BEreq::lnlike_marg_poisson_lognormal_error(n, n_exact, n_uncertain, uncertainty);
+            return BEreq::lnlike_marg_poisson_gaussian_error(n, n_exact, n_uncertain, uncertainty);
+          };
+          #ifdef COLLIDERBIT_DEBUG
+            const bool checkBackend = true;
+          #else
+            const bool checkBackend = false;
+          #endif
+          if (useBackend or checkBackend)
+          {
+            SRLogLikes fromBackend;
+            fromBackend.b_exp = lnlike_marg_poisson_BE(n_predicted_total_b_int, n_predicted_exact, n_predicted_uncertain_b, uncertainty_b);
+            fromBackend.sb_exp = lnlike_marg_poisson_BE(n_predicted_total_b_int, n_predicted_exact, n_predicted_uncertain_sb, uncertainty_sb);
+            fromBackend.b_obs = lnlike_marg_poisson_BE(n_obs, n_predicted_exact, n_predicted_uncertain_b, uncertainty_b);
+            fromBackend.sb_obs = lnlike_marg_poisson_BE(n_obs, n_predicted_exact, n_predicted_uncertain_sb, uncertainty_sb);
+            if (useBackend) srLogLikes[SR] = fromBackend;
+            #ifdef COLLIDERBIT_DEBUG
+              const SRLogLikes& native = srLogLikes[SR];
+              for (auto member : {&SRLogLikes::b_exp, &SRLogLikes::sb_exp, &SRLogLikes::b_obs, &SRLogLikes::sb_obs})
+                if (std::abs(native.*member - fromBackend.*member) > 1e-4)
+                {
+                  std::stringstream msg;
+                  msg << "Native and backend marginalised Poisson likelihoods differ for " << srData.analysis_name << ", SR " << srData.sr_label
+                      << ": " << native.*member << " vs " << fromBackend.*member;
+                  ColliderBit_error().forced_throw(LOCAL_INFO, msg.str());
+                }
+            #endif
           }
+          const double llb_exp = srLogLikes[SR].b_exp, llsb_exp = srLogLikes[SR].sb_exp;
+          const double llb_obs = srLogLikes[SR].b_obs, llsb_obs = srLogLikes[SR].sb_obs;
 
           // Calculate the expected dll and set the bestexp values for exp and obs dll if this one is the best so far
           const double dll_exp = llb_exp - llsb_exp; //< note positive dll convention -> more exclusion here
@@ -1675,6 +2155,13 @@ namespace Gambit
 
     // *** Limits from e+e- colliders ***
 
+    /// Spectrum inputs to the LEP production cross-sections, retrieved once per point
+    void get_LEP_MSSM_spectrum_inputs(LEPSpectrumInputs& result)
+    {
+      using namespace Pipes::get_LEP_MSSM_spectrum_inputs;
+      get_LEP_spectrum_inputs(result, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+    }
+
     /// ee --> selectron pair production cross-sections at 208 GeV
     /// @{
     void LEP208_SLHA1_convention_xsec_selselbar(triplet<double>& result)
@@ -1682,7 +2169,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_selselbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 1, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 1, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1691,7 +2178,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_selserbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 1, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 1, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1700,7 +2187,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_serserbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 1, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 1, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1717,7 +2204,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 1, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 1, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1728,7 +2215,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 1, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 1, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1739,7 +2226,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 1, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 1, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1758,7 +2245,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_smulsmulbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 2, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 2, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1767,7 +2254,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_smulsmurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 2, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 2, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1776,7 +2263,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_smursmurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 2, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 2, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1793,7 +2280,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 2, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 2, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1804,7 +2291,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 2, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 2, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1815,7 +2302,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 2, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 2, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1834,7 +2321,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_staulstaulbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 3, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 3, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1843,7 +2330,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_staulstaurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 3, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 3, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1852,7 +2339,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_staurstaurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 3, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 208.0, 3, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1869,7 +2356,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 3, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 3, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1880,7 +2367,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 3, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 3, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1891,7 +2378,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 208.0, 3, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 208.0, 3, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1911,7 +2398,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_11;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1920,7 +2407,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_12;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1929,7 +2416,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_13;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 1, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 1, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1938,7 +2425,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_14;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 1, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 1, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1947,7 +2434,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_22;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1956,7 +2443,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_23;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 2, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 2, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1965,7 +2452,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_24;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 2, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 2, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1974,7 +2461,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_33;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 3, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 3, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1983,7 +2470,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_34;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 3, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 3, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -1992,7 +2479,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chi00_44;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 208.0, 4, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 208.0, 4, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2006,7 +2493,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chipm_11;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 208.0, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 208.0, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2015,7 +2502,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chipm_12;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 208.0, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 208.0, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2024,7 +2511,7 @@ namespace Gambit
       using namespace Pipes::LEP208_SLHA1_convention_xsec_chipm_22;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 208.0, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 208.0, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2044,7 +2531,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_selselbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 1, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 1, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2053,7 +2540,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_selserbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 1, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 1, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2062,7 +2549,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_serserbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 1, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 1, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2079,7 +2566,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 1, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 1, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2090,7 +2577,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 1, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 1, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2101,7 +2588,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 1, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 1, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2120,7 +2607,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_smulsmulbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 2, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 2, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2129,7 +2616,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_smulsmurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 2, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 2, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2138,7 +2625,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_smursmurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 2, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 2, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2155,7 +2642,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 2, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 2, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2166,7 +2653,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 2, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 2, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2177,7 +2664,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 2, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 2, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2196,7 +2683,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_staulstaulbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 3, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 3, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2205,7 +2692,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_staulstaurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 3, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 3, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2214,7 +2701,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_staurstaurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 3, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 205.0, 3, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2231,7 +2718,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 3, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 3, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2242,7 +2729,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 3, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 3, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2253,7 +2740,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 205.0, 3, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 205.0, 3, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2273,7 +2760,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_11;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2282,7 +2769,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_12;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2291,7 +2778,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_13;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 1, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 1, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2300,7 +2787,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_14;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 1, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 1, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2309,7 +2796,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_22;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2318,7 +2805,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_23;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 2, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 2, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2327,7 +2814,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_24;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 2, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 2, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2336,7 +2823,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_33;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 3, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 3, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2345,7 +2832,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_34;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 3, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 3, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2354,7 +2841,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chi00_44;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 205.0, 4, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 205.0, 4, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2368,7 +2855,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chipm_11;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 205.0, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 205.0, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2377,7 +2864,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chipm_12;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 205.0, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 205.0, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2386,7 +2873,7 @@ namespace Gambit
       using namespace Pipes::LEP205_SLHA1_convention_xsec_chipm_22;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 205.0, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 205.0, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2404,7 +2891,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_selselbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 1, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 1, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2413,7 +2900,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_selserbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 1, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 1, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2422,7 +2909,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_serserbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 1, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 1, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2439,7 +2926,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 1, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 1, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2450,7 +2937,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 1, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 1, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2461,7 +2948,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 1, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 1, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2480,7 +2967,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_smulsmulbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 2, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 2, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2489,7 +2976,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_smulsmurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 2, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 2, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2498,7 +2985,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_smursmurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 2, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 2, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2515,7 +3002,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 2, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 2, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2526,7 +3013,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 2, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 2, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2537,7 +3024,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 2, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 2, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2556,7 +3043,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_staulstaulbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 3, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 3, 1, 1, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2565,7 +3052,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_staulstaurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 3, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 3, 1, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2574,7 +3061,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_staurstaurbar;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 3, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, true);
+      get_sigma_ee_ll(result, 188.6, 3, 2, 2, tol, tol, pt_error, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, true);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2591,7 +3078,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 3, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 3, 1, 1, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2602,7 +3089,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 3, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 3, 1, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2613,7 +3100,7 @@ namespace Gambit
       const static bool gpt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
       const static double ftol = runOptions->getValueOrDef<double>(1e-2, "family_mixing_tolerance");
       const static bool fpt_error = runOptions->getValueOrDef<bool>(true, "family_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_ll(result, 188.6, 3, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV, false);
+      get_sigma_ee_ll(result, 188.6, 3, 2, 2, gtol, ftol, gpt_error, fpt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs, false);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2633,7 +3120,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_11;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2642,7 +3129,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_12;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2651,7 +3138,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_13;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 1, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 1, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2660,7 +3147,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_14;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 1, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 1, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2669,7 +3156,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_22;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2678,7 +3165,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_23;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 2, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 2, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2687,7 +3174,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_24;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 2, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 2, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2696,7 +3183,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_33;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 3, 3, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 3, 3, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2705,7 +3192,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_34;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 3, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 3, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2714,7 +3201,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chi00_44;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chi00(result, 188.6, 4, 4, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chi00(result, 188.6, 4, 4, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2728,7 +3215,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chipm_11;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 188.6, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 188.6, 1, 1, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2737,7 +3224,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chipm_12;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 188.6, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 188.6, 1, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
@@ -2746,7 +3233,7 @@ namespace Gambit
       using namespace Pipes::LEP188_SLHA1_convention_xsec_chipm_22;
       const static double tol = runOptions->getValueOrDef<double>(1e-2, "gauge_mixing_tolerance");
       const static bool pt_error = runOptions->getValueOrDef<bool>(true, "gauge_mixing_tolerance_invalidates_point_only");
-      get_sigma_ee_chipm(result, 188.6, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, Dep::Z_decay_rates->width_in_GeV);
+      get_sigma_ee_chipm(result, 188.6, 2, 2, tol, pt_error, *Dep::MSSM_spectrum, *Dep::LEP_MSSM_spectrum_inputs);
       if (!is_xsec_sane(result))
         ColliderBit_error().raise(LOCAL_INFO, "Non-physical LEP cross section!");
     }
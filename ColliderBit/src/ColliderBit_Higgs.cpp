@@ -36,6 +36,7 @@
 
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
+#include "gambit/ColliderBit/HiggsLikelihoodCache.hpp"
 
 //#define COLLIDERBIT_DEBUG
 
@@ -46,6 +47,27 @@ namespace Gambit
   namespace ColliderBit
   {
 
+    /// Helper function to set up the memoised likelihoods of a HiggsBounds/Signals function from its
+    /// options cacheTolerance (relative, 0 for exact matches only) and cacheCapacity (0 to disable)
+    void configure_cache(HiggsLikelihoodCache& cache, double tolerance, int capacity, const str& function)
+    {
+      if (tolerance < 0 or tolerance >= 1 or capacity < 0)
+      {
+        str errmsg = "The option 'cacheTolerance' of " + function + " must be in [0,1), ";
+        errmsg    += "and the option 'cacheCapacity' must not be negative.";
+        ColliderBit_error().raise(LOCAL_INFO, errmsg);
+      }
+      cache.configure(tolerance, capacity);
+    }
+
+    /// Helper function to log the hit rate of memoised HiggsBounds/Signals likelihoods now and then
+    void report_cache_hit_rate(const HiggsLikelihoodCache& cache, const str& function)
+    {
+      if (cache.lookups() % 1000 != 0) return;
+      logger() << LogTags::info << function << ": " << cache.hits() << " of the " << cache.lookups()
+               << " points so far (" << 100*cache.hitRate() << "%) reused the likelihood of an earlier point." << EOM;
+    }
+
     /// Helper function to set HiggsBounds/Signals parameters cross-section ratios from a GAMBIT HiggsCouplingsTable
     void set_CS(hb_ModelParameters &result, const HiggsCouplingsTable& couplings, int n_neutral_higgses)
     {
@@ -301,6 +323,20 @@ namespace Gambit
     {
       using namespace Pipes::calc_HB_LEP_LogLike;
 
+      // Reuse the likelihood of an earlier point with the same Higgs sector, if there is one.
+      static HiggsLikelihoodCache cache;
+      static bool cache_needs_configuring = true;
+      if (cache_needs_configuring)
+      {
+        configure_cache(cache, runOptions->getValueOrDef<double>(0., "cacheTolerance"),
+                        runOptions->getValueOrDef<int>(1000, "cacheCapacity"), "calc_HB_LEP_LogLike");
+        cache_needs_configuring = false;
+      }
+      const HiggsLikelihoodCache::Key cache_key = cache.key(*Dep::HB_ModelParameters);
+      const bool cached = cache.find(cache_key, result);
+      report_cache_hit_rate(cache, "calc_HB_LEP_LogLike");
+      if (cached) return;
+
       hb_ModelParameters ModelParam = *Dep::HB_ModelParameters;
 
       Farray<double, 1,3, 1,3> CS_lep_hjhi_ratio;
@@ -348,6 +384,7 @@ namespace Gambit
       BEreq::HB_calc_stats(theor_unc,chisq_withouttheory,chisq_withtheory,chan2);
 
       result = -0.5*chisq_withouttheory;
+      cache.insert(cache_key, result);
 
     }
 
@@ -356,6 +393,20 @@ namespace Gambit
     {
       using namespace Pipes::calc_HS_LHC_LogLike;
 
+      // Reuse the likelihood of an earlier point with the same Higgs sector, if there is one.
+      static HiggsLikelihoodCache cache;
+      static bool cache_needs_configuring = true;
+      if (cache_needs_configuring)
+      {
+        configure_cache(cache, runOptions->getValueOrDef<double>(0., "cacheTolerance"),
+                        runOptions->getValueOrDef<int>(1000, "cacheCapacity"), "calc_HS_LHC_LogLike");
+        cache_needs_configuring = false;
+      }
+      const HiggsLikelihoodCache::Key cache_key = cache.key(*Dep::HB_ModelParameters);
+      const bool cached = cache.find(cache_key, result);
+      report_cache_hit_rate(cache, "calc_HS_LHC_LogLike");
+      if (cached) return;
+
       hb_ModelParameters ModelParam = *Dep::HB_ModelParameters;
 
       Farray<double, 1,3, 1,3> CS_lep_hjhi_ratio;
@@ -403,6 +454,7 @@ namespace Gambit
       BEreq::run_HiggsSignals(mode, csqmu, csqmh, csqtot, nobs, Pvalue);
 
       result = -0.5*csqtot;
+      cache.insert(cache_key, result);
 
       #ifdef COLLIDERBIT_DEBUG
         std::ofstream f;
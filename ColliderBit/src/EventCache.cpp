@@ -0,0 +1,185 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  A compact binary cache of simulated events.
+///
+///  Each event is encoded as the numbers of
+///  particles and jets, the missing momentum and
+///  the event weight, then (px, py, pz, m, PDG
+///  ID) for every particle and (px, py, pz, m,
+///  tags) for every jet.  Events only hold prompt
+///  particles, so promptness is not stored.
+///
+///  *********************************************
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "gambit/ColliderBit/EventCache.hpp"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    namespace {
+
+      const char magic[8] = {'G','A','M','B','I','T','E','V'};
+      const std::int32_t formatVersion = 3;
+
+      template <typename T>
+      void put(std::vector<char>& buffer, T value) {
+        const size_t n = buffer.size();
+        buffer.resize(n + sizeof(T));
+        std::memcpy(&buffer[n], &value, sizeof(T));
+      }
+
+      void put(std::vector<char>& buffer, const HEPUtils::P4& p) {
+        put(buffer, p.px()); put(buffer, p.py()); put(buffer, p.pz()); put(buffer, p.m());
+      }
+
+      template <typename T>
+      T get(const char*& pos) {
+        T value;
+        std::memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+      }
+
+      HEPUtils::P4 getP4(const char*& pos) {
+        const double px = get<double>(pos), py = get<double>(pos), pz = get<double>(pos), m = get<double>(pos);
+        return HEPUtils::P4::mkXYZM(px, py, pz, m);
+      }
+
+    }
+
+
+    void EventCache::startRecording(int nEvents, int seed) {
+      clear();
+      _events.resize(nEvents);
+      _seed = seed;
+    }
+
+
+    void EventCache::record(int iEvent, const HEPUtils::Event& event) {
+      if (iEvent < 0 or iEvent >= int(_events.size())) return;
+      std::vector<char>& buffer = _events[iEvent];
+      buffer.clear();
+
+      std::vector<HEPUtils::Particle*> particles;
+      event.particles(particles);
+      const std::vector<HEPUtils::Jet*>& jets = event.jets();
+      put<std::uint32_t>(buffer, particles.size());
+      put<std::uint32_t>(buffer, jets.size());
+      put(buffer, event.missingmom());
+      put(buffer, event.weight());
+      for (const HEPUtils::Particle* p : particles) {
+        put(buffer, p->mom());
+        put<std::int32_t>(buffer, p->pid());
+      }
+      for (const HEPUtils::Jet* j : jets) {
+        put(buffer, j->mom());
+        put<std::uint8_t>(buffer, (j->btag() ? 1 : 0) | (j->ctag() ? 2 : 0));
+      }
+    }
+
+
+    bool EventCache::write(const std::string& filename) const {
+      std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+      if (!out) return false;
+      const std::int64_t nSlots = size();
+      out.write(magic, sizeof(magic));
+      out.write((const char*) &formatVersion, sizeof(formatVersion));
+      out.write((const char*) &_seed, sizeof(_seed));
+      out.write((const char*) &_xsec_fb, sizeof(_xsec_fb));
+      out.write((const char*) &_xsecErr_fb, sizeof(_xsecErr_fb));
+      out.write((const char*) &_xsecMaxEstimate_fb, sizeof(_xsecMaxEstimate_fb));
+      out.write((const char*) &nSlots, sizeof(nSlots));
+      std::vector<std::uint64_t> sizes(nSlots);
+      for (int i = 0; i < nSlots; ++i) sizes[i] = _events[i].size();
+      out.write((const char*) sizes.data(), nSlots*sizeof(std::uint64_t));
+      for (int i = 0; i < nSlots; ++i) out.write(_events[i].data(), _events[i].size());
+      return bool(out);
+    }
+
+
+    bool EventCache::read(const std::string& filename) {
+      clear();
+      std::ifstream in(filename, std::ios::binary);
+      if (!in) return false;
+
+      char fileMagic[sizeof(magic)];
+      std::int32_t version = 0;
+      std::int64_t nSlots = -1;
+      in.read(fileMagic, sizeof(fileMagic));
+      in.read((char*) &version, sizeof(version));
+      in.read((char*) &_seed, sizeof(_seed));
+      in.read((char*) &_xsec_fb, sizeof(_xsec_fb));
+      in.read((char*) &_xsecErr_fb, sizeof(_xsecErr_fb));
+      in.read((char*) &_xsecMaxEstimate_fb, sizeof(_xsecMaxEstimate_fb));
+      in.read((char*) &nSlots, sizeof(nSlots));
+      if (!in or std::memcmp(fileMagic, magic, sizeof(magic)) != 0 or version != formatVersion or nSlots < 0) {
+        clear();
+        return false;
+      }
+
+      std::vector<std::uint64_t> sizes(nSlots);
+      in.read((char*) sizes.data(), nSlots*sizeof(std::uint64_t));
+      _events.resize(nSlots);
+      for (int i = 0; i < nSlots and in; ++i) {
+        _events[i].resize(sizes[i]);
+        in.read(_events[i].data(), sizes[i]);
+      }
+      if (!in) {
+        clear();
+        return false;
+      }
+      return true;
+    }
+
+
+    bool EventCache::replay(int iEvent, HEPUtils::Event& event) const {
+      event.clear();
+      if (iEvent < 0 or iEvent >= int(_events.size()) or _events[iEvent].empty()) return false;
+      const char* pos = _events[iEvent].data();
+
+      const std::uint32_t nParticles = get<std::uint32_t>(pos);
+      const std::uint32_t nJets = get<std::uint32_t>(pos);
+      event.set_missingmom(getP4(pos));
+      const double weight = get<double>(pos);
+      if (weight != 1) event.set_weight(weight);
+      for (std::uint32_t i = 0; i < nParticles; ++i) {
+        const HEPUtils::P4 mom = getP4(pos);
+        const int pid = get<std::int32_t>(pos);
+        // The event sorts the particles into collections by PDG ID just as when they were
+        // recorded, so each collection is rebuilt in the same order.
+        HEPUtils::Particle* p = new HEPUtils::Particle(mom, pid);
+        p->set_prompt();
+        event.add_particle(p);
+      }
+      for (std::uint32_t i = 0; i < nJets; ++i) {
+        const HEPUtils::P4 mom = getP4(pos);
+        const std::uint8_t tags = get<std::uint8_t>(pos);
+        event.add_jet(new HEPUtils::Jet(mom, tags & 1, tags & 2));
+      }
+      return true;
+    }
+
+
+    int EventCache::size() const {
+      int n = _events.size();
+      while (n > 0 and _events[n-1].empty()) --n;
+      return n;
+    }
+
+
+    void EventCache::clear() {
+      _events.clear();
+      _seed = 0;
+      _xsec_fb = _xsecErr_fb = _xsecMaxEstimate_fb = -1;
+    }
+
+
+  }
+}
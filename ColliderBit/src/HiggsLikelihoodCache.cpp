@@ -0,0 +1,150 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Memoised HiggsBounds/HiggsSignals likelihoods.
+///
+///  Numbers are rounded by splitting them into a
+///  binary exponent and a mantissa in [0.5,1), and
+///  rounding the mantissa to a multiple of the
+///  tolerance.
+///
+///  *********************************************
+
+#include <cmath>
+#include <cstring>
+
+#include "gambit/ColliderBit/HiggsLikelihoodCache.hpp"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    void HiggsLikelihoodCache::configure(double tolerance, size_t capacity) {
+      if (tolerance != _tolerance) {
+        _order.clear();
+        _entries.clear();
+      }
+      _tolerance = tolerance;
+      _capacity = capacity;
+      while (_entries.size() > _capacity) {
+        _entries.erase(_order.back());
+        _order.pop_back();
+      }
+    }
+
+
+    void HiggsLikelihoodCache::addToKey(Key& k, double x) const {
+      if (_tolerance <= 0 or x == 0 or !std::isfinite(x)) {
+        long long bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        k.push_back(bits);
+        k.push_back(0);
+        return;
+      }
+      int exponent;
+      const double mantissa = std::frexp(x, &exponent);
+      k.push_back(exponent);
+      k.push_back(std::llround(mantissa/_tolerance));
+    }
+
+
+    HiggsLikelihoodCache::Key HiggsLikelihoodCache::key(const hb_ModelParameters& p) const {
+      // 135 doubles and the three CP ints; update the fields below if hb_ModelParameters changes
+      static_assert(sizeof(hb_ModelParameters) >= 135*sizeof(double) + 3*sizeof(int) and
+                    sizeof(hb_ModelParameters) <= 135*sizeof(double) + 4*sizeof(int),
+                    "hb_ModelParameters has changed; list its fields in HiggsLikelihoodCache::key");
+      Key k;
+      k.reserve(2*135 + 3);
+      // Neutral Higgses
+      addToKey(k, p.Mh);
+      addToKey(k, p.deltaMh);
+      addToKey(k, p.hGammaTot);
+      for (int cp : p.CP) k.push_back(cp);
+      addToKey(k, p.CS_lep_hjZ_ratio);
+      addToKey(k, p.CS_lep_bbhj_ratio);
+      addToKey(k, p.CS_lep_tautauhj_ratio);
+      addToKey(k, p.CS_lep_hjhi_ratio);
+      addToKey(k, p.CS_gg_hj_ratio);
+      addToKey(k, p.CS_bb_hj_ratio);
+      addToKey(k, p.CS_bg_hjb_ratio);
+      addToKey(k, p.CS_ud_hjWp_ratio);
+      addToKey(k, p.CS_cs_hjWp_ratio);
+      addToKey(k, p.CS_ud_hjWm_ratio);
+      addToKey(k, p.CS_cs_hjWm_ratio);
+      addToKey(k, p.CS_gg_hjZ_ratio);
+      addToKey(k, p.CS_dd_hjZ_ratio);
+      addToKey(k, p.CS_uu_hjZ_ratio);
+      addToKey(k, p.CS_ss_hjZ_ratio);
+      addToKey(k, p.CS_cc_hjZ_ratio);
+      addToKey(k, p.CS_bb_hjZ_ratio);
+      addToKey(k, p.CS_tev_vbf_ratio);
+      addToKey(k, p.CS_tev_tthj_ratio);
+      addToKey(k, p.CS_lhc7_vbf_ratio);
+      addToKey(k, p.CS_lhc7_tthj_ratio);
+      addToKey(k, p.CS_lhc8_vbf_ratio);
+      addToKey(k, p.CS_lhc8_tthj_ratio);
+      addToKey(k, p.BR_hjss);
+      addToKey(k, p.BR_hjcc);
+      addToKey(k, p.BR_hjbb);
+      addToKey(k, p.BR_hjmumu);
+      addToKey(k, p.BR_hjtautau);
+      addToKey(k, p.BR_hjWW);
+      addToKey(k, p.BR_hjZZ);
+      addToKey(k, p.BR_hjZga);
+      addToKey(k, p.BR_hjgaga);
+      addToKey(k, p.BR_hjgg);
+      addToKey(k, p.BR_hjinvisible);
+      addToKey(k, p.BR_hjhihi);
+      // Charged Higgs
+      addToKey(k, p.MHplus);
+      addToKey(k, p.deltaMHplus);
+      addToKey(k, p.HpGammaTot);
+      addToKey(k, p.CS_lep_HpjHmi_ratio);
+      addToKey(k, p.BR_tWpb);
+      addToKey(k, p.BR_tHpjb);
+      addToKey(k, p.BR_Hpjcs);
+      addToKey(k, p.BR_Hpjcb);
+      addToKey(k, p.BR_Hptaunu);
+      return k;
+    }
+
+
+    size_t HiggsLikelihoodCache::KeyHash::operator()(const Key& k) const {
+      // 64-bit FNV-1a over the elements
+      unsigned long long h = 0xCBF29CE484222325ULL;
+      for (long long x : k) h = (h ^ (unsigned long long)x) * 0x100000001B3ULL;
+      return size_t(h ^ (h >> 32));
+    }
+
+
+    bool HiggsLikelihoodCache::find(const Key& k, double& loglike) {
+      ++_lookups;
+      Entries::iterator it = _entries.find(k);
+      if (it == _entries.end()) return false;
+      ++_hits;
+      _order.splice(_order.begin(), _order, it->second.second);
+      loglike = it->second.first;
+      return true;
+    }
+
+
+    void HiggsLikelihoodCache::insert(const Key& k, double loglike) {
+      if (_capacity == 0) return;
+      Entries::iterator it = _entries.find(k);
+      if (it != _entries.end()) {
+        it->second.first = loglike;
+        _order.splice(_order.begin(), _order, it->second.second);
+        return;
+      }
+      if (_entries.size() >= _capacity) {
+        _entries.erase(_order.back());
+        _order.pop_back();
+      }
+      _order.push_front(k);
+      _entries[k] = std::make_pair(loglike, _order.begin());
+    }
+
+
+  }
+}
@@ -0,0 +1,268 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Poisson likelihoods of signal region counts,
+///  marginalised over the systematic error on the
+///  predicted number of events.
+///
+///  Substituting xi = exp(sigma*t) (lognormal) or
+///  xi = 1 + sigma*t (Gaussian) turns every integral
+///  into one over a standard normal variable t:
+///    L(n) = int dt phi(t) Poisson(n | lambda*xi(t)).
+///  The log of the integrand is concave in t, so it
+///  is integrated with Gauss-Legendre panels over the
+///  window around its peak where it is within e^-40
+///  of the maximum, with panels no wider than the
+///  width of the peak.  The windows of the four
+///  integrals of a signal region are merged into one
+///  grid, sharing the nodes and phi(t).
+///
+///  *********************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "gambit/ColliderBit/MargPoissonLikelihoods.hpp"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    namespace {
+
+      /// 8-point Gauss-Legendre nodes and weights on [-1,1]
+      const int nGL = 8;
+      const double xGL[nGL] = {-0.9602898564975363, -0.7966664774136267, -0.5255324099163290, -0.1834346424956498,
+                                0.1834346424956498,  0.5255324099163290,  0.7966664774136267,  0.9602898564975363};
+      const double wGL[nGL] = { 0.1012285362903763,  0.2223810344533745,  0.3137066458778873,  0.3626837833783620,
+                                0.3626837833783620,  0.3137066458778873,  0.2223810344533745,  0.1012285362903763};
+
+      /// How far below its maximum the log of an integrand is cut off
+      const double lnCutoff = 40;
+
+      /// Most panels in one stretch of the grid
+      const int maxPanels = 20000;
+
+      const double lnSqrt2Pi = 0.5*std::log(2*M_PI);
+
+
+      /// One marginalised Poisson integral, in the standard normal variable t
+      struct MargPoissonIntegral {
+        double n, lambda, sigma;
+        bool lognormal;
+        /// Position, log of the integrand and width of the peak, and the window of the integral
+        double tPeak, lnPeak, width, lo, hi;
+
+        /// Set up the integral for @a n events and a prediction @a lambda_ with relative error @a sigma_
+        void set(int n_, double lambda_, double sigma_, MargPoissonErrorType type) {
+          n = n_; lambda = lambda_; sigma = sigma_; lognormal = (type == LOGNORMAL_ERROR);
+          findPeak();
+          width = 1/(std::abs(dlnf(tPeak)) + std::sqrt(-d2lnf(tPeak)));
+          lo = edge(-1);
+          hi = edge(+1);
+        }
+
+        /// Smallest t inside the domain of xi
+        double tMin() const { return lognormal ? -std::numeric_limits<double>::infinity() : -1/sigma; }
+
+        /// Log of the integrand, without the t-independent factors
+        double lnf(double t) const {
+          if (lognormal) return n*(std::log(lambda) + sigma*t) - lambda*std::exp(sigma*t) - 0.5*t*t;
+          const double mu = lambda*(1 + sigma*t);
+          return (n > 0 ? n*std::log(mu) : 0) - mu - 0.5*t*t;
+        }
+
+        /// First and second derivatives of lnf
+        double dlnf(double t) const {
+          if (lognormal) return sigma*(n - lambda*std::exp(sigma*t)) - t;
+          return (n > 0 ? n*sigma/(1 + sigma*t) : 0) - lambda*sigma - t;
+        }
+        double d2lnf(double t) const {
+          if (lognormal) return -lambda*sigma*sigma*std::exp(sigma*t) - 1;
+          const double xi = 1 + sigma*t;
+          return (n > 0 ? -n*sigma*sigma/(xi*xi) : 0) - 1;
+        }
+
+        void findPeak() {
+          if (lognormal) {
+            // dlnf is decreasing, and changes sign in [min(0, -lambda*sigma), max(0, min(n*sigma, ln(n/lambda)/sigma))].
+            // The upper bound must be tight: from above, Newton's steps on the exponential are only about 1/sigma long.
+            double a = std::min(0., -lambda*sigma), b = 0, t = 0;
+            if (n > 0) b = std::max(0., std::min(n*sigma, std::log(n/lambda)/sigma));
+            for (int i = 0; i < 100; ++i) {
+              const double d = dlnf(t);
+              if (d > 0) a = t; else b = t;
+              double tNew = t - d/d2lnf(t);
+              if (!(tNew > a && tNew < b)) tNew = 0.5*(a + b);
+              if (std::abs(tNew - t) < 1e-12*(1 + std::abs(t))) { t = tNew; break; }
+              t = tNew;
+            }
+            tPeak = t;
+          } else {
+            // The maximum of lnf solves xi^2 + (lambda*sigma^2 - 1)*xi - n*sigma^2 = 0
+            const double c = lambda*sigma*sigma - 1;
+            const double xi = 0.5*(std::sqrt(c*c + 4*n*sigma*sigma) - c);
+            tPeak = (xi > 0 ? (xi - 1)/sigma : tMin());
+          }
+          lnPeak = lnf(tPeak);
+        }
+
+        /// Edge of the window in direction @a dir, where lnf has fallen by lnCutoff
+        double edge(int dir) const {
+          double d = width;
+          for (int i = 0; i < 64; ++i, d *= 2) {
+            const double t = tPeak + dir*d;
+            if (t <= tMin()) return tMin();
+            if (lnf(t) < lnPeak - lnCutoff) return t;
+          }
+          return tPeak + dir*d;
+        }
+      };
+
+
+      /// Quadrature nodes and log weights, including the log of the standard normal density
+      struct Grid {
+        std::vector<double> t, lnw;
+
+        /// Cover the windows of the given integrals, with panels no wider than the narrowest peak
+        /// overlapping each stretch, and no nodes where every integrand is negligible.
+        void build(const MargPoissonIntegral* const* integrals, int nIntegrals) {
+          t.clear(); lnw.clear();
+          std::vector<double> breaks;
+          for (int i = 0; i < nIntegrals; ++i) {
+            breaks.push_back(integrals[i]->lo);
+            breaks.push_back(integrals[i]->hi);
+          }
+          std::sort(breaks.begin(), breaks.end());
+          for (size_t j = 0; j+1 < breaks.size(); ++j) {
+            const double a = breaks[j], b = breaks[j+1];
+            if (!(b > a)) continue;
+            double h = std::numeric_limits<double>::infinity();
+            for (int i = 0; i < nIntegrals; ++i)
+              if (integrals[i]->lo <= a && integrals[i]->hi >= b) h = std::min(h, integrals[i]->width);
+            if (std::isinf(h)) continue;
+            const int nPanels = std::min(maxPanels, int(std::ceil((b - a)/h)));
+            const double half = 0.5*(b - a)/nPanels;
+            for (int p = 0; p < nPanels; ++p) {
+              const double mid = a + (2*p + 1)*half;
+              for (int k = 0; k < nGL; ++k) {
+                const double tk = mid + half*xGL[k];
+                t.push_back(tk);
+                lnw.push_back(std::log(half*wGL[k]) - 0.5*tk*tk - lnSqrt2Pi);
+              }
+            }
+          }
+        }
+      };
+
+
+      /// Log-likelihood without systematic error
+      double lnPoisson(int n, double lambda) {
+        if (lambda <= 0) return (n == 0 ? 0 : -std::numeric_limits<double>::infinity());
+        return n*std::log(lambda) - lambda - std::lgamma(n + 1.);
+      }
+
+      /// Whether the error on the prediction is too small to matter, or undefined
+      bool noError(double lambda, double sigma) {
+        return !(lambda > 0) || !(sigma > 1e-12);
+      }
+
+      /// Sum the integrands with counts @a n1 and @a n2 and prediction lambda*xi(t) over the grid.
+      /// Both share lambda and sigma, so ln(mu) and mu are computed once per node.
+      void sumTwo(const Grid& grid, const MargPoissonIntegral& i1, const MargPoissonIntegral& i2,
+                  double& ln1, double& ln2) {
+        const double n1 = i1.n, n2 = i2.n, lambda = i1.lambda, sigma = i1.sigma;
+        const double lnLambda = std::log(lambda);
+        const size_t nNodes = grid.t.size();
+        const double* t = grid.t.data();
+        const double* lnw = grid.lnw.data();
+        double s1 = 0, s2 = 0;
+        if (i1.lognormal) {
+          for (size_t k = 0; k < nNodes; ++k) {
+            const double lnMu = lnLambda + sigma*t[k], mu = std::exp(lnMu);
+            s1 += std::exp(lnw[k] + n1*lnMu - mu - i1.lnPeak);
+            s2 += std::exp(lnw[k] + n2*lnMu - mu - i2.lnPeak);
+          }
+        } else {
+          for (size_t k = 0; k < nNodes; ++k) {
+            const double xi = 1 + sigma*t[k];
+            if (xi <= 0) continue;
+            const double mu = lambda*xi, lnMu = std::log(mu);
+            s1 += std::exp(lnw[k] + (n1 > 0 ? n1*lnMu : 0) - mu - i1.lnPeak);
+            s2 += std::exp(lnw[k] + (n2 > 0 ? n2*lnMu : 0) - mu - i2.lnPeak);
+          }
+        }
+        ln1 = i1.lnPeak + std::log(s1) - std::lgamma(n1 + 1);
+        ln2 = i2.lnPeak + std::log(s2) - std::lgamma(n2 + 1);
+      }
+
+    }
+
+
+    double lnlike_marg_poisson(int n, double lambda, double relerr, MargPoissonErrorType type) {
+      if (noError(lambda, relerr)) return lnPoisson(n, lambda);
+      MargPoissonIntegral integral;
+      integral.set(n, lambda, relerr, type);
+      const MargPoissonIntegral* integrals[] = {&integral};
+      static thread_local Grid grid;
+      grid.build(integrals, 1);
+      double rtn, unused;
+      sumTwo(grid, integral, integral, rtn, unused);
+      return rtn;
+    }
+
+
+    void lnlike_marg_poisson(const std::vector<SignalRegionData>& srs, MargPoissonErrorType type,
+                             std::vector<SRLogLikes>& result, bool includeSignalMCError) {
+      static thread_local Grid grid;
+      result.resize(srs.size());
+      for (size_t i = 0; i < srs.size(); ++i) {
+        const SignalRegionData& srData = srs[i];
+        SRLogLikes& ll = result[i];
+
+        // Observed count, and the count expected from the background prediction
+        const int n_obs = (int) round(srData.n_observed);
+        const int n_exp = (int) round(srData.n_background);
+
+        // Predictions and their relative errors, optionally including the Monte Carlo error of the signal
+        const double lambda_b = srData.n_background;
+        const double lambda_sb = srData.n_signal_at_lumi + srData.n_background;
+        const double sigma_b = srData.background_sys/srData.n_background;
+        const double mc_sb = (includeSignalMCError ? srData.signal_mc_error_at_lumi() : 0);
+        const double sigma_sb = sqrt(srData.background_sys*srData.background_sys + srData.signal_sys*srData.signal_sys
+                                     + mc_sb*mc_sb) / lambda_sb;
+
+        const bool exact_b = noError(lambda_b, sigma_b), exact_sb = noError(lambda_sb, sigma_sb);
+        MargPoissonIntegral b_exp, b_obs, sb_exp, sb_obs;
+        const MargPoissonIntegral* integrals[4];
+        int nIntegrals = 0;
+        if (!exact_b) {
+          b_exp.set(n_exp, lambda_b, sigma_b, type);
+          b_obs.set(n_obs, lambda_b, sigma_b, type);
+          integrals[nIntegrals++] = &b_exp;
+          integrals[nIntegrals++] = &b_obs;
+        }
+        if (!exact_sb) {
+          sb_exp.set(n_exp, lambda_sb, sigma_sb, type);
+          sb_obs.set(n_obs, lambda_sb, sigma_sb, type);
+          integrals[nIntegrals++] = &sb_exp;
+          integrals[nIntegrals++] = &sb_obs;
+        }
+        if (nIntegrals > 0) grid.build(integrals, nIntegrals);
+
+        if (exact_b) {
+          ll.b_exp = lnPoisson(n_exp, lambda_b);
+          ll.b_obs = lnPoisson(n_obs, lambda_b);
+        } else sumTwo(grid, b_exp, b_obs, ll.b_exp, ll.b_obs);
+        if (exact_sb) {
+          ll.sb_exp = lnPoisson(n_exp, lambda_sb);
+          ll.sb_obs = lnPoisson(n_obs, lambda_sb);
+        } else sumTwo(grid, sb_exp, sb_obs, ll.sb_exp, ll.sb_obs);
+      }
+    }
+
+
+  }
+}
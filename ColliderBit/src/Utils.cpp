@@ -1,14 +1,24 @@
 #include "gambit/ColliderBit/Utils.hpp"
 #include <iostream>
+#include <random>
 using namespace std;
 
 namespace Gambit {
   namespace ColliderBit {
 
 
+    FastRNG& thread_rng() {
+      static thread_local FastRNG rng = []() {
+        std::random_device rd;
+        return FastRNG((uint64_t(rd()) << 32) + rd());
+      }();
+      return rng;
+    }
+
+
     bool random_bool(double eff) {
       /// @todo Handle out-of-range eff values
-      return HEPUtils::rand01() < eff;
+      return random_uniform() < eff;
     }
 
 
@@ -33,8 +33,8 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      int _numSRA1, _numSRA2, _numSRA3, _numSRA4;
-      int _numSRC1, _numSRC2, _numSRC3;
+      WeightedCount _numSRA1, _numSRA2, _numSRA3, _numSRA4;
+      WeightedCount _numSRC1, _numSRC2, _numSRC3;
 
       vector<int> cutFlowVector;
       vector<string> cutFlowVector_str;
@@ -97,8 +97,8 @@ namespace Gambit {
 
       Analysis_ATLAS_0LEPStop_20invfb() {
 
-        _numSRA1 = 0 ; _numSRA2 = 0; _numSRA3 = 0; _numSRA4 = 0;
-        _numSRC1 = 0 ; _numSRC2 = 0; _numSRC3 = 0;
+        _numSRA1 = WeightedCount(); _numSRA2 = WeightedCount(); _numSRA3 = WeightedCount(); _numSRA4 = WeightedCount();
+        _numSRC1 = WeightedCount(); _numSRC2 = WeightedCount(); _numSRC3 = WeightedCount();
         NCUTS=23;
         set_luminosity(20.1);
 
@@ -107,6 +107,28 @@ namespace Gambit {
           cutFlowVector_str.push_back("");
         }
 
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "MET > 130 GeV ";
+        cutFlowVector_str[2] = "Lepton veto ";
+        cutFlowVector_str[3] = "MET > 150 GeV ";
+        cutFlowVector_str[4] = "Jet multiplicity and pT ";
+        cutFlowVector_str[5] = "dPhi(jet,MET) > pi/5 ";
+        cutFlowVector_str[6] = ">=2 b jets ";
+        cutFlowVector_str[7] = "tau veto ";
+        cutFlowVector_str[8] = "mT(b,MET) > 175 ";
+        cutFlowVector_str[9] = "SRA1 ";
+        cutFlowVector_str[10] = "SRA2 ";
+        cutFlowVector_str[11] = "SRA3 ";
+        cutFlowVector_str[12] = "SRA4 ";
+        cutFlowVector_str[13] = "SRC: exactly 5 jets ";
+        cutFlowVector_str[14] = "SRC: dPhi(jet,MET) ";
+        cutFlowVector_str[15] = "SRC: >=2 b jets ";
+        cutFlowVector_str[16] = "SRC: tau veto ";
+        cutFlowVector_str[17] = "SRC: dPhi(b,b) ";
+        cutFlowVector_str[18] = "SRC1";
+        cutFlowVector_str[19] = "SRC2";
+        cutFlowVector_str[20] = "SRC3";
+
       }
 
 
@@ -120,16 +142,9 @@ namespace Gambit {
 
 
         // Baseline lepton objects
-        vector<HEPUtils::Particle*> baselineElectrons, baselineMuons, baselineTaus;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && electron->abseta() < 2.47) baselineElectrons.push_back(electron);
-        }
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && muon->abseta() < 2.4) baselineMuons.push_back(muon);
-        }
-        for (HEPUtils::Particle* tau : event->taus()) {
-          if (tau->pT() > 10. && tau->abseta() < 2.47) baselineTaus.push_back(tau);
-        }
+        vector<HEPUtils::Particle*> baselineElectrons = preselection().electrons(10., 2.47);
+        vector<HEPUtils::Particle*> baselineMuons = preselection().muons(10., 2.4);
+        vector<HEPUtils::Particle*> baselineTaus = preselection().taus(10., 2.47);
         ATLAS::applyTauEfficiencyR1(baselineTaus);
 
 
@@ -519,28 +534,6 @@ namespace Gambit {
 
         }
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "MET > 130 GeV ";
-        cutFlowVector_str[2] = "Lepton veto ";
-        cutFlowVector_str[3] = "MET > 150 GeV ";
-        cutFlowVector_str[4] = "Jet multiplicity and pT ";
-        cutFlowVector_str[5] = "dPhi(jet,MET) > pi/5 ";
-        cutFlowVector_str[6] = ">=2 b jets ";
-        cutFlowVector_str[7] = "tau veto ";
-        cutFlowVector_str[8] = "mT(b,MET) > 175 ";
-        cutFlowVector_str[9] = "SRA1 ";
-        cutFlowVector_str[10] = "SRA2 ";
-        cutFlowVector_str[11] = "SRA3 ";
-        cutFlowVector_str[12] = "SRA4 ";
-        cutFlowVector_str[13] = "SRC: exactly 5 jets ";
-        cutFlowVector_str[14] = "SRC: dPhi(jet,MET) ";
-        cutFlowVector_str[15] = "SRC: >=2 b jets ";
-        cutFlowVector_str[16] = "SRC: tau veto ";
-        cutFlowVector_str[17] = "SRC: dPhi(b,b) ";
-        cutFlowVector_str[18] = "SRC1";
-        cutFlowVector_str[19] = "SRC2";
-        cutFlowVector_str[20] = "SRC3";
-
         for(int j=0;j<NCUTS;j++){
           if(
              (j==0) ||
@@ -634,14 +627,14 @@ namespace Gambit {
         //We're now ready to apply the cuts for each signal region
         //_numSR1, _numSR2, _numSR3;
 
-        if(isSRA1)_numSRA1++;
-        if(isSRA2)_numSRA2++;
-        if(isSRA3)_numSRA3++;
-        if(isSRA4)_numSRA4++;
+        if(isSRA1)_numSRA1.fill(event->weight());
+        if(isSRA2)_numSRA2.fill(event->weight());
+        if(isSRA3)_numSRA3.fill(event->weight());
+        if(isSRA4)_numSRA4.fill(event->weight());
 
-        if(isSRC1)_numSRC1++;
-        if(isSRC2)_numSRC2++;
-        if(isSRC3)_numSRC3++;
+        if(isSRC1)_numSRC1.fill(event->weight());
+        if(isSRC2)_numSRC2.fill(event->weight());
+        if(isSRC3)_numSRC3.fill(event->weight());
 
         return;
 
@@ -649,7 +642,7 @@ namespace Gambit {
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_ATLAS_0LEPStop_20invfb* specificOther
@@ -659,7 +652,6 @@ namespace Gambit {
         if (NCUTS != specificOther->NCUTS) NCUTS = specificOther->NCUTS;
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
         _numSRA1 += specificOther->_numSRA1;
         _numSRA2 += specificOther->_numSRA2;
@@ -680,7 +672,8 @@ namespace Gambit {
         results_SRA1.n_background = 15.8;
         results_SRA1.background_sys = 1.9;
         results_SRA1.signal_sys = 0.;
-        results_SRA1.n_signal = _numSRA1;
+        results_SRA1.n_signal = _numSRA1.sumw;
+        results_SRA1.n_signal_sq = _numSRA1.sumw2;
 
         SignalRegionData results_SRA2;
         results_SRA2.analysis_name = "Analysis_ATLAS_0LEPStop_20invfb";
@@ -689,7 +682,8 @@ namespace Gambit {
         results_SRA2.n_background = 4.1;
         results_SRA2.background_sys = 0.8;
         results_SRA2.signal_sys = 0.;
-        results_SRA2.n_signal = _numSRA2;
+        results_SRA2.n_signal = _numSRA2.sumw;
+        results_SRA2.n_signal_sq = _numSRA2.sumw2;
 
         SignalRegionData results_SRA3;
         results_SRA3.analysis_name = "Analysis_ATLAS_0LEPStop_20invfb";
@@ -698,7 +692,8 @@ namespace Gambit {
         results_SRA3.n_background = 4.1;
         results_SRA3.background_sys = 0.9;
         results_SRA3.signal_sys = 0.;
-        results_SRA3.n_signal = _numSRA3;
+        results_SRA3.n_signal = _numSRA3.sumw;
+        results_SRA3.n_signal_sq = _numSRA3.sumw2;
 
         SignalRegionData results_SRA4;
         results_SRA4.analysis_name = "Analysis_ATLAS_0LEPStop_20invfb";
@@ -707,7 +702,8 @@ namespace Gambit {
         results_SRA4.n_background = 2.4;
         results_SRA4.background_sys = 0.7;
         results_SRA4.signal_sys = 0.;
-        results_SRA4.n_signal = _numSRA4;
+        results_SRA4.n_signal = _numSRA4.sumw;
+        results_SRA4.n_signal_sq = _numSRA4.sumw2;
 
         SignalRegionData results_SRC1;
         results_SRC1.analysis_name = "Analysis_ATLAS_0LEPStop_20invfb";
@@ -716,7 +712,8 @@ namespace Gambit {
         results_SRC1.n_background = 68.;
         results_SRC1.background_sys = 7.;
         results_SRC1.signal_sys = 0.;
-        results_SRC1.n_signal = _numSRC1;
+        results_SRC1.n_signal = _numSRC1.sumw;
+        results_SRC1.n_signal_sq = _numSRC1.sumw2;
 
         SignalRegionData results_SRC2;
         results_SRC2.analysis_name = "Analysis_ATLAS_0LEPStop_20invfb";
@@ -725,7 +722,8 @@ namespace Gambit {
         results_SRC2.n_background = 34.;
         results_SRC2.background_sys = 5.;
         results_SRC2.signal_sys = 0.;
-        results_SRC2.n_signal = _numSRC2;
+        results_SRC2.n_signal = _numSRC2.sumw;
+        results_SRC2.n_signal_sq = _numSRC2.sumw2;
 
         SignalRegionData results_SRC3;
         results_SRC3.analysis_name = "Analysis_ATLAS_0LEPStop_20invfb";
@@ -734,7 +732,8 @@ namespace Gambit {
         results_SRC3.n_background = 20.3;
         results_SRC3.background_sys = 3.;
         results_SRC3.signal_sys = 0.;
-        results_SRC3.n_signal = _numSRC3;
+        results_SRC3.n_signal = _numSRC3.sumw;
+        results_SRC3.n_signal_sq = _numSRC3.sumw2;
 
         add_result(results_SRA1);
         add_result(results_SRA2);
@@ -19,7 +19,7 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      double _num2jl, _num2jm, _num2jt, _num3j,
+      WeightedCount _num2jl, _num2jm, _num2jt, _num3j,
         _num4jlm, _num4jl, _num4jm, _num4jt, _num5j, _num6jl,
         _num6jm,_num6jt,_num6jtp;
 
@@ -32,9 +32,9 @@ namespace Gambit {
 
       Analysis_ATLAS_0LEP_20invfb() {
 
-        _num2jl=0; _num2jm=0; _num2jt=0; _num3j=0;
-        _num4jlm=0; _num4jl=0; _num4jm=0; _num4jt=0; _num5j=0; _num6jl=0;
-        _num6jm=0;_num6jt=0;_num6jtp=0;
+        _num2jl = WeightedCount(); _num2jm = WeightedCount(); _num2jt = WeightedCount(); _num3j = WeightedCount();
+        _num4jlm = WeightedCount(); _num4jl = WeightedCount(); _num4jm = WeightedCount(); _num4jt = WeightedCount(); _num5j = WeightedCount(); _num6jl = WeightedCount();
+        _num6jm = WeightedCount();_num6jt = WeightedCount();_num6jtp = WeightedCount();
 
         NCUTS=60;
         set_luminosity(20.3);
@@ -44,6 +44,36 @@ namespace Gambit {
           cutFlowVector_str.push_back("");
         }
 
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "2j: MET > 160 GeV and jet pT ";
+        cutFlowVector_str[2] = "2j: dPhiMin > 0.4 ";
+        cutFlowVector_str[3] = "2j: met/sqrt(HT) > 15 ";
+        cutFlowVector_str[4] = "2j: meff_incl > 1200 ";
+        cutFlowVector_str[5] = "2j: meff_incl > 1600 ";
+        cutFlowVector_str[6] = "3j: MET > 160 and jet pT ";
+        cutFlowVector_str[7] = "3j: dPhiMin > 0.4 ";
+        cutFlowVector_str[8] = "3j: met/meff3j > 0.3 ";
+        cutFlowVector_str[9] = "3j: met/meff_incl > 2200. ";
+        cutFlowVector_str[10] = "4jlm: MET > 160 and jet pT ";
+        cutFlowVector_str[11] = "4jlm: dPhiMin > 0.4 ";
+        cutFlowVector_str[12] = "4jlm: dPhiMin2 > 0.2 ";
+        cutFlowVector_str[13] = "4jlm: met/sqrt(HT) > 10 ";
+        cutFlowVector_str[14] = "4jlm: meff incl > 700 ";
+        cutFlowVector_str[15] = "4jl: meff incl > 1000 ";
+        cutFlowVector_str[16] = "4jt: met/meff4j > 0.25 ";
+        cutFlowVector_str[17] = "4jt: meff incl > 2200 ";
+        cutFlowVector_str[18] = "5j: MET > 160 and jet pT ";
+        cutFlowVector_str[19] = "5j: dPhiMin > 0.4 ";
+        cutFlowVector_str[20] = "5j: dPhiMin2 > 0.2 ";
+        cutFlowVector_str[21] = "5j: met/meff5j > 0.2 ";
+        cutFlowVector_str[22] = "5j: meff incl > 1200. ";
+        cutFlowVector_str[23] = "6jl: MET >  160 and jet pT  ";
+        cutFlowVector_str[24] = "6jl: dPhiMin > 0.4 ";
+        cutFlowVector_str[25] = "6jl: dPhiMin2 > 0.2 ";
+        cutFlowVector_str[26] = "6jl: met/meff6j > 0.2 ";
+        cutFlowVector_str[27] = "6jl: meff incl > 900. ";
+        cutFlowVector_str[28] = "6jt: met/meff6j > 0.25 ";
+        cutFlowVector_str[29] = "6jt: meff incl > 1500. ";
 
       }
 
@@ -55,19 +85,11 @@ namespace Gambit {
         HEPUtils::P4 ptot = event->missingmom();
         double met = event->met();
 
-        // Now define vectors of baseline objects
-        vector<HEPUtils::Particle*> baselineElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.47) baselineElectrons.push_back(electron);
-        }
-        vector<HEPUtils::Particle*> baselineMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.4) baselineMuons.push_back(muon);
-        }
-        vector<HEPUtils::Jet*> baselineJets;
-        for (HEPUtils::Jet* jet : event->jets()) {
-          if (jet->pT() > 20. && fabs(jet->eta()) < 4.5) baselineJets.push_back(jet);
-        }
+        // Now define vectors of baseline objects (shared with other analyses using the same cuts)
+        const vector<HEPUtils::Particle*>& baselineElectrons = preselection().electrons(10., 2.47);
+        const vector<HEPUtils::Particle*>& baselineMuons = preselection().muons(10., 2.4);
+        const vector<HEPUtils::Jet*>& baselineJets = preselection().jets(20., 4.5);
+        const vector<double>& dRJetEl = preselection().jet_deltaR_eta(baselineJets, baselineElectrons);
 
         // Overlap removal: only applied to jets with |eta|<2.8
         vector<HEPUtils::Particle*> signalElectrons;
@@ -77,11 +99,9 @@ namespace Gambit {
         // Remove any jet within dR=0.2 of an electrons
         for (size_t iJet=0;iJet<baselineJets.size();iJet++) {
           bool overlap=false;
-          HEPUtils::P4 jetVec=baselineJets.at(iJet)->mom();
-          if(fabs(jetVec.eta())<2.8){
+          if(fabs(baselineJets.at(iJet)->eta())<2.8){
             for (size_t iEl=0;iEl<baselineElectrons.size();iEl++) {
-              HEPUtils::P4 elVec=baselineElectrons.at(iEl)->mom();
-              if (fabs(elVec.deltaR_eta(jetVec))<0.2)overlap=true;
+              if (dRJetEl[iJet*baselineElectrons.size()+iEl]<0.2)overlap=true;
             }
           }
           if (!overlap)signalJets.push_back(baselineJets.at(iJet));
@@ -137,9 +157,9 @@ namespace Gambit {
             dPhiMin2j = SmallestdPhi(signalJets,ptot.phi());
             //meff2j = met + signalJets[0]->pT() + signalJets[1]->pT();
             if (leptonCut && metCut && dPhiMin2j>0.4) {
-              if (met/sqrt(HT)>8. && meff_incl>800.) _num2jl += 1;
-              if (met/sqrt(HT)>15. && meff_incl>1200.) _num2jm += 1;
-              if (met/sqrt(HT)>15. && meff_incl>1600.) _num2jt += 1;
+              if (met/sqrt(HT)>8. && meff_incl>800.) _num2jl.fill(event->weight());
+              if (met/sqrt(HT)>15. && meff_incl>1200.) _num2jm.fill(event->weight());
+              if (met/sqrt(HT)>15. && meff_incl>1600.) _num2jt.fill(event->weight());
             }
 
           }
@@ -154,7 +174,7 @@ namespace Gambit {
             dPhiMin3j = SmallestdPhi(signalJets,ptot.phi());
             meff3j = met + signalJets.at(0)->pT() + signalJets.at(1)->pT() + signalJets.at(2)->pT();
             if (leptonCut && metCut && dPhiMin3j > 0.4) {
-              if (met/meff3j>0.3 && meff_incl>2200.) _num3j += 1;
+              if (met/meff3j>0.3 && meff_incl>2200.) _num3j.fill(event->weight());
             }
           }
         }
@@ -170,10 +190,10 @@ namespace Gambit {
             dPhiMin2 = SmallestRemainingdPhi(signalJets,ptot.phi());
             meff4j = met + signalJets.at(0)->pT() + signalJets.at(1)->pT() + signalJets.at(2)->pT() + signalJets.at(3)->pT();
             if (leptonCut && metCut && dPhiMin4 > 0.4 && dPhiMin2 > 0.2) {
-              if(met/sqrt(HT)>10. && meff_incl>700.)_num4jlm += 1;
-              if(met/sqrt(HT)>10. && meff_incl>1000.)_num4jl += 1;
-              if (met/meff4j>0.4 && meff_incl>1300.) _num4jm += 1;
-              if (met/meff4j>0.25 && meff_incl>2200.) _num4jt += 1;
+              if(met/sqrt(HT)>10. && meff_incl>700.)_num4jlm.fill(event->weight());
+              if(met/sqrt(HT)>10. && meff_incl>1000.)_num4jl.fill(event->weight());
+              if (met/meff4j>0.4 && meff_incl>1300.) _num4jm.fill(event->weight());
+              if (met/meff4j>0.25 && meff_incl>2200.) _num4jt.fill(event->weight());
             }
           }
         }
@@ -185,7 +205,7 @@ namespace Gambit {
             dPhiMin2 = SmallestRemainingdPhi(signalJets,ptot.phi());
             double meff5j = met + signalJets.at(0)->pT() + signalJets.at(1)->pT() + signalJets.at(2)->pT() + signalJets.at(3)->pT() + signalJets.at(4)->pT();
             if (leptonCut && metCut && dPhiMin4>0.4 && dPhiMin2>0.2) {
-              if (met/meff5j>0.2 && meff_incl>1200.) _num5j += 1;
+              if (met/meff5j>0.2 && meff_incl>1200.) _num5j.fill(event->weight());
             }
           }
         }
@@ -198,45 +218,14 @@ namespace Gambit {
             dPhiMin2 = SmallestRemainingdPhi(signalJets,ptot.phi());
             meff6j = met + signalJets.at(0)->pT() + signalJets.at(1)->pT() + signalJets.at(2)->pT() + signalJets.at(3)->pT() + signalJets.at(4)->pT() + signalJets.at(5)->pT();
             if (leptonCut && metCut && dPhiMin4>0.4 && dPhiMin2>0.2) {
-              if (met/meff6j>0.2 && meff_incl>900.) _num6jl += 1;
-              if (met/meff6j>0.2 && meff_incl>1200.) _num6jm += 1;
-              if (met/meff6j>0.25 && meff_incl>1500.) _num6jt += 1;
-              if (met/meff6j>0.15 && meff_incl>1700.) _num6jtp += 1;
+              if (met/meff6j>0.2 && meff_incl>900.) _num6jl.fill(event->weight());
+              if (met/meff6j>0.2 && meff_incl>1200.) _num6jm.fill(event->weight());
+              if (met/meff6j>0.25 && meff_incl>1500.) _num6jt.fill(event->weight());
+              if (met/meff6j>0.15 && meff_incl>1700.) _num6jtp.fill(event->weight());
             }
           }
         }
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "2j: MET > 160 GeV and jet pT ";
-        cutFlowVector_str[2] = "2j: dPhiMin > 0.4 ";
-        cutFlowVector_str[3] = "2j: met/sqrt(HT) > 15 ";
-        cutFlowVector_str[4] = "2j: meff_incl > 1200 ";
-        cutFlowVector_str[5] = "2j: meff_incl > 1600 ";
-        cutFlowVector_str[6] = "3j: MET > 160 and jet pT ";
-        cutFlowVector_str[7] = "3j: dPhiMin > 0.4 ";
-        cutFlowVector_str[8] = "3j: met/meff3j > 0.3 ";
-        cutFlowVector_str[9] = "3j: met/meff_incl > 2200. ";
-        cutFlowVector_str[10] = "4jlm: MET > 160 and jet pT ";
-        cutFlowVector_str[11] = "4jlm: dPhiMin > 0.4 ";
-        cutFlowVector_str[12] = "4jlm: dPhiMin2 > 0.2 ";
-        cutFlowVector_str[13] = "4jlm: met/sqrt(HT) > 10 ";
-        cutFlowVector_str[14] = "4jlm: meff incl > 700 ";
-        cutFlowVector_str[15] = "4jl: meff incl > 1000 ";
-        cutFlowVector_str[16] = "4jt: met/meff4j > 0.25 ";
-        cutFlowVector_str[17] = "4jt: meff incl > 2200 ";
-        cutFlowVector_str[18] = "5j: MET > 160 and jet pT ";
-        cutFlowVector_str[19] = "5j: dPhiMin > 0.4 ";
-        cutFlowVector_str[20] = "5j: dPhiMin2 > 0.2 ";
-        cutFlowVector_str[21] = "5j: met/meff5j > 0.2 ";
-        cutFlowVector_str[22] = "5j: meff incl > 1200. ";
-        cutFlowVector_str[23] = "6jl: MET >  160 and jet pT  ";
-        cutFlowVector_str[24] = "6jl: dPhiMin > 0.4 ";
-        cutFlowVector_str[25] = "6jl: dPhiMin2 > 0.2 ";
-        cutFlowVector_str[26] = "6jl: met/meff6j > 0.2 ";
-        cutFlowVector_str[27] = "6jl: meff incl > 900. ";
-        cutFlowVector_str[28] = "6jt: met/meff6j > 0.25 ";
-        cutFlowVector_str[29] = "6jt: meff incl > 1500. ";
-      
         for (size_t j=0;j<NCUTS;j++){
           if(
              (j==0) ||
@@ -314,7 +303,7 @@ namespace Gambit {
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_ATLAS_0LEP_20invfb* specificOther
@@ -324,7 +313,6 @@ namespace Gambit {
         if (NCUTS != specificOther->NCUTS) NCUTS = specificOther->NCUTS;
         for (size_t j = 0; j < NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
         _num2jl += specificOther->_num2jl;
         _num2jm += specificOther->_num2jm;
@@ -364,7 +352,8 @@ namespace Gambit {
         results_2jl.n_background = 13000.;
         results_2jl.background_sys = 1000.;
         results_2jl.signal_sys = 0.;
-        results_2jl.n_signal = _num2jl;
+        results_2jl.n_signal = _num2jl.sumw;
+        results_2jl.n_signal_sq = _num2jl.sumw2;
         add_result(results_2jl);
 
         SignalRegionData results_2jm;
@@ -374,7 +363,8 @@ namespace Gambit {
         results_2jm.n_background = 760.;
         results_2jm.background_sys = 50.;
         results_2jm.signal_sys = 0.;
-        results_2jm.n_signal = _num2jm;
+        results_2jm.n_signal = _num2jm.sumw;
+        results_2jm.n_signal_sq = _num2jm.sumw2;
         add_result(results_2jm);
 
         SignalRegionData results_2jt;
@@ -384,7 +374,8 @@ namespace Gambit {
         results_2jt.n_background = 125.;
         results_2jt.background_sys = 10.;
         results_2jt.signal_sys = 0.;
-        results_2jt.n_signal = _num2jt;
+        results_2jt.n_signal = _num2jt.sumw;
+        results_2jt.n_signal_sq = _num2jt.sumw2;
         add_result(results_2jt);
 
         SignalRegionData results_3j;
@@ -394,7 +385,8 @@ namespace Gambit {
         results_3j.n_background = 5.;
         results_3j.background_sys = 1.2;
         results_3j.signal_sys = 0.;
-        results_3j.n_signal = _num3j;
+        results_3j.n_signal = _num3j.sumw;
+        results_3j.n_signal_sq = _num3j.sumw2;
         add_result(results_3j);
 
         SignalRegionData results_4jlm;
@@ -404,7 +396,8 @@ namespace Gambit {
         results_4jlm.n_background = 2120.;
         results_4jlm.background_sys = 110.;
         results_4jlm.signal_sys = 0.;
-        results_4jlm.n_signal = _num4jlm;
+        results_4jlm.n_signal = _num4jlm.sumw;
+        results_4jlm.n_signal_sq = _num4jlm.sumw2;
         add_result(results_4jlm);
 
         SignalRegionData results_4jl;
@@ -414,7 +407,8 @@ namespace Gambit {
         results_4jl.n_background = 630.;
         results_4jl.background_sys = 50.;
         results_4jl.signal_sys = 0.;
-        results_4jl.n_signal = _num4jl;
+        results_4jl.n_signal = _num4jl.sumw;
+        results_4jl.n_signal_sq = _num4jl.sumw2;
         add_result(results_4jl);
 
         SignalRegionData results_4jm;
@@ -424,7 +418,8 @@ namespace Gambit {
         results_4jm.n_background = 37.;
         results_4jm.background_sys = 6.;
         results_4jm.signal_sys = 0.;
-        results_4jm.n_signal = _num4jm;
+        results_4jm.n_signal = _num4jm.sumw;
+        results_4jm.n_signal_sq = _num4jm.sumw2;
         add_result(results_4jm);
 
         SignalRegionData results_4jt;
@@ -434,7 +429,8 @@ namespace Gambit {
         results_4jt.n_background = 2.5;
         results_4jt.background_sys = 1.;
         results_4jt.signal_sys = 0.;
-        results_4jt.n_signal = _num4jt;
+        results_4jt.n_signal = _num4jt.sumw;
+        results_4jt.n_signal_sq = _num4jt.sumw2;
         add_result(results_4jt);
 
         SignalRegionData results_5j;
@@ -444,7 +440,8 @@ namespace Gambit {
         results_5j.n_background = 126.;
         results_5j.background_sys = 13.;
         results_5j.signal_sys = 0.;
-        results_5j.n_signal = _num5j;
+        results_5j.n_signal = _num5j.sumw;
+        results_5j.n_signal_sq = _num5j.sumw2;
         add_result(results_5j);
 
         SignalRegionData results_6jl;
@@ -454,7 +451,8 @@ namespace Gambit {
         results_6jl.n_background = 111.;
         results_6jl.background_sys = 11.;
         results_6jl.signal_sys = 0.;
-        results_6jl.n_signal = _num6jl;
+        results_6jl.n_signal = _num6jl.sumw;
+        results_6jl.n_signal_sq = _num6jl.sumw2;
         add_result(results_6jl);
 
         SignalRegionData results_6jm;
@@ -464,7 +462,8 @@ namespace Gambit {
         results_6jm.n_background = 33.;
         results_6jm.background_sys = 6.;
         results_6jm.signal_sys = 0.;
-        results_6jm.n_signal = _num6jm;
+        results_6jm.n_signal = _num6jm.sumw;
+        results_6jm.n_signal_sq = _num6jm.sumw2;
         add_result(results_6jm);
 
         SignalRegionData results_6jt;
@@ -474,7 +473,8 @@ namespace Gambit {
         results_6jt.n_background = 5.2;
         results_6jt.background_sys = 1.4;
         results_6jt.signal_sys = 0.;
-        results_6jt.n_signal = _num6jt;
+        results_6jt.n_signal = _num6jt.sumw;
+        results_6jt.n_signal_sq = _num6jt.sumw2;
         add_result(results_6jt);
 
         SignalRegionData results_6jtp;
@@ -484,7 +484,8 @@ namespace Gambit {
         results_6jtp.n_background = 4.9;
         results_6jtp.background_sys = 1.6;
         results_6jtp.signal_sys = 0.;
-        results_6jtp.n_signal = _num6jt;
+        results_6jtp.n_signal = _num6jt.sumw;
+        results_6jtp.n_signal_sq = _num6jt.sumw2;
         add_result(results_6jtp);
       }
 
@@ -24,7 +24,7 @@ namespace Gambit {
 
       // Numbers passing cuts
       static const size_t NUMSR = 13;
-      double _srnums[13] = {0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0.};
+      WeightedCount _srnums[13];
       Cutflows _flows;
 
       Analysis_ATLAS_13TeV_0LEP_13invfb() {
@@ -63,23 +63,16 @@ namespace Gambit {
 
         // Get baseline jets
         /// @todo Drop b-tag if pT < 50 GeV or |eta| > 2.5?
-        vector<const Jet*> baselineJets;
-        for (const Jet* jet : event->jets())
-          if (jet->pT() > 20. && jet->abseta() < 2.8) {
-            baselineJets.push_back(jet);
-          }
+        const vector<Jet*>& presJets = preselection().jets(20., 2.8);
+        vector<const Jet*> baselineJets(presJets.begin(), presJets.end());
 
         // Get baseline electrons
-        vector<const Particle*> baselineElectrons;
-        for (const Particle* electron : event->electrons())
-          if (electron->pT() > 10. && electron->abseta() < 2.47)
-            baselineElectrons.push_back(electron);
+        const vector<Particle*>& presElectrons = preselection().electrons(10., 2.47);
+        vector<const Particle*> baselineElectrons(presElectrons.begin(), presElectrons.end());
 
         // Get baseline muons
-        vector<const Particle*> baselineMuons;
-        for (const Particle* muon : event->muons())
-          if (muon->pT() > 10. && muon->abseta() < 2.7)
-            baselineMuons.push_back(muon);
+        const vector<Particle*>& presMuons = preselection().muons(10., 2.7);
+        vector<const Particle*> baselineMuons(presMuons.begin(), presMuons.end());
 
         // Full isolation details:
         //  - Remove electrons within dR = 0.2 of a b-tagged jet
@@ -201,40 +194,40 @@ namespace Gambit {
           // 2 jet regions
           if (dphimin_123 > 0.8 && dphimin_more > 0.4) {
             if (signalJets[1]->pT() > 200 && etamax_2 < 0.8) { //< implicit pT[0] cut
-              if (met_sqrtHT > 14 && meff_incl >  800) _srnums[0] += 1;
+              if (met_sqrtHT > 14 && meff_incl >  800) _srnums[0].fill(event->weight());
             }
             if (signalJets[1]->pT() > 250 && etamax_2 < 1.2) { //< implicit pT[0] cut
-              if (met_sqrtHT > 16 && meff_incl > 1200) _srnums[1] += 1;
-              if (met_sqrtHT > 18 && meff_incl > 1600) _srnums[2] += 1;
-              if (met_sqrtHT > 20 && meff_incl > 2000) _srnums[3] += 1;
+              if (met_sqrtHT > 16 && meff_incl > 1200) _srnums[1].fill(event->weight());
+              if (met_sqrtHT > 18 && meff_incl > 1600) _srnums[2].fill(event->weight());
+              if (met_sqrtHT > 20 && meff_incl > 2000) _srnums[3].fill(event->weight());
             }
           }
 
           // 3 jet region
           if (nJets50 >= 3 && dphimin_123 > 0.4 && dphimin_more > 0.2) {
             if (signalJets[0]->pT() > 600 && signalJets[2]->pT() > 50) { //< implicit pT[1] cut
-              if (met_sqrtHT > 16 && meff_incl > 1200) _srnums[4] += 1;
+              if (met_sqrtHT > 16 && meff_incl > 1200) _srnums[4].fill(event->weight());
             }
           }
 
           // 4 jet regions (note implicit pT[1,2] cuts)
           if (nJets50 >= 4 && dphimin_123 > 0.4 && dphimin_more > 0.4 && signalJets[0]->pT() > 200 && aplanarity > 0.04) {
-            if (signalJets[3]->pT() > 100 && etamax_4 < 1.2 && met_meff_4 > 0.25 && meff_incl > 1000) _srnums[5] += 1;
-            if (signalJets[3]->pT() > 100 && etamax_4 < 2.0 && met_meff_4 > 0.25 && meff_incl > 1400) _srnums[6] += 1;
-            if (signalJets[3]->pT() > 100 && etamax_4 < 2.0 && met_meff_4 > 0.20 && meff_incl > 1800) _srnums[7] += 1;
-            if (signalJets[3]->pT() > 150 && etamax_4 < 2.0 && met_meff_4 > 0.20 && meff_incl > 2200) _srnums[8] += 1;
-            if (signalJets[3]->pT() > 150 &&                   met_meff_4 > 0.20 && meff_incl > 2600) _srnums[9] += 1;
+            if (signalJets[3]->pT() > 100 && etamax_4 < 1.2 && met_meff_4 > 0.25 && meff_incl > 1000) _srnums[5].fill(event->weight());
+            if (signalJets[3]->pT() > 100 && etamax_4 < 2.0 && met_meff_4 > 0.25 && meff_incl > 1400) _srnums[6].fill(event->weight());
+            if (signalJets[3]->pT() > 100 && etamax_4 < 2.0 && met_meff_4 > 0.20 && meff_incl > 1800) _srnums[7].fill(event->weight());
+            if (signalJets[3]->pT() > 150 && etamax_4 < 2.0 && met_meff_4 > 0.20 && meff_incl > 2200) _srnums[8].fill(event->weight());
+            if (signalJets[3]->pT() > 150 &&                   met_meff_4 > 0.20 && meff_incl > 2600) _srnums[9].fill(event->weight());
           }
 
           // 5 jet region (note implicit pT[1,2,3] cuts)
           if (nJets50 >= 5 && dphimin_123 > 0.4 && dphimin_more > 0.2 && signalJets[0]->pT() > 500) {
-            if (signalJets[4]->pT() > 50 && met_meff_5 > 0.3 && meff_incl > 1400) _srnums[10] += 1;
+            if (signalJets[4]->pT() > 50 && met_meff_5 > 0.3 && meff_incl > 1400) _srnums[10].fill(event->weight());
           }
 
           // 6 jet regions (note implicit pT[1,2,3,4] cuts)
           if (nJets50 >= 6 && dphimin_123 > 0.4 && dphimin_more > 0.2 && signalJets[0]->pT() > 200 && aplanarity > 0.08) {
-            if (signalJets[5]->pT() >  50 && etamax_6 < 2.0 && met_meff_6 > 0.20 && meff_incl > 1800) _srnums[11] += 1;
-            if (signalJets[5]->pT() > 100 &&                   met_meff_6 > 0.15 && meff_incl > 2200) _srnums[12] += 1;
+            if (signalJets[5]->pT() >  50 && etamax_6 < 2.0 && met_meff_6 > 0.20 && meff_incl > 1800) _srnums[11].fill(event->weight());
+            if (signalJets[5]->pT() > 100 &&                   met_meff_6 > 0.15 && meff_incl > 2200) _srnums[12].fill(event->weight());
           }
 	  
           // Cutflows
@@ -262,7 +255,7 @@ namespace Gambit {
       
       
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_ATLAS_13TeV_0LEP_13invfb* specificOther = dynamic_cast<Analysis_ATLAS_13TeV_0LEP_13invfb*>(other);
@@ -275,20 +268,27 @@ namespace Gambit {
       /// Register results objects with the results for each SR; obs & bkg numbers from the CONF note
       void collect_results() {
         static const string ANAME = "Analysis_ATLAS_13TeV_0LEP_13invfb";
-        add_result(SignalRegionData(ANAME, "meff-2j-0800", 650, {_srnums[0],  0.}, {610., 50.}));
-        add_result(SignalRegionData(ANAME, "meff-2j-1200", 270, {_srnums[1],  0.}, {297., 29.}));
-        add_result(SignalRegionData(ANAME, "meff-2j-1600",  96, {_srnums[2],  0.}, {121., 13.}));
-        add_result(SignalRegionData(ANAME, "meff-2j-2000",  29, {_srnums[3],  0.}, { 42.,  6.}));
-        add_result(SignalRegionData(ANAME, "meff-3j-1200", 363, {_srnums[4],  0.}, {355., 33.}));
-        add_result(SignalRegionData(ANAME, "meff-4j-1000",  97, {_srnums[5],  0.}, { 84.,  7.}));
-        add_result(SignalRegionData(ANAME, "meff-4j-1400",  71, {_srnums[6],  0.}, { 66.,  8.}));
-        add_result(SignalRegionData(ANAME, "meff-4j-1800",  37, {_srnums[7],  0.}, { 27.,  3.2}));
-        add_result(SignalRegionData(ANAME, "meff-4j-2200",  10, {_srnums[8],  0.}, {  4.8, 1.1}));
-        add_result(SignalRegionData(ANAME, "meff-4j-2600",   3, {_srnums[9],  0.}, {  2.7, 0.6}));
-        add_result(SignalRegionData(ANAME, "meff-5j-1400",  64, {_srnums[10], 0.}, { 68.,  9.}));
-        add_result(SignalRegionData(ANAME, "meff-6j-1800",  10, {_srnums[11], 0.}, {  5.5, 1.0}));
-        add_result(SignalRegionData(ANAME, "meff-6j-2200",   1, {_srnums[12], 0.}, {  0.82,0.35}));
+        add_result(SignalRegionData(ANAME, "meff-2j-0800", 650, _srnums[0], {610., 50.}));
+        add_result(SignalRegionData(ANAME, "meff-2j-1200", 270, _srnums[1], {297., 29.}));
+        add_result(SignalRegionData(ANAME, "meff-2j-1600",  96, _srnums[2], {121., 13.}));
+        add_result(SignalRegionData(ANAME, "meff-2j-2000",  29, _srnums[3], { 42.,  6.}));
+        add_result(SignalRegionData(ANAME, "meff-3j-1200", 363, _srnums[4], {355., 33.}));
+        add_result(SignalRegionData(ANAME, "meff-4j-1000",  97, _srnums[5], { 84.,  7.}));
+        add_result(SignalRegionData(ANAME, "meff-4j-1400",  71, _srnums[6], { 66.,  8.}));
+        add_result(SignalRegionData(ANAME, "meff-4j-1800",  37, _srnums[7], { 27.,  3.2}));
+        add_result(SignalRegionData(ANAME, "meff-4j-2200",  10, _srnums[8], {  4.8, 1.1}));
+        add_result(SignalRegionData(ANAME, "meff-4j-2600",   3, _srnums[9], {  2.7, 0.6}));
+        add_result(SignalRegionData(ANAME, "meff-5j-1400",  64, _srnums[10], { 68.,  9.}));
+        add_result(SignalRegionData(ANAME, "meff-6j-1800",  10, _srnums[11], {  5.5, 1.0}));
+        add_result(SignalRegionData(ANAME, "meff-6j-2200",   1, _srnums[12], {  0.82,0.35}));
+
+      }
+
 
+      /// Scale the results, and print the cutflows now that they are final.
+      /// @note Not done in collect_results, which also runs at every convergence check.
+      void scale(double factor=-1) {
+        HEPUtilsAnalysis::scale(factor);
         // const double sf = 13.3*crossSection()/femtobarn/sumOfWeights();
         // _flows.scale(sf);
         cout << "CUTFLOWS:\n\n" << _flows << endl;
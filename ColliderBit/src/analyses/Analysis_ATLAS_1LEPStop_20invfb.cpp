@@ -46,7 +46,7 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      int _numTN1Shape_bin1, _numTN1Shape_bin2, _numTN1Shape_bin3,
+      WeightedCount _numTN1Shape_bin1, _numTN1Shape_bin2, _numTN1Shape_bin3,
         _numTN2, _numTN3, _numBC1, _numBC2,_numBC3;
 
       vector<int> cutFlowVector_alt;
@@ -57,9 +57,9 @@ namespace Gambit {
     public:
 
       Analysis_ATLAS_1LEPStop_20invfb() {
-        _numTN1Shape_bin1 = 0; _numTN1Shape_bin2 = 0; _numTN1Shape_bin3 = 0;
-        _numTN2 = 0; _numTN3 = 0; _numBC1 = 0;
-        _numBC2 = 0; _numBC3 = 0; NCUTS = 41;
+        _numTN1Shape_bin1 = WeightedCount(); _numTN1Shape_bin2 = WeightedCount(); _numTN1Shape_bin3 = WeightedCount();
+        _numTN2 = WeightedCount(); _numTN3 = WeightedCount(); _numBC1 = WeightedCount();
+        _numBC2 = WeightedCount(); _numBC3 = WeightedCount(); NCUTS = 41;
         set_luminosity(20.7);
 
         for(int i=0;i<NCUTS;i++){
@@ -68,6 +68,49 @@ namespace Gambit {
           cutFlowVector_alt.push_back(0);
         }
 
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "Electron (=1 signal) ";
+        cutFlowVector_str[2] = "4 jets (80, 60, 40, 25) ";
+        cutFlowVector_str[3] = ">=1 b. tag ";
+        cutFlowVector_str[4] = "ETmiss > 100 GeV [all SRs] ";
+        cutFlowVector_str[5] = "ETmiss / sqrt(HT) > 5 [all SRs] ";
+        cutFlowVector_str[6] = "dPhi(jet2,MET) > 0.8 [all SRs] ";
+        cutFlowVector_str[7] = "dPhi(jet1,MET) > 0.8 [not SRtN2] ";
+        cutFlowVector_str[8] = "ETmiss > 200 GeV (SRtN2) ";
+        cutFlowVector_str[9] = "ETmiss / sqrt(HT) > 13 (SRtN2) ";
+        cutFlowVector_str[10] = "mT > 140 GeV (SRtN2) ";
+        cutFlowVector_str[11] = "ETmiss > 275 GeV (SRtN3) ";
+        cutFlowVector_str[12] = "ETmiss / sqrt(HT) > 11 (SRtN3) ";
+        cutFlowVector_str[13] = "mT > 200 GeV (SRtN3) ";
+        cutFlowVector_str[14] = "ETmiss > 150 GeV (SRbC1-SRbC3) ";
+        cutFlowVector_str[15] = "ETmiss / sqrt(HT) > 7 (SRbC1-SRbC3) ";
+        cutFlowVector_str[16] = "mT > 120 GeV (SRbC1-SRbC3) ";
+        cutFlowVector_str[17] = "ETmiss > 160 GeV (SRbC2,SRbC3) ";
+        cutFlowVector_str[18] = "ETmiss / sqrt(HT) > 8 (SRbC2,SRbC3) ";
+        cutFlowVector_str[19] = "meff > 550 GeV (SRbC2) ";
+        cutFlowVector_str[20] = "meff > 700 GeV (SRbC3) ";
+
+        cutFlowVector_str[21] = "Muon (=1 signal) ";
+        cutFlowVector_str[22] = "4 jets (80, 60, 40, 25) ";
+        cutFlowVector_str[23] = ">=1 b. tag ";
+        cutFlowVector_str[24] = "ETmiss > 100 GeV [all SRs] ";
+        cutFlowVector_str[25] = "ETmiss / sqrt(HT) > 5 [all SRs] ";
+        cutFlowVector_str[26] = "dPhi(jet2,MET) > 0.8 [all SRs] ";
+        cutFlowVector_str[27] = "dPhi(jet1,MET) > 0.8 [not SRtN2] ";
+        cutFlowVector_str[28] = "ETmiss > 200 GeV (SRtN2) ";
+        cutFlowVector_str[29] = "ETmiss / sqrt(HT) > 13 (SRtN2) ";
+        cutFlowVector_str[30] = "mT > 140 GeV (SRtN2) ";
+        cutFlowVector_str[31] = "ETmiss > 275 GeV (SRtN3) ";
+        cutFlowVector_str[32] = "ETmiss / sqrt(HT) > 11 (SRtN3) ";
+        cutFlowVector_str[33] = "mT > 200 GeV (SRtN3) ";
+        cutFlowVector_str[34] = "ETmiss > 150 GeV (SRbC1-SRbC3) ";
+        cutFlowVector_str[35] = "ETmiss / sqrt(HT) > 7 (SRbC1-SRbC3) ";
+        cutFlowVector_str[36] = "mT > 120 GeV (SRbC1-SRbC3) ";
+        cutFlowVector_str[37] = "ETmiss > 160 GeV (SRbC2,SRbC3) ";
+        cutFlowVector_str[38] = "ETmiss / sqrt(HT) > 8 (SRbC2,SRbC3) ";
+        cutFlowVector_str[39] = "meff > 550 GeV (SRbC2) ";
+        cutFlowVector_str[40] = "meff > 700 GeV (SRbC3) ";
+
       }
 
 
@@ -482,49 +525,6 @@ namespace Gambit {
         //double amt2=0;
         //double mt2tau=0;
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "Electron (=1 signal) ";
-        cutFlowVector_str[2] = "4 jets (80, 60, 40, 25) ";
-        cutFlowVector_str[3] = ">=1 b. tag ";
-        cutFlowVector_str[4] = "ETmiss > 100 GeV [all SRs] ";
-        cutFlowVector_str[5] = "ETmiss / sqrt(HT) > 5 [all SRs] ";
-        cutFlowVector_str[6] = "dPhi(jet2,MET) > 0.8 [all SRs] ";
-        cutFlowVector_str[7] = "dPhi(jet1,MET) > 0.8 [not SRtN2] ";
-        cutFlowVector_str[8] = "ETmiss > 200 GeV (SRtN2) ";
-        cutFlowVector_str[9] = "ETmiss / sqrt(HT) > 13 (SRtN2) ";
-        cutFlowVector_str[10] = "mT > 140 GeV (SRtN2) ";
-        cutFlowVector_str[11] = "ETmiss > 275 GeV (SRtN3) ";
-        cutFlowVector_str[12] = "ETmiss / sqrt(HT) > 11 (SRtN3) ";
-        cutFlowVector_str[13] = "mT > 200 GeV (SRtN3) ";
-        cutFlowVector_str[14] = "ETmiss > 150 GeV (SRbC1-SRbC3) ";
-        cutFlowVector_str[15] = "ETmiss / sqrt(HT) > 7 (SRbC1-SRbC3) ";
-        cutFlowVector_str[16] = "mT > 120 GeV (SRbC1-SRbC3) ";
-        cutFlowVector_str[17] = "ETmiss > 160 GeV (SRbC2,SRbC3) ";
-        cutFlowVector_str[18] = "ETmiss / sqrt(HT) > 8 (SRbC2,SRbC3) ";
-        cutFlowVector_str[19] = "meff > 550 GeV (SRbC2) ";
-        cutFlowVector_str[20] = "meff > 700 GeV (SRbC3) ";
-
-        cutFlowVector_str[21] = "Muon (=1 signal) ";
-        cutFlowVector_str[22] = "4 jets (80, 60, 40, 25) ";
-        cutFlowVector_str[23] = ">=1 b. tag ";
-        cutFlowVector_str[24] = "ETmiss > 100 GeV [all SRs] ";
-        cutFlowVector_str[25] = "ETmiss / sqrt(HT) > 5 [all SRs] ";
-        cutFlowVector_str[26] = "dPhi(jet2,MET) > 0.8 [all SRs] ";
-        cutFlowVector_str[27] = "dPhi(jet1,MET) > 0.8 [not SRtN2] ";
-        cutFlowVector_str[28] = "ETmiss > 200 GeV (SRtN2) ";
-        cutFlowVector_str[29] = "ETmiss / sqrt(HT) > 13 (SRtN2) ";
-        cutFlowVector_str[30] = "mT > 140 GeV (SRtN2) ";
-        cutFlowVector_str[31] = "ETmiss > 275 GeV (SRtN3) ";
-        cutFlowVector_str[32] = "ETmiss / sqrt(HT) > 11 (SRtN3) ";
-        cutFlowVector_str[33] = "mT > 200 GeV (SRtN3) ";
-        cutFlowVector_str[34] = "ETmiss > 150 GeV (SRbC1-SRbC3) ";
-        cutFlowVector_str[35] = "ETmiss / sqrt(HT) > 7 (SRbC1-SRbC3) ";
-        cutFlowVector_str[36] = "mT > 120 GeV (SRbC1-SRbC3) ";
-        cutFlowVector_str[37] = "ETmiss > 160 GeV (SRbC2,SRbC3) ";
-        cutFlowVector_str[38] = "ETmiss / sqrt(HT) > 8 (SRbC2,SRbC3) ";
-        cutFlowVector_str[39] = "meff > 550 GeV (SRbC2) ";
-        cutFlowVector_str[40] = "meff > 700 GeV (SRbC3) ";
-
 
         for(int j=0;j<NCUTS;j++){
           if(
@@ -640,9 +640,9 @@ namespace Gambit {
            passHadTop &&
            nBjets >= 1 &&
            bJets[0]->pT()>25.){
-          if(met>100. && met<125.)_numTN1Shape_bin1++;
-          if(met>125. && met<150.)_numTN1Shape_bin2++;
-          if(met>150.)_numTN1Shape_bin3++;
+          if(met>100. && met<125.)_numTN1Shape_bin1.fill(event->weight());
+          if(met>125. && met<150.)_numTN1Shape_bin2.fill(event->weight());
+          if(met>150.)_numTN1Shape_bin3.fill(event->weight());
         }
 
         //We're now ready to apply the cuts for each signal region
@@ -658,9 +658,9 @@ namespace Gambit {
              nBjets >= 1 &&
              bJets[0]->pT()>25.){
 
-            if(met>100. && met<125.)_numTN1Shape_bin1++;
-            if(met>125. && met<150.)_numTN1Shape_bin2++;
-            if(met>150.)_numTN1Shape_bin3++;
+            if(met>100. && met<125.)_numTN1Shape_bin1.fill(event->weight());
+            if(met>125. && met<150.)_numTN1Shape_bin2.fill(event->weight());
+            if(met>150.)_numTN1Shape_bin3.fill(event->weight());
           }
         }
 
@@ -672,7 +672,7 @@ namespace Gambit {
              mT>140. &&
              amt2>170. &&
              passHadTop &&
-             bJets[0]->pT()>25.)_numTN2++;
+             bJets[0]->pT()>25.)_numTN2.fill(event->weight());
         }
 
         //Do SRtN3
@@ -685,7 +685,7 @@ namespace Gambit {
              amt2>175. &&
              mt2tau>80. &&
              passHadTop &&
-             bJets[0]->pT()>25.)_numTN3++;
+             bJets[0]->pT()>25.)_numTN3.fill(event->weight());
         }
 
         //Do SRbC1
@@ -695,7 +695,7 @@ namespace Gambit {
              met>150. &&
              metOverSqrtHT>7. &&
              mT>120. &&
-             bJets[0]->pT()>25.)_numBC1++;
+             bJets[0]->pT()>25.)_numBC1.fill(event->weight());
         }
 
         //Do SRbC2
@@ -709,7 +709,7 @@ namespace Gambit {
              amt2>175. &&
              nBjets >=2 &&
              bJets[0]->pT()>100.&&
-             bJets[1]->pT()>50)_numBC2++;
+             bJets[1]->pT()>50)_numBC2.fill(event->weight());
         }
 
         //Do SRbC3
@@ -723,14 +723,14 @@ namespace Gambit {
              amt2>200. &&
              nBjets >=2 &&
              bJets[0]->pT()>120.&&
-             bJets[1]->pT()>90)_numBC3++;
+             bJets[1]->pT()>90)_numBC3.fill(event->weight());
         }
         return;
       }
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_ATLAS_1LEPStop_20invfb* specificOther
@@ -740,7 +740,6 @@ namespace Gambit {
         if (NCUTS != specificOther->NCUTS) NCUTS = specificOther->NCUTS;
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
           cutFlowVector_alt[j] += specificOther->cutFlowVector_alt[j];
         }
         _numTN1Shape_bin1 += specificOther->_numTN1Shape_bin1;
@@ -765,7 +764,8 @@ namespace Gambit {
         results_BC1.n_background = 482.;
         results_BC1.background_sys = 76.;
         results_BC1.signal_sys = 0.;
-        results_BC1.n_signal = _numBC1;
+        results_BC1.n_signal = _numBC1.sumw;
+        results_BC1.n_signal_sq = _numBC1.sumw2;
 
         SignalRegionData results_BC2;
         results_BC2.analysis_name = "Analysis_ATLAS_1LEPStop_20invfb";
@@ -774,7 +774,8 @@ namespace Gambit {
         results_BC2.n_background = 18.;
         results_BC2.background_sys = 5.;
         results_BC2.signal_sys = 0.;
-        results_BC2.n_signal = _numBC2;
+        results_BC2.n_signal = _numBC2.sumw;
+        results_BC2.n_signal_sq = _numBC2.sumw2;
 
         SignalRegionData results_BC3;
         results_BC3.analysis_name = "Analysis_ATLAS_1LEPStop_20invfb";
@@ -783,7 +784,8 @@ namespace Gambit {
         results_BC3.n_background = 7.;
         results_BC3.background_sys = 3.;
         results_BC3.signal_sys = 0.;
-        results_BC3.n_signal = _numBC3;
+        results_BC3.n_signal = _numBC3.sumw;
+        results_BC3.n_signal_sq = _numBC3.sumw2;
 
         SignalRegionData results_TN2;
         results_TN2.analysis_name = "Analysis_ATLAS_1LEPStop_20invfb";
@@ -792,7 +794,8 @@ namespace Gambit {
         results_TN2.n_background = 13.;
         results_TN2.background_sys = 3.;
         results_TN2.signal_sys = 0.;
-        results_TN2.n_signal = _numTN2;
+        results_TN2.n_signal = _numTN2.sumw;
+        results_TN2.n_signal_sq = _numTN2.sumw2;
 
         SignalRegionData results_TN3;
         results_TN3.analysis_name = "Analysis_ATLAS_1LEPStop_20invfb";
@@ -801,7 +804,8 @@ namespace Gambit {
         results_TN3.n_background = 5.;
         results_TN3.background_sys = 2.;
         results_TN3.signal_sys = 0.;
-        results_TN3.n_signal = _numTN3;
+        results_TN3.n_signal = _numTN3.sumw;
+        results_TN3.n_signal_sq = _numTN3.sumw2;
 
         add_result(results_BC1);
         add_result(results_BC2);
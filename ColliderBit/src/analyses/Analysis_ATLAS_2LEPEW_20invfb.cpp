@@ -36,19 +36,19 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts (doubles because we will use the trigger eff)
-      double _num_MT2_90_SF;
-      double _num_MT2_90_DF;
-      double _num_MT2_120_SF;
-      double _num_MT2_120_DF;
-      double _num_MT2_150_SF;
-      double _num_MT2_150_DF;
-      double _num_WWa_SF;
-      double _num_WWa_DF;
-      double _num_WWb_SF;
-      double _num_WWb_DF;
-      double _num_WWc_SF;
-      double _num_WWc_DF;
-      double _num_Zjets;
+      WeightedCount _num_MT2_90_SF;
+      WeightedCount _num_MT2_90_DF;
+      WeightedCount _num_MT2_120_SF;
+      WeightedCount _num_MT2_120_DF;
+      WeightedCount _num_MT2_150_SF;
+      WeightedCount _num_MT2_150_DF;
+      WeightedCount _num_WWa_SF;
+      WeightedCount _num_WWa_DF;
+      WeightedCount _num_WWb_SF;
+      WeightedCount _num_WWb_DF;
+      WeightedCount _num_WWc_SF;
+      WeightedCount _num_WWc_DF;
+      WeightedCount _num_Zjets;
 
       vector<double> cutFlowVector;
       vector<double> cutFlowIncrements;
@@ -58,19 +58,19 @@ namespace Gambit {
     public:
 
       Analysis_ATLAS_2LEPEW_20invfb() {
-        _num_MT2_90_SF=0;
-        _num_MT2_90_DF=0;
-        _num_MT2_120_SF=0;
-        _num_MT2_120_DF=0;
-        _num_MT2_150_SF=0;
-        _num_MT2_150_DF=0;
-        _num_WWa_SF=0;
-        _num_WWa_DF=0;
-        _num_WWb_SF=0;
-        _num_WWb_DF=0;
-        _num_WWc_SF=0;
-        _num_WWc_DF=0;
-        _num_Zjets=0;
+        _num_MT2_90_SF = WeightedCount();
+        _num_MT2_90_DF = WeightedCount();
+        _num_MT2_120_SF = WeightedCount();
+        _num_MT2_120_DF = WeightedCount();
+        _num_MT2_150_SF = WeightedCount();
+        _num_MT2_150_DF = WeightedCount();
+        _num_WWa_SF = WeightedCount();
+        _num_WWa_DF = WeightedCount();
+        _num_WWb_SF = WeightedCount();
+        _num_WWb_DF = WeightedCount();
+        _num_WWc_SF = WeightedCount();
+        _num_WWc_DF = WeightedCount();
+        _num_Zjets = WeightedCount();
         set_luminosity(20.3);
 
         for(int i=0;i<NCUTS;i++){
@@ -79,6 +79,90 @@ namespace Gambit {
           cutFlowIncrements.push_back(0.);
         }
 
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "2 electrons ";
+        cutFlowVector_str[2] = "Lepton pT cuts (trigger) ";
+        cutFlowVector_str[3] = "mll cuts ";
+        cutFlowVector_str[4] = "OS leptons ";
+        cutFlowVector_str[5] = "tau veto ";
+        cutFlowVector_str[6] = "e+e-: Jet veto ";
+        cutFlowVector_str[7] = "e+e-: Z veto ";
+        cutFlowVector_str[8] = "e+e-: SR-MT290 ";
+        cutFlowVector_str[9] = "e+e-: SR-MT2120 ";
+        cutFlowVector_str[10] = "e+e-: SR-MT2150 ";
+        cutFlowVector_str[11] = "mu+mu-: 2 signal leptons ";
+        cutFlowVector_str[12] = "mu+mu-: Jet veto ";
+        cutFlowVector_str[13] = "mu+mu-: Z veto ";
+        cutFlowVector_str[14] = "mu+mu-: SR-MT290 ";
+        cutFlowVector_str[15] = "mu+mu-: SR-MT2120 ";
+        cutFlowVector_str[16] = "mu+mu-: SR-MT2150 ";
+        cutFlowVector_str[17] = "e+-mu-+: 2 signal leptons ";
+        cutFlowVector_str[18] = "e+-mu-+: Jet veto ";
+        cutFlowVector_str[19] = "e+-mu-+: Z veto ";
+        cutFlowVector_str[20] = "e+-mu-+: SR-MT290 ";
+        cutFlowVector_str[21] = "e+-mu-+: SR-MT2120 ";
+        cutFlowVector_str[22] = "e+-mu-+: SR-MT2150 ";
+        cutFlowVector_str[23] = "SRZjets e+e-: 2 signal leptons ";
+        cutFlowVector_str[24] = "SRZjets e+e-: >=2 light jets ";
+        cutFlowVector_str[25] = "SRZjets e+e-: No b and forward jets ";
+        cutFlowVector_str[26] = "SRZjets e+e-: Z window ";
+        cutFlowVector_str[27] = "SRZjets e+e-: pTll > 80 ";
+        cutFlowVector_str[28] = "SRZjets e+e-: ETmissrel ";
+        cutFlowVector_str[29] = "SRZjets e+e-: dRll ";
+        cutFlowVector_str[30] = "SRZjets e+e-: mjj ";
+        cutFlowVector_str[31] = "SRZjets e+e-: jet pT ";
+        cutFlowVector_str[32] = "SRZjets mu+mu-: 2 signal leptons ";
+        cutFlowVector_str[33] = "SRZjets mu+mu-: >=2 light jets ";
+        cutFlowVector_str[34] = "SRZjets mu+mu-: No b and forward jets ";
+        cutFlowVector_str[35] = "SRZjets mu+mu-: Z window ";
+        cutFlowVector_str[36] = "SRZjets mu+mu-: pTll > 80 ";
+        cutFlowVector_str[37] = "SRZjets mu+mu-: ETmissrel ";
+        cutFlowVector_str[38] = "SRZjets mu+mu-: dRll ";
+        cutFlowVector_str[39] = "SRZjets mu+mu-: mjj ";
+        cutFlowVector_str[40] = "SRZjets mu+mu-: jet pT ";
+        cutFlowVector_str[41] = "SRWWa e+e-: 2 leptons ";
+        cutFlowVector_str[42] = "SRWWa e+e-: Jet veto ";
+        cutFlowVector_str[43] = "SRWWa e+e-: Z veto ";
+        cutFlowVector_str[44] = "SRWWa e+e-: pTll ";
+        cutFlowVector_str[45] = "SRWWa e+e-: ETmissrel ";
+        cutFlowVector_str[46] = "SRWWa e+e-: mll ";
+        cutFlowVector_str[47] = "SRWWa mu+mu-: 2 leptons ";
+        cutFlowVector_str[48] = "SRWWa mu+mu-: Jet veto ";
+        cutFlowVector_str[49] = "SRWWa mu+mu-: Z veto ";
+        cutFlowVector_str[50] = "SRWWa mu+mu-: pTll ";
+        cutFlowVector_str[51] = "SRWWa mu+mu-: ETmissrel ";
+        cutFlowVector_str[52] = "SRWWa mu+mu-: mll ";
+        cutFlowVector_str[53] = "SRWWa e+mu-: 2 leptons ";
+        cutFlowVector_str[54] = "SRWWa e+mu-: Jet veto ";
+        cutFlowVector_str[55] = "SRWWa e+mu-: pTll ";
+        cutFlowVector_str[56] = "SRWWa e+mu-: ETmissrel ";
+        cutFlowVector_str[57] = "SRWWa e+mu-: mll ";
+        cutFlowVector_str[58] = "SRWWb e+e-: 2 leptons ";
+        cutFlowVector_str[59] = "SRWWb e+e-: Jet veto ";
+        cutFlowVector_str[60] = "SRWWb e+e-: Z veto ";
+        cutFlowVector_str[61] = "SRWWb e+e-: mT2 > 90 ";
+        cutFlowVector_str[62] = "SRWWb e+e-: mll < 170 ";
+        cutFlowVector_str[63] = "SRWWb mu+mu-: 2 leptons ";
+        cutFlowVector_str[64] = "SRWWb mu+mu-: Jet veto ";
+        cutFlowVector_str[65] = "SRWWb mu+mu-: Z veto ";
+        cutFlowVector_str[66] = "SRWWb mu+mu-: mT2 > 90 ";
+        cutFlowVector_str[67] = "SRWWb mu+mu-: mll < 170 ";
+        cutFlowVector_str[68] = "SRWWb e+mu-: 2 leptons ";
+        cutFlowVector_str[69] = "SRWWb e+mu-: Jet veto ";
+        cutFlowVector_str[70] = "SRWWb e+mu-: mT2 > 90 ";
+        cutFlowVector_str[71] = "SRWWb e+mu-: mll < 170 ";
+        cutFlowVector_str[72] = "SRWWc e+e-: 2 leptons ";
+        cutFlowVector_str[73] = "SRWWc e+e-: Jet veto ";
+        cutFlowVector_str[74] = "SRWWc e+e-: Z veto ";
+        cutFlowVector_str[75] = "SRWWc e+e-: mT2 > 100 ";
+        cutFlowVector_str[76] = "SRWWc mu+mu-: 2 leptons ";
+        cutFlowVector_str[77] = "SRWWc mu+mu-: Jet veto ";
+        cutFlowVector_str[78] = "SRWWc mu+mu-: Z veto ";
+        cutFlowVector_str[79] = "SRWWc mu+mu-: mT2 > 100 ";
+        cutFlowVector_str[80] = "SRWWc e+mu-: 2 leptons ";
+        cutFlowVector_str[81] = "SRWWc e+mu-: Jet veto ";
+        cutFlowVector_str[82] = "SRWWc e+mu-: mT2 > 100 ";
+
       }
 
       void EleEleOverlapRemoval(vector<HEPUtils::Particle*> &vec1, vector<HEPUtils::Particle*> &vec2, double DeltaRMax) {
@@ -214,20 +298,10 @@ namespace Gambit {
         double met = event->met();
 
         // Now define vectors of baseline objects
-        vector<HEPUtils::Particle*> signalElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.47) signalElectrons.push_back(electron);
-        }
-        vector<HEPUtils::Particle*> signalMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.4) signalMuons.push_back(muon);
-        }
+        vector<HEPUtils::Particle*> signalElectrons = preselection().electrons(10., 2.47);
+        vector<HEPUtils::Particle*> signalMuons = preselection().muons(10., 2.4);
 
-        vector<HEPUtils::Jet*> signalJets;
-        for (HEPUtils::Jet* jet : event->jets()) {
-          if (jet->pT() > 20. && fabs(jet->eta()) < 4.5) signalJets.push_back(jet);
-          //if(jet->btag() && fabs(jet->eta()) < 2.5 && jet->pT() > 20.) bJets.push_back(jet);
-        }
+        vector<HEPUtils::Jet*> signalJets = preselection().jets(20., 4.5);
 
         vector<HEPUtils::Particle*> signalTaus;
         for (HEPUtils::Particle* tau : event->taus()) {
@@ -349,17 +423,17 @@ namespace Gambit {
           if(mt2>150.)cut_SRMT2150=true;
 
           //Signal region increments use the trigger efficiencies for ee, emu and mumu triggers
-          if(mt2 > 90. && (numElectrons==1 && numMuons==1))_num_MT2_90_DF=_num_MT2_90_DF+0.89;
-          if(passZVeto && mt2 > 90. && (numElectrons==2 && fabs(mll-91.)>10))_num_MT2_90_SF=_num_MT2_90_SF+0.97;
-          if(passZVeto && mt2 > 90. && (numMuons==2 && fabs(mll-91.)>10))_num_MT2_90_SF=_num_MT2_90_SF+0.75;
+          if(mt2 > 90. && (numElectrons==1 && numMuons==1))_num_MT2_90_DF.fill(0.89*event->weight());
+          if(passZVeto && mt2 > 90. && (numElectrons==2 && fabs(mll-91.)>10))_num_MT2_90_SF.fill(0.97*event->weight());
+          if(passZVeto && mt2 > 90. && (numMuons==2 && fabs(mll-91.)>10))_num_MT2_90_SF.fill(0.75*event->weight());
 
-          if(mt2 > 120. && (numElectrons==1 && numMuons==1))_num_MT2_120_DF=_num_MT2_120_DF+0.89;
-          if(passZVeto && mt2 > 120. && (numElectrons==2 && fabs(mll-91.)>10))_num_MT2_120_SF=_num_MT2_120_SF+0.97;
-          if(passZVeto && mt2 > 120. &&  (numMuons==2 && fabs(mll-91.)>10))_num_MT2_120_SF=_num_MT2_120_SF+0.75;
+          if(mt2 > 120. && (numElectrons==1 && numMuons==1))_num_MT2_120_DF.fill(0.89*event->weight());
+          if(passZVeto && mt2 > 120. && (numElectrons==2 && fabs(mll-91.)>10))_num_MT2_120_SF.fill(0.97*event->weight());
+          if(passZVeto && mt2 > 120. &&  (numMuons==2 && fabs(mll-91.)>10))_num_MT2_120_SF.fill(0.75*event->weight());
 
-          if(mt2 > 150. && (numElectrons==1 && numMuons==1))_num_MT2_150_DF=_num_MT2_150_DF+0.89;
-          if(passZVeto && mt2 > 150. && (numElectrons==2 && fabs(mll-91.)>10))_num_MT2_150_SF=_num_MT2_150_SF+0.97;
-          if(passZVeto && mt2 > 150. && (numMuons==2 && fabs(mll-91.)>10))_num_MT2_150_SF=_num_MT2_150_SF+0.75;
+          if(mt2 > 150. && (numElectrons==1 && numMuons==1))_num_MT2_150_DF.fill(0.89*event->weight());
+          if(passZVeto && mt2 > 150. && (numElectrons==2 && fabs(mll-91.)>10))_num_MT2_150_SF.fill(0.97*event->weight());
+          if(passZVeto && mt2 > 150. && (numMuons==2 && fabs(mll-91.)>10))_num_MT2_150_SF.fill(0.75*event->weight());
 
         }
 
@@ -430,36 +504,36 @@ namespace Gambit {
           if((signalLeptons[0]->mom() + signalLeptons[1]->mom()).pT() > 80. &&
              ETmiss_rel > 80. &&
              mll < 120. &&
-             (numElectrons==1 && numMuons==1))_num_WWa_DF=_num_WWa_DF+0.89;
+             (numElectrons==1 && numMuons==1))_num_WWa_DF.fill(0.89*event->weight());
 
           if((signalLeptons[0]->mom() + signalLeptons[1]->mom()).pT() > 80. &&
              ETmiss_rel > 80. &&
              mll < 120. &&
-             (numElectrons==2 && fabs(mll-91.)>10.))_num_WWa_SF=_num_WWa_SF+0.97;
+             (numElectrons==2 && fabs(mll-91.)>10.))_num_WWa_SF.fill(0.97*event->weight());
 
           if((signalLeptons[0]->mom() + signalLeptons[1]->mom()).pT() > 80. &&
              ETmiss_rel > 80. &&
              mll < 120. &&
-             (numMuons==2 && fabs(mll-91.)>10.))_num_WWa_SF=_num_WWa_SF+0.75;
+             (numMuons==2 && fabs(mll-91.)>10.))_num_WWa_SF.fill(0.75*event->weight());
 
           if(mt2 > 90. &&
              mll < 170. &&
-             (numElectrons==1 && numMuons==1))_num_WWb_DF=_num_WWb_DF+0.89;
+             (numElectrons==1 && numMuons==1))_num_WWb_DF.fill(0.89*event->weight());
 
           if(mt2 > 90. &&
              mll < 170. &&
-             (numElectrons==2 && fabs(mll-91.)>10.))_num_WWb_SF=_num_WWb_SF+0.97;
+             (numElectrons==2 && fabs(mll-91.)>10.))_num_WWb_SF.fill(0.97*event->weight());
 
 
           if(mt2 > 90. &&
              mll < 170. &&
-             (numMuons==2 && fabs(mll-91.)>10.))_num_WWb_SF=_num_WWb_SF+0.75;
+             (numMuons==2 && fabs(mll-91.)>10.))_num_WWb_SF.fill(0.75*event->weight());
 
-          if(mt2 > 100. && (numElectrons==1 && numMuons==1))_num_WWc_DF=_num_WWc_DF+0.89;
+          if(mt2 > 100. && (numElectrons==1 && numMuons==1))_num_WWc_DF.fill(0.89*event->weight());
 
-          if(mt2 > 100. && (numElectrons==2 && fabs(mll-91.)>10.))_num_WWc_SF=_num_WWc_SF+0.97;
+          if(mt2 > 100. && (numElectrons==2 && fabs(mll-91.)>10.))_num_WWc_SF.fill(0.97*event->weight());
 
-          if(mt2 > 100. && (numMuons==2 && fabs(mll-91.)>10.))_num_WWc_SF=_num_WWc_SF+0.75;
+          if(mt2 > 100. && (numMuons==2 && fabs(mll-91.)>10.))_num_WWc_SF.fill(0.75*event->weight());
 
         }
 
@@ -515,96 +589,12 @@ namespace Gambit {
           if(!(mjj > 50. && mjj<100.))passMjj=false;
           if(!(centralNonBJets[0]->pT()>45. && centralNonBJets[1]->pT()>45.))passJetPT=false;
 
-          if(fabs(mll-91.)<10 && ETmiss_rel>80. && (signalLeptons[0]->mom()+signalLeptons[1]->mom()).pT()>80. && dRll > 0.3 && dRll < 1.5 && mjj > 50. && mjj<100. && passJetPT && (numElectrons==2 && numMuons==0))_num_Zjets=_num_Zjets+0.97;
+          if(fabs(mll-91.)<10 && ETmiss_rel>80. && (signalLeptons[0]->mom()+signalLeptons[1]->mom()).pT()>80. && dRll > 0.3 && dRll < 1.5 && mjj > 50. && mjj<100. && passJetPT && (numElectrons==2 && numMuons==0))_num_Zjets.fill(0.97*event->weight());
 
-          if(fabs(mll-91.)<10 && ETmiss_rel>80. && (signalLeptons[0]->mom()+signalLeptons[1]->mom()).pT()>80. && dRll > 0.3 && dRll < 1.5 && mjj > 50. && mjj<100. && passJetPT && (numElectrons==0 && numMuons==2))_num_Zjets=_num_Zjets+0.75;
+          if(fabs(mll-91.)<10 && ETmiss_rel>80. && (signalLeptons[0]->mom()+signalLeptons[1]->mom()).pT()>80. && dRll > 0.3 && dRll < 1.5 && mjj > 50. && mjj<100. && passJetPT && (numElectrons==0 && numMuons==2))_num_Zjets.fill(0.75*event->weight());
 
         }
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "2 electrons ";
-        cutFlowVector_str[2] = "Lepton pT cuts (trigger) ";
-        cutFlowVector_str[3] = "mll cuts ";
-        cutFlowVector_str[4] = "OS leptons ";
-        cutFlowVector_str[5] = "tau veto ";
-        cutFlowVector_str[6] = "e+e-: Jet veto ";
-        cutFlowVector_str[7] = "e+e-: Z veto ";
-        cutFlowVector_str[8] = "e+e-: SR-MT290 ";
-        cutFlowVector_str[9] = "e+e-: SR-MT2120 ";
-        cutFlowVector_str[10] = "e+e-: SR-MT2150 ";
-        cutFlowVector_str[11] = "mu+mu-: 2 signal leptons ";
-        cutFlowVector_str[12] = "mu+mu-: Jet veto ";
-        cutFlowVector_str[13] = "mu+mu-: Z veto ";
-        cutFlowVector_str[14] = "mu+mu-: SR-MT290 ";
-        cutFlowVector_str[15] = "mu+mu-: SR-MT2120 ";
-        cutFlowVector_str[16] = "mu+mu-: SR-MT2150 ";
-        cutFlowVector_str[17] = "e+-mu-+: 2 signal leptons ";
-        cutFlowVector_str[18] = "e+-mu-+: Jet veto ";
-        cutFlowVector_str[19] = "e+-mu-+: Z veto ";
-        cutFlowVector_str[20] = "e+-mu-+: SR-MT290 ";
-        cutFlowVector_str[21] = "e+-mu-+: SR-MT2120 ";
-        cutFlowVector_str[22] = "e+-mu-+: SR-MT2150 ";
-        cutFlowVector_str[23] = "SRZjets e+e-: 2 signal leptons ";
-        cutFlowVector_str[24] = "SRZjets e+e-: >=2 light jets ";
-        cutFlowVector_str[25] = "SRZjets e+e-: No b and forward jets ";
-        cutFlowVector_str[26] = "SRZjets e+e-: Z window ";
-        cutFlowVector_str[27] = "SRZjets e+e-: pTll > 80 ";
-        cutFlowVector_str[28] = "SRZjets e+e-: ETmissrel ";
-        cutFlowVector_str[29] = "SRZjets e+e-: dRll ";
-        cutFlowVector_str[30] = "SRZjets e+e-: mjj ";
-        cutFlowVector_str[31] = "SRZjets e+e-: jet pT ";
-        cutFlowVector_str[32] = "SRZjets mu+mu-: 2 signal leptons ";
-        cutFlowVector_str[33] = "SRZjets mu+mu-: >=2 light jets ";
-        cutFlowVector_str[34] = "SRZjets mu+mu-: No b and forward jets ";
-        cutFlowVector_str[35] = "SRZjets mu+mu-: Z window ";
-        cutFlowVector_str[36] = "SRZjets mu+mu-: pTll > 80 ";
-        cutFlowVector_str[37] = "SRZjets mu+mu-: ETmissrel ";
-        cutFlowVector_str[38] = "SRZjets mu+mu-: dRll ";
-        cutFlowVector_str[39] = "SRZjets mu+mu-: mjj ";
-        cutFlowVector_str[40] = "SRZjets mu+mu-: jet pT ";
-        cutFlowVector_str[41] = "SRWWa e+e-: 2 leptons ";
-        cutFlowVector_str[42] = "SRWWa e+e-: Jet veto ";
-        cutFlowVector_str[43] = "SRWWa e+e-: Z veto ";
-        cutFlowVector_str[44] = "SRWWa e+e-: pTll ";
-        cutFlowVector_str[45] = "SRWWa e+e-: ETmissrel ";
-        cutFlowVector_str[46] = "SRWWa e+e-: mll ";
-        cutFlowVector_str[47] = "SRWWa mu+mu-: 2 leptons ";
-        cutFlowVector_str[48] = "SRWWa mu+mu-: Jet veto ";
-        cutFlowVector_str[49] = "SRWWa mu+mu-: Z veto ";
-        cutFlowVector_str[50] = "SRWWa mu+mu-: pTll ";
-        cutFlowVector_str[51] = "SRWWa mu+mu-: ETmissrel ";
-        cutFlowVector_str[52] = "SRWWa mu+mu-: mll ";
-        cutFlowVector_str[53] = "SRWWa e+mu-: 2 leptons ";
-        cutFlowVector_str[54] = "SRWWa e+mu-: Jet veto ";
-        cutFlowVector_str[55] = "SRWWa e+mu-: pTll ";
-        cutFlowVector_str[56] = "SRWWa e+mu-: ETmissrel ";
-        cutFlowVector_str[57] = "SRWWa e+mu-: mll ";
-        cutFlowVector_str[58] = "SRWWb e+e-: 2 leptons ";
-        cutFlowVector_str[59] = "SRWWb e+e-: Jet veto ";
-        cutFlowVector_str[60] = "SRWWb e+e-: Z veto ";
-        cutFlowVector_str[61] = "SRWWb e+e-: mT2 > 90 ";
-        cutFlowVector_str[62] = "SRWWb e+e-: mll < 170 ";
-        cutFlowVector_str[63] = "SRWWb mu+mu-: 2 leptons ";
-        cutFlowVector_str[64] = "SRWWb mu+mu-: Jet veto ";
-        cutFlowVector_str[65] = "SRWWb mu+mu-: Z veto ";
-        cutFlowVector_str[66] = "SRWWb mu+mu-: mT2 > 90 ";
-        cutFlowVector_str[67] = "SRWWb mu+mu-: mll < 170 ";
-        cutFlowVector_str[68] = "SRWWb e+mu-: 2 leptons ";
-        cutFlowVector_str[69] = "SRWWb e+mu-: Jet veto ";
-        cutFlowVector_str[70] = "SRWWb e+mu-: mT2 > 90 ";
-        cutFlowVector_str[71] = "SRWWb e+mu-: mll < 170 ";
-        cutFlowVector_str[72] = "SRWWc e+e-: 2 leptons ";
-        cutFlowVector_str[73] = "SRWWc e+e-: Jet veto ";
-        cutFlowVector_str[74] = "SRWWc e+e-: Z veto ";
-        cutFlowVector_str[75] = "SRWWc e+e-: mT2 > 100 ";
-        cutFlowVector_str[76] = "SRWWc mu+mu-: 2 leptons ";
-        cutFlowVector_str[77] = "SRWWc mu+mu-: Jet veto ";
-        cutFlowVector_str[78] = "SRWWc mu+mu-: Z veto ";
-        cutFlowVector_str[79] = "SRWWc mu+mu-: mT2 > 100 ";
-        cutFlowVector_str[80] = "SRWWc e+mu-: 2 leptons ";
-        cutFlowVector_str[81] = "SRWWc e+mu-: Jet veto ";
-        cutFlowVector_str[82] = "SRWWc e+mu-: mT2 > 100 ";
-
         for(int j=0;j<NCUTS;j++){
           if(j>=0 && j<=10)cutFlowIncrements[j]=0.97;
           if(j>=11 && j<=16)cutFlowIncrements[j]=0.75;
@@ -819,7 +809,7 @@ namespace Gambit {
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_ATLAS_2LEPEW_20invfb* specificOther
@@ -829,7 +819,6 @@ namespace Gambit {
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
           cutFlowIncrements[j] += specificOther->cutFlowIncrements[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
         _num_MT2_90_SF += specificOther->_num_MT2_90_SF;
         _num_MT2_90_DF += specificOther->_num_MT2_90_DF;
@@ -855,7 +844,8 @@ namespace Gambit {
         results_MT2_90_SF.n_background = 38.2;
         results_MT2_90_SF.background_sys = 5.1;
         results_MT2_90_SF.signal_sys = 0.;
-        results_MT2_90_SF.n_signal = _num_MT2_90_SF;
+        results_MT2_90_SF.n_signal = _num_MT2_90_SF.sumw;
+        results_MT2_90_SF.n_signal_sq = _num_MT2_90_SF.sumw2;
 
         SignalRegionData results_MT2_90_DF;
         results_MT2_90_DF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -864,7 +854,8 @@ namespace Gambit {
         results_MT2_90_DF.n_background = 23.3;
         results_MT2_90_DF.background_sys = 3.7;
         results_MT2_90_DF.signal_sys = 0.;
-        results_MT2_90_DF.n_signal = _num_MT2_90_DF;
+        results_MT2_90_DF.n_signal = _num_MT2_90_DF.sumw;
+        results_MT2_90_DF.n_signal_sq = _num_MT2_90_DF.sumw2;
 
         SignalRegionData results_MT2_120_SF;
         results_MT2_120_SF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -873,7 +864,8 @@ namespace Gambit {
         results_MT2_120_SF.n_background = 8.9;
         results_MT2_120_SF.background_sys = 2.1;
         results_MT2_120_SF.signal_sys = 0.;
-        results_MT2_120_SF.n_signal = _num_MT2_120_SF;
+        results_MT2_120_SF.n_signal = _num_MT2_120_SF.sumw;
+        results_MT2_120_SF.n_signal_sq = _num_MT2_120_SF.sumw2;
 
         SignalRegionData results_MT2_120_DF;
         results_MT2_120_DF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -882,7 +874,8 @@ namespace Gambit {
         results_MT2_120_DF.n_background = 3.6;
         results_MT2_120_DF.background_sys = 1.2;
         results_MT2_120_DF.signal_sys = 0.;
-        results_MT2_120_DF.n_signal = _num_MT2_120_DF;
+        results_MT2_120_DF.n_signal = _num_MT2_120_DF.sumw;
+        results_MT2_120_DF.n_signal_sq = _num_MT2_120_DF.sumw2;
 
         SignalRegionData results_MT2_150_SF;
         results_MT2_150_SF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -891,7 +884,8 @@ namespace Gambit {
         results_MT2_150_SF.n_background = 3.2;
         results_MT2_150_SF.background_sys = 0.7;
         results_MT2_150_SF.signal_sys = 0.;
-        results_MT2_150_SF.n_signal = _num_MT2_150_SF;
+        results_MT2_150_SF.n_signal = _num_MT2_150_SF.sumw;
+        results_MT2_150_SF.n_signal_sq = _num_MT2_150_SF.sumw2;
 
         SignalRegionData results_MT2_150_DF;
         results_MT2_150_DF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -900,7 +894,8 @@ namespace Gambit {
         results_MT2_150_DF.n_background = 1.0;
         results_MT2_150_DF.background_sys = 0.5;
         results_MT2_150_DF.signal_sys = 0.;
-        results_MT2_150_DF.n_signal = _num_MT2_150_DF;
+        results_MT2_150_DF.n_signal = _num_MT2_150_DF.sumw;
+        results_MT2_150_DF.n_signal_sq = _num_MT2_150_DF.sumw2;
 
         SignalRegionData results_WWa_SF;
         results_WWa_SF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -909,7 +904,8 @@ namespace Gambit {
         results_WWa_SF.n_background = 86.5;
         results_WWa_SF.background_sys = 7.4;
         results_WWa_SF.signal_sys = 0.;
-        results_WWa_SF.n_signal = _num_WWa_SF;
+        results_WWa_SF.n_signal = _num_WWa_SF.sumw;
+        results_WWa_SF.n_signal_sq = _num_WWa_SF.sumw2;
 
         SignalRegionData results_WWa_DF;
         results_WWa_DF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -918,7 +914,8 @@ namespace Gambit {
         results_WWa_DF.n_background = 73.6;
         results_WWa_DF.background_sys = 7.9;
         results_WWa_DF.signal_sys = 0.;
-        results_WWa_DF.n_signal = _num_WWa_DF;
+        results_WWa_DF.n_signal = _num_WWa_DF.sumw;
+        results_WWa_DF.n_signal_sq = _num_WWa_DF.sumw2;
 
         SignalRegionData results_WWb_SF;
         results_WWb_SF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -927,7 +924,8 @@ namespace Gambit {
         results_WWb_SF.n_background = 30.2;
         results_WWb_SF.background_sys = 3.5;
         results_WWb_SF.signal_sys = 0.;
-        results_WWb_SF.n_signal = _num_WWb_SF;
+        results_WWb_SF.n_signal = _num_WWb_SF.sumw;
+        results_WWb_SF.n_signal_sq = _num_WWb_SF.sumw2;
 
         SignalRegionData results_WWb_DF;
         results_WWb_DF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -936,7 +934,8 @@ namespace Gambit {
         results_WWb_DF.n_background = 18.1;
         results_WWb_DF.background_sys = 2.6;
         results_WWb_DF.signal_sys = 0.;
-        results_WWb_DF.n_signal = _num_WWb_DF;
+        results_WWb_DF.n_signal = _num_WWb_DF.sumw;
+        results_WWb_DF.n_signal_sq = _num_WWb_DF.sumw2;
 
         SignalRegionData results_WWc_SF;
         results_WWc_SF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -945,7 +944,8 @@ namespace Gambit {
         results_WWc_SF.n_background = 20.3;
         results_WWc_SF.background_sys = 3.5;
         results_WWc_SF.signal_sys = 0.;
-        results_WWc_SF.n_signal = _num_WWc_SF;
+        results_WWc_SF.n_signal = _num_WWc_SF.sumw;
+        results_WWc_SF.n_signal_sq = _num_WWc_SF.sumw2;
 
         SignalRegionData results_WWc_DF;
         results_WWc_DF.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -954,7 +954,8 @@ namespace Gambit {
         results_WWc_DF.n_background = 9.0;
         results_WWc_DF.background_sys = 2.2;
         results_WWc_DF.signal_sys = 0.;
-        results_WWc_DF.n_signal = _num_WWc_DF;
+        results_WWc_DF.n_signal = _num_WWc_DF.sumw;
+        results_WWc_DF.n_signal_sq = _num_WWc_DF.sumw2;
 
         SignalRegionData results_Zjets;
         results_Zjets.analysis_name = "Analysis_ATLAS_2LEPEW_20invfb";
@@ -963,7 +964,8 @@ namespace Gambit {
         results_Zjets.n_background = 1.4;
         results_Zjets.background_sys = 0.6;
         results_Zjets.signal_sys = 0.;
-        results_Zjets.n_signal = _num_Zjets;
+        results_Zjets.n_signal = _num_Zjets.sumw;
+        results_Zjets.n_signal_sq = _num_Zjets.sumw2;
 
         add_result(results_MT2_90_SF);
         add_result(results_MT2_90_DF);
@@ -38,7 +38,7 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      int _numSRM90SF, _numSRM100SF, _numSRM110SF, _numSRM120SF,
+      WeightedCount _numSRM90SF, _numSRM100SF, _numSRM110SF, _numSRM120SF,
           _numSRM90DF, _numSRM100DF, _numSRM110DF, _numSRM120DF;
 
       vector<int> cutFlowVector;
@@ -50,8 +50,8 @@ namespace Gambit {
     public:
 
       Analysis_ATLAS_2LEPStop_20invfb()
-        : _numSRM90SF(0), _numSRM100SF(0), _numSRM110SF(0), _numSRM120SF(0),
-          _numSRM90DF(0), _numSRM100DF(0), _numSRM110DF(0), _numSRM120DF(0),
+        : _numSRM90SF(), _numSRM100SF(), _numSRM110SF(), _numSRM120SF(),
+          _numSRM90DF(), _numSRM100DF(), _numSRM110DF(), _numSRM120DF(),
           NCUTS(24)
       {
         set_luminosity(20.3);
@@ -59,6 +59,30 @@ namespace Gambit {
           cutFlowVector.push_back(0);
           cutFlowVector_str.push_back("");
         }
+
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "2 Baseline Leptons ";
+        cutFlowVector_str[2] = "2 SF Signal Leptons";
+        cutFlowVector_str[3] = "2 OS SF Signal Leptons ";
+        cutFlowVector_str[4] = "mll > 20 GeV ";
+        cutFlowVector_str[5] = "leading lepton pT ";
+        cutFlowVector_str[6] = "|mll-mZ|>20 GeV ";
+        cutFlowVector_str[7] = "dphi_min > 1.0 ";
+        cutFlowVector_str[8] = "dphib < 1.5  ";
+        cutFlowVector_str[9] = "SR M90 [SF] ";
+        cutFlowVector_str[10] = "SR M120 [SF] ";
+        cutFlowVector_str[11] = "SR M100 + 2 jets [SF] ";
+        cutFlowVector_str[12] = "SR M110 + 2 jets [SF] ";
+        cutFlowVector_str[13] = "2 DF Signal Leptons";
+        cutFlowVector_str[14] = "2 OS DF Signal Leptons ";
+        cutFlowVector_str[15] = "mll > 20 GeV ";
+        cutFlowVector_str[16] = "leading lepton pT ";
+        cutFlowVector_str[17] = "dphi_min > 1.0 ";
+        cutFlowVector_str[18] = "dphib < 1.5  ";
+        cutFlowVector_str[19] = "SR M90 [DF] ";
+        cutFlowVector_str[20] = "SR M120 [DF] ";
+        cutFlowVector_str[21] = "SR M100 + 2 jets[DF] ";
+        cutFlowVector_str[22] = "SR M110 + 2 jets[DF] ";
       }
 
       void analyze(const HEPUtils::Event* event) {
@@ -69,27 +93,14 @@ namespace Gambit {
         //double met = event->met();
 
         // Now define vectors of baseline objects
-        vector<HEPUtils::Particle*> baselineElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && electron->abseta() < 2.47) baselineElectrons.push_back(electron);
-        }
-        vector<HEPUtils::Particle*> baselineMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && muon->abseta() < 2.4) baselineMuons.push_back(muon);
-        }
-        vector<HEPUtils::Particle*> baselineTaus;
-        for (HEPUtils::Particle* tau : event->taus()) {
-          if (tau->pT() > 10. && tau->abseta() < 2.47) baselineTaus.push_back(tau);
-        }
+        vector<HEPUtils::Particle*> baselineElectrons = preselection().electrons(10., 2.47);
+        vector<HEPUtils::Particle*> baselineMuons = preselection().muons(10., 2.4);
+        vector<HEPUtils::Particle*> baselineTaus = preselection().taus(10., 2.47);
         ATLAS::applyTauEfficiencyR1(baselineTaus);
 
-        vector<HEPUtils::Jet*> baselineJets;
-        vector<HEPUtils::Jet*> bJets;
+        vector<HEPUtils::Jet*> baselineJets = preselection().jets(20., 2.5);
+        vector<HEPUtils::Jet*> bJets = preselection().bjets(20., 2.5);
         vector<HEPUtils::Jet*> trueBJets; //for debugging
-        for (HEPUtils::Jet* jet : event->jets()) {
-          if (jet->pT() > 20. && fabs(jet->eta()) < 2.5) baselineJets.push_back(jet);
-          if(jet->btag() && fabs(jet->eta()) < 2.5 && jet->pT() > 20.) bJets.push_back(jet);
-        }
 
         // Overlap removal
         vector<HEPUtils::Particle*> signalLeptons;
@@ -255,30 +266,6 @@ namespace Gambit {
 
         if(passJetCut)cut_2jets=true;
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "2 Baseline Leptons ";
-        cutFlowVector_str[2] = "2 SF Signal Leptons";
-        cutFlowVector_str[3] = "2 OS SF Signal Leptons ";
-        cutFlowVector_str[4] = "mll > 20 GeV ";
-        cutFlowVector_str[5] = "leading lepton pT ";
-        cutFlowVector_str[6] = "|mll-mZ|>20 GeV ";
-        cutFlowVector_str[7] = "dphi_min > 1.0 ";
-        cutFlowVector_str[8] = "dphib < 1.5  ";
-        cutFlowVector_str[9] = "SR M90 [SF] ";
-        cutFlowVector_str[10] = "SR M120 [SF] ";
-        cutFlowVector_str[11] = "SR M100 + 2 jets [SF] ";
-        cutFlowVector_str[12] = "SR M110 + 2 jets [SF] ";
-        cutFlowVector_str[13] = "2 DF Signal Leptons";
-        cutFlowVector_str[14] = "2 OS DF Signal Leptons ";
-        cutFlowVector_str[15] = "mll > 20 GeV ";
-        cutFlowVector_str[16] = "leading lepton pT ";
-        cutFlowVector_str[17] = "dphi_min > 1.0 ";
-        cutFlowVector_str[18] = "dphib < 1.5  ";
-        cutFlowVector_str[19] = "SR M90 [DF] ";
-        cutFlowVector_str[20] = "SR M120 [DF] ";
-        cutFlowVector_str[21] = "SR M100 + 2 jets[DF] ";
-        cutFlowVector_str[22] = "SR M110 + 2 jets[DF] ";
-
         for(int j=0;j<NCUTS;j++){
           if(
              (j==0) ||
@@ -333,22 +320,22 @@ namespace Gambit {
         //We're now ready to apply the cuts for each signal region
         //_numSR1, _numSR2, _numSR3;
 
-        if(cut_2leptons && (cut_2leptons_ee || cut_2leptons_mumu) && isOS && isMLL && ispT && isZsafe && isdphi && isdphib && cut_MT290) _numSRM90SF++;
-        if(cut_2leptons_base && cut_2leptons && (cut_2leptons_ee || cut_2leptons_mumu) && isOS && isMLL && ispT && isZsafe && isdphi && isdphib && cut_MT2100 && cut_2jets) _numSRM100SF++;
-        if(cut_2leptons_base && cut_2leptons && (cut_2leptons_ee || cut_2leptons_mumu) && isOS && isMLL && ispT && isZsafe && isdphi && isdphib && cut_MT2110 && nJets>=2) _numSRM110SF++;
-        if(cut_2leptons_base && cut_2leptons && (cut_2leptons_ee || cut_2leptons_mumu) && isOS && isMLL && ispT && isZsafe && isdphi && isdphib && cut_MT2120) _numSRM120SF++;
+        if(cut_2leptons && (cut_2leptons_ee || cut_2leptons_mumu) && isOS && isMLL && ispT && isZsafe && isdphi && isdphib && cut_MT290) _numSRM90SF.fill(event->weight());
+        if(cut_2leptons_base && cut_2leptons && (cut_2leptons_ee || cut_2leptons_mumu) && isOS && isMLL && ispT && isZsafe && isdphi && isdphib && cut_MT2100 && cut_2jets) _numSRM100SF.fill(event->weight());
+        if(cut_2leptons_base && cut_2leptons && (cut_2leptons_ee || cut_2leptons_mumu) && isOS && isMLL && ispT && isZsafe && isdphi && isdphib && cut_MT2110 && nJets>=2) _numSRM110SF.fill(event->weight());
+        if(cut_2leptons_base && cut_2leptons && (cut_2leptons_ee || cut_2leptons_mumu) && isOS && isMLL && ispT && isZsafe && isdphi && isdphib && cut_MT2120) _numSRM120SF.fill(event->weight());
 
-        if(cut_2leptons && cut_2leptons_emu && isOS && isMLL && ispT && isdphi && isdphib && cut_MT290) _numSRM90DF++;
-        if(cut_2leptons_base && cut_2leptons && cut_2leptons_emu && isOS && isMLL && ispT && isdphi && isdphib && cut_MT2100 && cut_2jets) _numSRM100DF++;
-        if(cut_2leptons_base && cut_2leptons && cut_2leptons_emu && isOS && isMLL && ispT && isdphi && isdphib && cut_MT2110 && nJets>=2) _numSRM110DF++;
-        if(cut_2leptons_base && cut_2leptons && cut_2leptons_emu && isOS && isMLL && ispT && isdphi && isdphib && cut_MT2120) _numSRM120DF++;
+        if(cut_2leptons && cut_2leptons_emu && isOS && isMLL && ispT && isdphi && isdphib && cut_MT290) _numSRM90DF.fill(event->weight());
+        if(cut_2leptons_base && cut_2leptons && cut_2leptons_emu && isOS && isMLL && ispT && isdphi && isdphib && cut_MT2100 && cut_2jets) _numSRM100DF.fill(event->weight());
+        if(cut_2leptons_base && cut_2leptons && cut_2leptons_emu && isOS && isMLL && ispT && isdphi && isdphib && cut_MT2110 && nJets>=2) _numSRM110DF.fill(event->weight());
+        if(cut_2leptons_base && cut_2leptons && cut_2leptons_emu && isOS && isMLL && ispT && isdphi && isdphib && cut_MT2120) _numSRM120DF.fill(event->weight());
 
         return;
       }
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_ATLAS_2LEPStop_20invfb* specificOther
@@ -358,7 +345,6 @@ namespace Gambit {
         if (NCUTS != specificOther->NCUTS) NCUTS = specificOther->NCUTS;
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
          _numSRM90SF +=  specificOther->_numSRM90SF;
         _numSRM100SF += specificOther->_numSRM100SF;
@@ -379,7 +365,8 @@ namespace Gambit {
         results_SRM90.n_background = 300.;
         results_SRM90.background_sys = 50.;
         results_SRM90.signal_sys = 0.;
-        results_SRM90.n_signal = _numSRM90SF+_numSRM90DF;
+        results_SRM90.n_signal = _numSRM90SF.sumw + _numSRM90DF.sumw;
+        results_SRM90.n_signal_sq = _numSRM90SF.sumw2 + _numSRM90DF.sumw2;
 
         SignalRegionData results_SRM100;
         results_SRM100.analysis_name = "Analysis_ATLAS_2LEPStop_20invfb";
@@ -388,7 +375,8 @@ namespace Gambit {
         results_SRM100.n_background = 5.2;
         results_SRM100.background_sys = 2.2;
         results_SRM100.signal_sys = 0.;
-        results_SRM100.n_signal = _numSRM100SF+_numSRM100DF;
+        results_SRM100.n_signal = _numSRM100SF.sumw + _numSRM100DF.sumw;
+        results_SRM100.n_signal_sq = _numSRM100SF.sumw2 + _numSRM100DF.sumw2;
 
         SignalRegionData results_SRM110;
         results_SRM110.analysis_name = "Analysis_ATLAS_2LEPStop_20invfb";
@@ -397,7 +385,8 @@ namespace Gambit {
         results_SRM110.n_background = 9.3;
         results_SRM110.background_sys = 3.5;
         results_SRM110.signal_sys = 0.;
-        results_SRM110.n_signal = _numSRM110SF+_numSRM110DF;
+        results_SRM110.n_signal = _numSRM110SF.sumw + _numSRM110DF.sumw;
+        results_SRM110.n_signal_sq = _numSRM110SF.sumw2 + _numSRM110DF.sumw2;
 
         SignalRegionData results_SRM120;
         results_SRM120.analysis_name = "Analysis_ATLAS_2LEPStop_20invfb";
@@ -406,7 +395,8 @@ namespace Gambit {
         results_SRM120.n_background = 19.;
         results_SRM120.background_sys = 9.;
         results_SRM120.signal_sys = 0.;
-        results_SRM120.n_signal = _numSRM120SF+_numSRM120DF;
+        results_SRM120.n_signal = _numSRM120SF.sumw + _numSRM120DF.sumw;
+        results_SRM120.n_signal_sq = _numSRM120SF.sumw2 + _numSRM120DF.sumw2;
 
         add_result(results_SRM90);
         add_result(results_SRM100);
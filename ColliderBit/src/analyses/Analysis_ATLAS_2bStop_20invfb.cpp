@@ -29,8 +29,8 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      int _numSRA, _numSRB;
-      int _numSRA15, _numSRA20, _numSRA25, _numSRA30, _numSRA35;
+      WeightedCount _numSRA, _numSRB;
+      WeightedCount _numSRA15, _numSRA20, _numSRA25, _numSRA30, _numSRA35;
 
       vector<int> cutFlowVector;
       vector<string> cutFlowVector_str;
@@ -42,7 +42,7 @@ namespace Gambit {
 
       Analysis_ATLAS_2bStop_20invfb() {
 
-        _numSRA = 0 ; _numSRB = 0; _numSRA15 = 0; _numSRA20 = 0; _numSRA25 = 0; _numSRA30 = 0; _numSRA35 = 0;
+        _numSRA = WeightedCount(); _numSRB = WeightedCount(); _numSRA15 = WeightedCount(); _numSRA20 = WeightedCount(); _numSRA25 = WeightedCount(); _numSRA30 = WeightedCount(); _numSRA35 = WeightedCount();
         NCUTS=30;
         set_luminosity(20.1);
 
@@ -51,6 +51,23 @@ namespace Gambit {
           cutFlowVector_str.push_back("");
         }
 
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "MET > 80 ";
+        cutFlowVector_str[2] = "Lepton veto ";
+        cutFlowVector_str[3] = "MET > 150 ";
+        cutFlowVector_str[4] = "Jet selection ";
+        cutFlowVector_str[5] = "mbb > 200 ";
+        cutFlowVector_str[6] = "mCT > 150 ";
+        cutFlowVector_str[7] = "mCT > 200 ";
+        cutFlowVector_str[8] = "mCT > 250 ";
+        cutFlowVector_str[9] = "mCT > 300 ";
+        cutFlowVector_str[10] = "SRB: lepton veto ";
+        cutFlowVector_str[11] = "SRB: MET > 250 ";
+        cutFlowVector_str[12] = "SRB: Jet selection ";
+        cutFlowVector_str[13] = "SRB: HT3 < 50  ";
+        cutFlowVector_str[14] = "SRA: Jet selection  ";
+        cutFlowVector_str[15] = "SRA: B jet selection  ";
+
       }
 
       void analyze(const HEPUtils::Event* event) {
@@ -61,28 +78,18 @@ namespace Gambit {
         double met = event->met();
 
         // Now define vectors of baseline objects
-        vector<HEPUtils::Particle*> baselineElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 7. && fabs(electron->eta()) < 2.47) baselineElectrons.push_back(electron);
-        }
-        vector<HEPUtils::Particle*> baselineMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 6. && fabs(muon->eta()) < 2.4) baselineMuons.push_back(muon);
-        }
+        vector<HEPUtils::Particle*> baselineElectrons = preselection().electrons(7., 2.47);
+        vector<HEPUtils::Particle*> baselineMuons = preselection().muons(6., 2.4);
 
         const std::vector<double>  a = {0,10.};
         const std::vector<double>  b = {0,10000.};
         const std::vector<double> c = {0.60};
         HEPUtils::BinnedFn2D<double> _eff2d(a,b,c);
 
-        vector<HEPUtils::Jet*> baselineJets;
+        vector<HEPUtils::Jet*> baselineJets = preselection().jets(20., 4.9);
         vector<HEPUtils::Jet*> bJets;
         vector<HEPUtils::Jet*> trueBJets; //for debugging
 
-        for (HEPUtils::Jet* jet : event->jets()) {
-          if (jet->pT() > 20. && fabs(jet->eta()) < 4.9) baselineJets.push_back(jet);
-        }
-
         // Overlap removal
         vector<HEPUtils::Particle*> signalElectrons;
         vector<HEPUtils::Particle*> signalMuons;
@@ -290,23 +297,6 @@ namespace Gambit {
         if(met/meff2>0.25)cut_METmeff2=true;
         if(met/meff3>0.25)cut_METmeff3=true;
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "MET > 80 ";
-        cutFlowVector_str[2] = "Lepton veto ";
-        cutFlowVector_str[3] = "MET > 150 ";
-        cutFlowVector_str[4] = "Jet selection ";
-        cutFlowVector_str[5] = "mbb > 200 ";
-        cutFlowVector_str[6] = "mCT > 150 ";
-        cutFlowVector_str[7] = "mCT > 200 ";
-        cutFlowVector_str[8] = "mCT > 250 ";
-        cutFlowVector_str[9] = "mCT > 300 ";
-        cutFlowVector_str[10] = "SRB: lepton veto ";
-        cutFlowVector_str[11] = "SRB: MET > 250 ";
-        cutFlowVector_str[12] = "SRB: Jet selection ";
-        cutFlowVector_str[13] = "SRB: HT3 < 50  ";
-        cutFlowVector_str[14] = "SRA: Jet selection  ";
-        cutFlowVector_str[15] = "SRA: B jet selection  ";
-
 
         for(int j=0;j<NCUTS;j++){
           if(
@@ -350,14 +340,14 @@ namespace Gambit {
         //_numSRA, _numSRB, _numSRA15, _numSRA20, _numSRA25, _numSRA30, _numSRA35;
 
         if(cut_ElectronVeto && cut_MuonVeto && cut_METGt150 && passSRAJetCut && passSRAbJetCut && cut_dPhiJets && cut_METmeff2 && mbb>200.) {
-          _numSRA++;
-          if(mCT>150.) _numSRA15++;
-          if(mCT>200.) _numSRA20++;
-          if(mCT>250.) _numSRA25++;
-          if(mCT>300.) _numSRA30++;
-          if(mCT>350.) _numSRA35++;
+          _numSRA.fill(event->weight());
+          if(mCT>150.) _numSRA15.fill(event->weight());
+          if(mCT>200.) _numSRA20.fill(event->weight());
+          if(mCT>250.) _numSRA25.fill(event->weight());
+          if(mCT>300.) _numSRA30.fill(event->weight());
+          if(mCT>350.) _numSRA35.fill(event->weight());
         }
-        if(cut_ElectronVeto && cut_MuonVeto && cut_METGt250 && passSRBJetCut && passSRBbJetCut && cut_dPhiJets && cut_METmeff3 && ht3<50.) _numSRB ++;
+        if(cut_ElectronVeto && cut_MuonVeto && cut_METGt250 && passSRBJetCut && passSRBbJetCut && cut_dPhiJets && cut_METmeff3 && ht3<50.) _numSRB.fill(event->weight());
 
 
         return;
@@ -366,7 +356,7 @@ namespace Gambit {
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events. 
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_ATLAS_2bStop_20invfb* specificOther
@@ -376,7 +366,6 @@ namespace Gambit {
         if (NCUTS != specificOther->NCUTS) NCUTS = specificOther->NCUTS;
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
         _numSRA += specificOther->_numSRA;
         _numSRB += specificOther->_numSRB;
@@ -396,7 +385,8 @@ namespace Gambit {
         results_SRA15.n_background = 94.;
         results_SRA15.background_sys = 13.;
         results_SRA15.signal_sys = 0.;
-        results_SRA15.n_signal = _numSRA15;
+        results_SRA15.n_signal = _numSRA15.sumw;
+        results_SRA15.n_signal_sq = _numSRA15.sumw2;
 
         SignalRegionData results_SRA20;
         results_SRA20.analysis_name = "Analysis_ATLAS_2bStop_20invfb";
@@ -405,7 +395,8 @@ namespace Gambit {
         results_SRA20.n_background = 39.;
         results_SRA20.background_sys = 6.;
         results_SRA20.signal_sys = 0.;
-        results_SRA20.n_signal = _numSRA20;
+        results_SRA20.n_signal = _numSRA20.sumw;
+        results_SRA20.n_signal_sq = _numSRA20.sumw2;
 
         SignalRegionData results_SRA25;
         results_SRA25.analysis_name = "Analysis_ATLAS_2bStop_20invfb";
@@ -414,7 +405,8 @@ namespace Gambit {
         results_SRA25.n_background = 15.8;
         results_SRA25.background_sys = 2.8;
         results_SRA25.signal_sys = 0.;
-        results_SRA25.n_signal = _numSRA25;
+        results_SRA25.n_signal = _numSRA25.sumw;
+        results_SRA25.n_signal_sq = _numSRA25.sumw2;
 
         SignalRegionData results_SRA30;
         results_SRA30.analysis_name = "Analysis_ATLAS_2bStop_20invfb";
@@ -423,7 +415,8 @@ namespace Gambit {
         results_SRA30.n_background = 5.9;
         results_SRA30.background_sys = 1.1;
         results_SRA30.signal_sys = 0.;
-        results_SRA30.n_signal = _numSRA30;
+        results_SRA30.n_signal = _numSRA30.sumw;
+        results_SRA30.n_signal_sq = _numSRA30.sumw2;
 
         SignalRegionData results_SRA35;
         results_SRA35.analysis_name = "Analysis_ATLAS_2bStop_20invfb";
@@ -432,7 +425,8 @@ namespace Gambit {
         results_SRA35.n_background = 2.5;
         results_SRA35.background_sys = 0.6;
         results_SRA35.signal_sys = 0.;
-        results_SRA35.n_signal = _numSRA35;
+        results_SRA35.n_signal = _numSRA35.sumw;
+        results_SRA35.n_signal_sq = _numSRA35.sumw2;
 
         SignalRegionData results_SRB;
         results_SRB.analysis_name = "Analysis_ATLAS_2bStop_20invfb";
@@ -441,7 +435,8 @@ namespace Gambit {
         results_SRB.n_background = 64.;
         results_SRB.background_sys = 10.;
         results_SRB.signal_sys = 0.;
-        results_SRB.n_signal = _numSRB;
+        results_SRB.n_signal = _numSRB.sumw;
+        results_SRB.n_signal_sq = _numSRB.sumw2;
 
         add_result(results_SRA15);
         add_result(results_SRA20);
@@ -32,15 +32,15 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      int _num_SR0tau_a_bin_1, _num_SR0tau_a_bin_2, _num_SR0tau_a_bin_3, _num_SR0tau_a_bin_4;
-      int _num_SR0tau_a_bin_5, _num_SR0tau_a_bin_6, _num_SR0tau_a_bin_7, _num_SR0tau_a_bin_8;
-      int _num_SR0tau_a_bin_9, _num_SR0tau_a_bin_10, _num_SR0tau_a_bin_11, _num_SR0tau_a_bin_12;
-      int _num_SR0tau_a_bin_13, _num_SR0tau_a_bin_14, _num_SR0tau_a_bin_15, _num_SR0tau_a_bin_16;
-      int _num_SR0tau_a_bin_17, _num_SR0tau_a_bin_18, _num_SR0tau_a_bin_19, _num_SR0tau_a_bin_20;
-      int _num_SR0tau_b;
-      int _num_SR1tau;
-      int _num_SR2tau_a;
-      int _num_SR2tau_b;
+      WeightedCount _num_SR0tau_a_bin_1, _num_SR0tau_a_bin_2, _num_SR0tau_a_bin_3, _num_SR0tau_a_bin_4;
+      WeightedCount _num_SR0tau_a_bin_5, _num_SR0tau_a_bin_6, _num_SR0tau_a_bin_7, _num_SR0tau_a_bin_8;
+      WeightedCount _num_SR0tau_a_bin_9, _num_SR0tau_a_bin_10, _num_SR0tau_a_bin_11, _num_SR0tau_a_bin_12;
+      WeightedCount _num_SR0tau_a_bin_13, _num_SR0tau_a_bin_14, _num_SR0tau_a_bin_15, _num_SR0tau_a_bin_16;
+      WeightedCount _num_SR0tau_a_bin_17, _num_SR0tau_a_bin_18, _num_SR0tau_a_bin_19, _num_SR0tau_a_bin_20;
+      WeightedCount _num_SR0tau_b;
+      WeightedCount _num_SR1tau;
+      WeightedCount _num_SR2tau_a;
+      WeightedCount _num_SR2tau_b;
       vector<int> cutFlowVector;
       vector<string> cutFlowVector_str;
       const static int NCUTS=55;
@@ -49,30 +49,30 @@ namespace Gambit {
 
       Analysis_ATLAS_3LEPEW_20invfb() {
 
-        _num_SR0tau_a_bin_1=0;
-        _num_SR0tau_a_bin_2=0;
-        _num_SR0tau_a_bin_3=0;
-        _num_SR0tau_a_bin_4=0;
-        _num_SR0tau_a_bin_5=0;
-        _num_SR0tau_a_bin_6=0;
-        _num_SR0tau_a_bin_7=0;
-        _num_SR0tau_a_bin_8=0;
-        _num_SR0tau_a_bin_9=0;
-        _num_SR0tau_a_bin_10=0;
-        _num_SR0tau_a_bin_11=0;
-        _num_SR0tau_a_bin_12=0;
-        _num_SR0tau_a_bin_13=0;
-        _num_SR0tau_a_bin_14=0;
-        _num_SR0tau_a_bin_15=0;
-        _num_SR0tau_a_bin_16=0;
-        _num_SR0tau_a_bin_17=0;
-        _num_SR0tau_a_bin_18=0;
-        _num_SR0tau_a_bin_19=0;
-        _num_SR0tau_a_bin_20=0;
-        _num_SR0tau_b=0;
-        _num_SR1tau=0;
-        _num_SR2tau_a=0;
-        _num_SR2tau_b=0;
+        _num_SR0tau_a_bin_1 = WeightedCount();
+        _num_SR0tau_a_bin_2 = WeightedCount();
+        _num_SR0tau_a_bin_3 = WeightedCount();
+        _num_SR0tau_a_bin_4 = WeightedCount();
+        _num_SR0tau_a_bin_5 = WeightedCount();
+        _num_SR0tau_a_bin_6 = WeightedCount();
+        _num_SR0tau_a_bin_7 = WeightedCount();
+        _num_SR0tau_a_bin_8 = WeightedCount();
+        _num_SR0tau_a_bin_9 = WeightedCount();
+        _num_SR0tau_a_bin_10 = WeightedCount();
+        _num_SR0tau_a_bin_11 = WeightedCount();
+        _num_SR0tau_a_bin_12 = WeightedCount();
+        _num_SR0tau_a_bin_13 = WeightedCount();
+        _num_SR0tau_a_bin_14 = WeightedCount();
+        _num_SR0tau_a_bin_15 = WeightedCount();
+        _num_SR0tau_a_bin_16 = WeightedCount();
+        _num_SR0tau_a_bin_17 = WeightedCount();
+        _num_SR0tau_a_bin_18 = WeightedCount();
+        _num_SR0tau_a_bin_19 = WeightedCount();
+        _num_SR0tau_a_bin_20 = WeightedCount();
+        _num_SR0tau_b = WeightedCount();
+        _num_SR1tau = WeightedCount();
+        _num_SR2tau_a = WeightedCount();
+        _num_SR2tau_b = WeightedCount();
         set_luminosity(20.3);
 
         for(int i=0;i<NCUTS;i++){
@@ -80,6 +80,58 @@ namespace Gambit {
           cutFlowVector_str.push_back("");
         }
 
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "3 signal leptons ";
+        cutFlowVector_str[2] = "Trigger ";
+        cutFlowVector_str[3] = "At least one e or mu ";
+        cutFlowVector_str[4] = "Separation of leptons ";
+        cutFlowVector_str[5] = "mSFOS > 12 cut ";
+        cutFlowVector_str[6] = "Lepton requirement (no taus) ";
+        cutFlowVector_str[7] = "SFOS ";
+        cutFlowVector_str[8] = "b-tagged jet veto ";
+        cutFlowVector_str[9] = "ETmiss ";
+        cutFlowVector_str[10] = "mT ";
+        cutFlowVector_str[11] = "SR0tau_a_bin_1 ";
+        cutFlowVector_str[12] = "SR0tau_a_bin_2 ";
+        cutFlowVector_str[13] = "SR0tau_a_bin_3 ";
+        cutFlowVector_str[14] = "SR0tau_a_bin_4 ";
+        cutFlowVector_str[15] = "SR0tau_a_bin_5 ";
+        cutFlowVector_str[16] = "SR0tau_a_bin_6 ";
+        cutFlowVector_str[17] = "SR0tau_a_bin_7 ";
+        cutFlowVector_str[18] = "SR0tau_a_bin_8 ";
+        cutFlowVector_str[19] = "SR0tau_a_bin_9 ";
+        cutFlowVector_str[20] = "SR0tau_a_bin_10 ";
+        cutFlowVector_str[21] = "SR0tau_a_bin_11 ";
+        cutFlowVector_str[22] = "SR0tau_a_bin_12 ";
+        cutFlowVector_str[23] = "SR0tau_a_bin_13 ";
+        cutFlowVector_str[24] = "SR0tau_a_bin_14 ";
+        cutFlowVector_str[25] = "SR0tau_a_bin_15 ";
+        cutFlowVector_str[26] = "SR0tau_a_bin_16 ";
+        cutFlowVector_str[27] = "SR0tau_a_bin_17 ";
+        cutFlowVector_str[28] = "SR0tau_a_bin_18 ";
+        cutFlowVector_str[29] = "SR0tau_a_bin_19 ";
+        cutFlowVector_str[30] = "SR0tau_a_bin_20 ";
+        cutFlowVector_str[31] = "SR0taub: Lepton multiplicity ";
+        cutFlowVector_str[32] = "SR0taub: b veto ";
+        cutFlowVector_str[33] = "SR0taub: met ";
+        cutFlowVector_str[34] = "SR0taub: pT 3rd lepton ";
+        cutFlowVector_str[35] = "SR0taub: dPhiLL ";
+        cutFlowVector_str[36] = "SR1tau: Lepton multiplicity ";
+        cutFlowVector_str[37] = "SR1tau: Z veto ";
+        cutFlowVector_str[38] = "SR1tau: b-tagged veto ";
+        cutFlowVector_str[39] = "SR1tau: MET ";
+        cutFlowVector_str[40] = "SR1tau: Lepton pT cuts ";
+        cutFlowVector_str[41] = "SR1tau: mltau ";
+        cutFlowVector_str[42] = "SR2taua: Lepton multiplicity ";
+        cutFlowVector_str[43] = "SR2taua: b veto ";
+        cutFlowVector_str[44] = "SR2taua: MET ";
+        cutFlowVector_str[45] = "SR2taua: MT2max ";
+        cutFlowVector_str[46] = "SR2taub: Lepton multiplicity ";
+        cutFlowVector_str[47] = "SR2taub: b jet veto ";
+        cutFlowVector_str[48] = "SR2taub: met ";
+        cutFlowVector_str[49] = "SR2taub: mtautau ";
+        cutFlowVector_str[50] = "SR2taub: Sum of tau pT ";
+
       }
 
       void EleEleOverlapRemoval(vector<HEPUtils::Particle*> &vec1, vector<HEPUtils::Particle*> &vec2, double DeltaRMax) {
@@ -191,23 +243,12 @@ namespace Gambit {
         double met = event->met();
 
         // Now define vectors of baseline objects
-        vector<HEPUtils::Particle*> signalElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.47) signalElectrons.push_back(electron);
-        }
-        vector<HEPUtils::Particle*> signalMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.4) signalMuons.push_back(muon);
-        }
+        vector<HEPUtils::Particle*> signalElectrons = preselection().electrons(10., 2.47);
+        vector<HEPUtils::Particle*> signalMuons = preselection().muons(10., 2.4);
 
-        vector<HEPUtils::Jet*> signalJets;
+        vector<HEPUtils::Jet*> signalJets = preselection().jets(20., 2.5);
         vector<HEPUtils::Jet*> bJets;
 
-        for (HEPUtils::Jet* jet : event->jets()) {
-          if (jet->pT() > 20. && fabs(jet->eta()) < 2.5) signalJets.push_back(jet);
-          //if(jet->btag() && fabs(jet->eta()) < 2.5 && jet->pT() > 20.) bJets.push_back(jet);
-        }
-
         vector<HEPUtils::Particle*> signalTaus;
         for (HEPUtils::Particle* tau : event->taus()) {
           if (tau->pT() > 20. && fabs(tau->eta()) < 2.47) signalTaus.push_back(tau);
@@ -454,30 +495,30 @@ namespace Gambit {
 
         if(trigger && signalLeptons.size()==3 && mSFOS12Cut && atLeastOneEorMu && separationCut && bJets.size()==0 && signalTaus.size()==0){
 
-          if(mSFOS>12. && mSFOS < 40. && mT>0. && mT<80. && met>50. && met<90.)_num_SR0tau_a_bin_1++;
-          if(mSFOS>12. && mSFOS < 40. && mT>0. && mT<80. && met>90.)_num_SR0tau_a_bin_2++;
-          if(mSFOS>12. && mSFOS < 40. && mT>80. && met>50. && met<75.)_num_SR0tau_a_bin_3++;
-          if(mSFOS>12. && mSFOS < 40. && mT>80. && met>75.)_num_SR0tau_a_bin_4++;
-
-          if(mSFOS>40. && mSFOS < 60. && mT>0. && mT<80. && met>50. && met<75. && !threelZVeto)_num_SR0tau_a_bin_5++;
-          if(mSFOS>40. && mSFOS < 60. && mT>0. && mT<80. && met>75.)_num_SR0tau_a_bin_6++;
-          if(mSFOS>40. && mSFOS < 60. && mT>80. && met>50. && met<135.)_num_SR0tau_a_bin_7++;
-          if(mSFOS>40. && mSFOS < 60. && mT>80. && met>135.)_num_SR0tau_a_bin_8++;
-
-          if(mSFOS>60. && mSFOS < 81.2 && mT>0. && mT<80. && met>50. && met<75. && !threelZVeto)_num_SR0tau_a_bin_9++;
-          if(mSFOS>60. && mSFOS < 81.2 && mT>80. && met>50. && met<75.)_num_SR0tau_a_bin_10++;
-          if(mSFOS>60. && mSFOS < 81.2 && mT>0. && mT<110. && met>75.)_num_SR0tau_a_bin_11++;
-          if(mSFOS>60. && mSFOS < 81.2 && mT>110. && met>75.)_num_SR0tau_a_bin_12++;
-
-          if(mSFOS>81.2 && mSFOS < 101.2 && mT>0. && mT<110. && met>50. && met<90. && !threelZVeto)_num_SR0tau_a_bin_13++;
-          if(mSFOS>81.2 && mSFOS < 101.2 && mT>0. && mT < 110. && met>90.)_num_SR0tau_a_bin_14++;
-          if(mSFOS>81.2 && mSFOS < 101.2 && mT>110. && met>50. && met < 135.)_num_SR0tau_a_bin_15++;
-          if(mSFOS>81.2 && mSFOS < 101.2 && mT>110. && met>135.)_num_SR0tau_a_bin_16++;
-
-          if(mSFOS > 101.2 && mT>0. && mT<180. && met>50. && met<210.)_num_SR0tau_a_bin_17++;
-          if(mSFOS > 101.2 && mT > 180. && met>50. && met<210.)_num_SR0tau_a_bin_18++;
-          if(mSFOS > 101.2 && mT>0. && mT<120. && met>210.)_num_SR0tau_a_bin_19++;
-          if(mSFOS > 101.2 && mT>120. && met>210.)_num_SR0tau_a_bin_20++;
+          if(mSFOS>12. && mSFOS < 40. && mT>0. && mT<80. && met>50. && met<90.)_num_SR0tau_a_bin_1.fill(event->weight());
+          if(mSFOS>12. && mSFOS < 40. && mT>0. && mT<80. && met>90.)_num_SR0tau_a_bin_2.fill(event->weight());
+          if(mSFOS>12. && mSFOS < 40. && mT>80. && met>50. && met<75.)_num_SR0tau_a_bin_3.fill(event->weight());
+          if(mSFOS>12. && mSFOS < 40. && mT>80. && met>75.)_num_SR0tau_a_bin_4.fill(event->weight());
+
+          if(mSFOS>40. && mSFOS < 60. && mT>0. && mT<80. && met>50. && met<75. && !threelZVeto)_num_SR0tau_a_bin_5.fill(event->weight());
+          if(mSFOS>40. && mSFOS < 60. && mT>0. && mT<80. && met>75.)_num_SR0tau_a_bin_6.fill(event->weight());
+          if(mSFOS>40. && mSFOS < 60. && mT>80. && met>50. && met<135.)_num_SR0tau_a_bin_7.fill(event->weight());
+          if(mSFOS>40. && mSFOS < 60. && mT>80. && met>135.)_num_SR0tau_a_bin_8.fill(event->weight());
+
+          if(mSFOS>60. && mSFOS < 81.2 && mT>0. && mT<80. && met>50. && met<75. && !threelZVeto)_num_SR0tau_a_bin_9.fill(event->weight());
+          if(mSFOS>60. && mSFOS < 81.2 && mT>80. && met>50. && met<75.)_num_SR0tau_a_bin_10.fill(event->weight());
+          if(mSFOS>60. && mSFOS < 81.2 && mT>0. && mT<110. && met>75.)_num_SR0tau_a_bin_11.fill(event->weight());
+          if(mSFOS>60. && mSFOS < 81.2 && mT>110. && met>75.)_num_SR0tau_a_bin_12.fill(event->weight());
+
+          if(mSFOS>81.2 && mSFOS < 101.2 && mT>0. && mT<110. && met>50. && met<90. && !threelZVeto)_num_SR0tau_a_bin_13.fill(event->weight());
+          if(mSFOS>81.2 && mSFOS < 101.2 && mT>0. && mT < 110. && met>90.)_num_SR0tau_a_bin_14.fill(event->weight());
+          if(mSFOS>81.2 && mSFOS < 101.2 && mT>110. && met>50. && met < 135.)_num_SR0tau_a_bin_15.fill(event->weight());
+          if(mSFOS>81.2 && mSFOS < 101.2 && mT>110. && met>135.)_num_SR0tau_a_bin_16.fill(event->weight());
+
+          if(mSFOS > 101.2 && mT>0. && mT<180. && met>50. && met<210.)_num_SR0tau_a_bin_17.fill(event->weight());
+          if(mSFOS > 101.2 && mT > 180. && met>50. && met<210.)_num_SR0tau_a_bin_18.fill(event->weight());
+          if(mSFOS > 101.2 && mT>0. && mT<120. && met>210.)_num_SR0tau_a_bin_19.fill(event->weight());
+          if(mSFOS > 101.2 && mT>120. && met>210.)_num_SR0tau_a_bin_20.fill(event->weight());
         }
         //Now do SR0tau_b
         //Need either two electrons or two muons, and they must have the same sign
@@ -523,7 +564,7 @@ namespace Gambit {
 
         if(trigger && signalLeptons.size()==3 && mSFOS12Cut && atLeastOneEorMu && separationCut && leptonTypeCut_SR0taub && bJets.size()==0 && signalTaus.size()==0){
 
-          if(met > 50. && leptonPTCut_SR0taub && dPhiLLMin < 1.)_num_SR0tau_b++;
+          if(met > 50. && leptonPTCut_SR0taub && dPhiLLMin < 1.)_num_SR0tau_b.fill(event->weight());
 
         }
 
@@ -557,7 +598,7 @@ namespace Gambit {
         if(leptonTypeCut_SR1tau && signalLeptons[1]->pT()>30. && (signalLeptons[0]->pT()+signalLeptons[1]->pT())>70.)leptonPTCut_SR1tau=true;
 
         if(trigger && mSFOS12Cut && atLeastOneEorMu && separationCut && leptonTypeCut_SR1tau && bJets.size()==0){
-          if(met>50. && leptonPTCut_SR1tau && mltau < 120. && !eePairVeto)_num_SR1tau++;
+          if(met>50. && leptonPTCut_SR1tau && mltau < 120. && !eePairVeto)_num_SR1tau.fill(event->weight());
         }
 
         //Now do SR2taua
@@ -598,68 +639,16 @@ namespace Gambit {
           }
         }
 
-        if(numTaus==2 && (numElectrons + numMuons)==1 && trigger && mSFOS12Cut && atLeastOneEorMu && separationCut && bJets.size()==0 && met > 50. && mT2max > 100.)_num_SR2tau_a++;
+        if(numTaus==2 && (numElectrons + numMuons)==1 && trigger && mSFOS12Cut && atLeastOneEorMu && separationCut && bJets.size()==0 && met > 50. && mT2max > 100.)_num_SR2tau_a.fill(event->weight());
 
         //Finally do SR2taub
         double mtautau=0;
         if(numTaus==2)mtautau=(signalTaus[0]->mom()+signalTaus[1]->mom()).m();
 
-        if(numTaus==2 && (numElectrons + numMuons)==1 && trigger && mSFOS12Cut && atLeastOneEorMu && separationCut && (signalTaus[0]->pid() == -1*signalTaus[1]->pid()) && bJets.size()==0 && met > 60 && (signalTaus[0]->mom().pT() + signalTaus[1]->mom().pT())>110. && mtautau>70. && mtautau < 120.)_num_SR2tau_b++;
+        if(numTaus==2 && (numElectrons + numMuons)==1 && trigger && mSFOS12Cut && atLeastOneEorMu && separationCut && (signalTaus[0]->pid() == -1*signalTaus[1]->pid()) && bJets.size()==0 && met > 60 && (signalTaus[0]->mom().pT() + signalTaus[1]->mom().pT())>110. && mtautau>70. && mtautau < 120.)_num_SR2tau_b.fill(event->weight());
 
         //Now do cutflow (for debugging)
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "3 signal leptons ";
-        cutFlowVector_str[2] = "Trigger ";
-        cutFlowVector_str[3] = "At least one e or mu ";
-        cutFlowVector_str[4] = "Separation of leptons ";
-        cutFlowVector_str[5] = "mSFOS > 12 cut ";
-        cutFlowVector_str[6] = "Lepton requirement (no taus) ";
-        cutFlowVector_str[7] = "SFOS ";
-        cutFlowVector_str[8] = "b-tagged jet veto ";
-        cutFlowVector_str[9] = "ETmiss ";
-        cutFlowVector_str[10] = "mT ";
-        cutFlowVector_str[11] = "SR0tau_a_bin_1 ";
-        cutFlowVector_str[12] = "SR0tau_a_bin_2 ";
-        cutFlowVector_str[13] = "SR0tau_a_bin_3 ";
-        cutFlowVector_str[14] = "SR0tau_a_bin_4 ";
-        cutFlowVector_str[15] = "SR0tau_a_bin_5 ";
-        cutFlowVector_str[16] = "SR0tau_a_bin_6 ";
-        cutFlowVector_str[17] = "SR0tau_a_bin_7 ";
-        cutFlowVector_str[18] = "SR0tau_a_bin_8 ";
-        cutFlowVector_str[19] = "SR0tau_a_bin_9 ";
-        cutFlowVector_str[20] = "SR0tau_a_bin_10 ";
-        cutFlowVector_str[21] = "SR0tau_a_bin_11 ";
-        cutFlowVector_str[22] = "SR0tau_a_bin_12 ";
-        cutFlowVector_str[23] = "SR0tau_a_bin_13 ";
-        cutFlowVector_str[24] = "SR0tau_a_bin_14 ";
-        cutFlowVector_str[25] = "SR0tau_a_bin_15 ";
-        cutFlowVector_str[26] = "SR0tau_a_bin_16 ";
-        cutFlowVector_str[27] = "SR0tau_a_bin_17 ";
-        cutFlowVector_str[28] = "SR0tau_a_bin_18 ";
-        cutFlowVector_str[29] = "SR0tau_a_bin_19 ";
-        cutFlowVector_str[30] = "SR0tau_a_bin_20 ";
-        cutFlowVector_str[31] = "SR0taub: Lepton multiplicity ";
-        cutFlowVector_str[32] = "SR0taub: b veto ";
-        cutFlowVector_str[33] = "SR0taub: met ";
-        cutFlowVector_str[34] = "SR0taub: pT 3rd lepton ";
-        cutFlowVector_str[35] = "SR0taub: dPhiLL ";
-        cutFlowVector_str[36] = "SR1tau: Lepton multiplicity ";
-        cutFlowVector_str[37] = "SR1tau: Z veto ";
-        cutFlowVector_str[38] = "SR1tau: b-tagged veto ";
-        cutFlowVector_str[39] = "SR1tau: MET ";
-        cutFlowVector_str[40] = "SR1tau: Lepton pT cuts ";
-        cutFlowVector_str[41] = "SR1tau: mltau ";
-        cutFlowVector_str[42] = "SR2taua: Lepton multiplicity ";
-        cutFlowVector_str[43] = "SR2taua: b veto ";
-        cutFlowVector_str[44] = "SR2taua: MET ";
-        cutFlowVector_str[45] = "SR2taua: MT2max ";
-        cutFlowVector_str[46] = "SR2taub: Lepton multiplicity ";
-        cutFlowVector_str[47] = "SR2taub: b jet veto ";
-        cutFlowVector_str[48] = "SR2taub: met ";
-        cutFlowVector_str[49] = "SR2taub: mtautau ";
-        cutFlowVector_str[50] = "SR2taub: Sum of tau pT ";
-
         //if(signalLeptons.size()==3 && trigger && atLeastOneEorMu)std::cout << "LEPTONID " << signalLeptons[0]->pid() << " " << signalLeptons[1]->pid() << " " << signalLeptons[2]->pid() << " mSFOS12Cut " << mSFOS12Cut << " LEPTONTYPE " << leptonTypeCut_SR0taub << std::endl;
 
         for(int j=0;j<NCUTS;j++){
@@ -780,7 +769,7 @@ namespace Gambit {
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_ATLAS_3LEPEW_20invfb* specificOther
@@ -789,7 +778,6 @@ namespace Gambit {
         // Here we will add the subclass member variables:
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
         _num_SR0tau_a_bin_1 += specificOther->_num_SR0tau_a_bin_1;
         _num_SR0tau_a_bin_2 += specificOther->_num_SR0tau_a_bin_2;
@@ -826,7 +814,8 @@ namespace Gambit {
         results_SR0tau_a_bin_1.n_background = 23.;
         results_SR0tau_a_bin_1.background_sys = 4.;
         results_SR0tau_a_bin_1.signal_sys = 0.;
-        results_SR0tau_a_bin_1.n_signal = _num_SR0tau_a_bin_1;
+        results_SR0tau_a_bin_1.n_signal = _num_SR0tau_a_bin_1.sumw;
+        results_SR0tau_a_bin_1.n_signal_sq = _num_SR0tau_a_bin_1.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_2;
         results_SR0tau_a_bin_2.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -835,7 +824,8 @@ namespace Gambit {
         results_SR0tau_a_bin_2.n_background = 4.2;
         results_SR0tau_a_bin_2.background_sys = 1.5;
         results_SR0tau_a_bin_2.signal_sys = 0.;
-        results_SR0tau_a_bin_2.n_signal = _num_SR0tau_a_bin_2;
+        results_SR0tau_a_bin_2.n_signal = _num_SR0tau_a_bin_2.sumw;
+        results_SR0tau_a_bin_2.n_signal_sq = _num_SR0tau_a_bin_2.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_3;
         results_SR0tau_a_bin_3.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -844,7 +834,8 @@ namespace Gambit {
         results_SR0tau_a_bin_3.n_background = 10.6;
         results_SR0tau_a_bin_3.background_sys = 1.8;
         results_SR0tau_a_bin_3.signal_sys = 0.;
-        results_SR0tau_a_bin_3.n_signal = _num_SR0tau_a_bin_3;
+        results_SR0tau_a_bin_3.n_signal = _num_SR0tau_a_bin_3.sumw;
+        results_SR0tau_a_bin_3.n_signal_sq = _num_SR0tau_a_bin_3.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_4;
         results_SR0tau_a_bin_4.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -853,7 +844,8 @@ namespace Gambit {
         results_SR0tau_a_bin_4.n_background = 8.5;
         results_SR0tau_a_bin_4.background_sys = 1.7;
         results_SR0tau_a_bin_4.signal_sys = 0.;
-        results_SR0tau_a_bin_4.n_signal = _num_SR0tau_a_bin_4;
+        results_SR0tau_a_bin_4.n_signal = _num_SR0tau_a_bin_4.sumw;
+        results_SR0tau_a_bin_4.n_signal_sq = _num_SR0tau_a_bin_4.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_5;
         results_SR0tau_a_bin_5.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -862,7 +854,8 @@ namespace Gambit {
         results_SR0tau_a_bin_5.n_background = 12.9;
         results_SR0tau_a_bin_5.background_sys = 2.4;
         results_SR0tau_a_bin_5.signal_sys = 0.;
-        results_SR0tau_a_bin_5.n_signal = _num_SR0tau_a_bin_5;
+        results_SR0tau_a_bin_5.n_signal = _num_SR0tau_a_bin_5.sumw;
+        results_SR0tau_a_bin_5.n_signal_sq = _num_SR0tau_a_bin_5.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_6;
         results_SR0tau_a_bin_6.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -871,7 +864,8 @@ namespace Gambit {
         results_SR0tau_a_bin_6.n_background = 6.6;
         results_SR0tau_a_bin_6.background_sys = 1.9;
         results_SR0tau_a_bin_6.signal_sys = 0.;
-        results_SR0tau_a_bin_6.n_signal = _num_SR0tau_a_bin_6;
+        results_SR0tau_a_bin_6.n_signal = _num_SR0tau_a_bin_6.sumw;
+        results_SR0tau_a_bin_6.n_signal_sq = _num_SR0tau_a_bin_6.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_7;
         results_SR0tau_a_bin_7.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -880,7 +874,8 @@ namespace Gambit {
         results_SR0tau_a_bin_7.n_background = 14.1;
         results_SR0tau_a_bin_7.background_sys = 2.2;
         results_SR0tau_a_bin_7.signal_sys = 0.;
-        results_SR0tau_a_bin_7.n_signal = _num_SR0tau_a_bin_7;
+        results_SR0tau_a_bin_7.n_signal = _num_SR0tau_a_bin_7.sumw;
+        results_SR0tau_a_bin_7.n_signal_sq = _num_SR0tau_a_bin_7.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_8;
         results_SR0tau_a_bin_8.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -889,7 +884,8 @@ namespace Gambit {
         results_SR0tau_a_bin_8.n_background = 1.1;
         results_SR0tau_a_bin_8.background_sys = 0.4;
         results_SR0tau_a_bin_8.signal_sys = 0.;
-        results_SR0tau_a_bin_8.n_signal = _num_SR0tau_a_bin_8;
+        results_SR0tau_a_bin_8.n_signal = _num_SR0tau_a_bin_8.sumw;
+        results_SR0tau_a_bin_8.n_signal_sq = _num_SR0tau_a_bin_8.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_9;
         results_SR0tau_a_bin_9.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -898,7 +894,8 @@ namespace Gambit {
         results_SR0tau_a_bin_9.n_background = 22.4;
         results_SR0tau_a_bin_9.background_sys = 3.6;
         results_SR0tau_a_bin_9.signal_sys = 0.;
-        results_SR0tau_a_bin_9.n_signal = _num_SR0tau_a_bin_9;
+        results_SR0tau_a_bin_9.n_signal = _num_SR0tau_a_bin_9.sumw;
+        results_SR0tau_a_bin_9.n_signal_sq = _num_SR0tau_a_bin_9.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_10;
         results_SR0tau_a_bin_10.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -907,7 +904,8 @@ namespace Gambit {
         results_SR0tau_a_bin_10.n_background = 16.4;
         results_SR0tau_a_bin_10.background_sys = 2.8;
         results_SR0tau_a_bin_10.signal_sys = 0.;
-        results_SR0tau_a_bin_10.n_signal = _num_SR0tau_a_bin_10;
+        results_SR0tau_a_bin_10.n_signal = _num_SR0tau_a_bin_10.sumw;
+        results_SR0tau_a_bin_10.n_signal_sq = _num_SR0tau_a_bin_10.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_11;
         results_SR0tau_a_bin_11.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -916,7 +914,8 @@ namespace Gambit {
         results_SR0tau_a_bin_11.n_background = 27.;
         results_SR0tau_a_bin_11.background_sys = 5.;
         results_SR0tau_a_bin_11.signal_sys = 0.;
-        results_SR0tau_a_bin_11.n_signal = _num_SR0tau_a_bin_11;
+        results_SR0tau_a_bin_11.n_signal = _num_SR0tau_a_bin_11.sumw;
+        results_SR0tau_a_bin_11.n_signal_sq = _num_SR0tau_a_bin_11.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_12;
         results_SR0tau_a_bin_12.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -925,7 +924,8 @@ namespace Gambit {
         results_SR0tau_a_bin_12.n_background = 5.5;
         results_SR0tau_a_bin_12.background_sys = 1.5;
         results_SR0tau_a_bin_12.signal_sys = 0.;
-        results_SR0tau_a_bin_12.n_signal = _num_SR0tau_a_bin_12;
+        results_SR0tau_a_bin_12.n_signal = _num_SR0tau_a_bin_12.sumw;
+        results_SR0tau_a_bin_12.n_signal_sq = _num_SR0tau_a_bin_12.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_13;
         results_SR0tau_a_bin_13.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -934,7 +934,8 @@ namespace Gambit {
         results_SR0tau_a_bin_13.n_background = 715.;
         results_SR0tau_a_bin_13.background_sys = 70.;
         results_SR0tau_a_bin_13.signal_sys = 0.;
-        results_SR0tau_a_bin_13.n_signal = _num_SR0tau_a_bin_13;
+        results_SR0tau_a_bin_13.n_signal = _num_SR0tau_a_bin_13.sumw;
+        results_SR0tau_a_bin_13.n_signal_sq = _num_SR0tau_a_bin_13.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_14;
         results_SR0tau_a_bin_14.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -943,7 +944,8 @@ namespace Gambit {
         results_SR0tau_a_bin_14.n_background = 219.;
         results_SR0tau_a_bin_14.background_sys = 33.;
         results_SR0tau_a_bin_14.signal_sys = 0.;
-        results_SR0tau_a_bin_14.n_signal = _num_SR0tau_a_bin_14;
+        results_SR0tau_a_bin_14.n_signal = _num_SR0tau_a_bin_14.sumw;
+        results_SR0tau_a_bin_14.n_signal_sq = _num_SR0tau_a_bin_14.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_15;
         results_SR0tau_a_bin_15.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -952,7 +954,8 @@ namespace Gambit {
         results_SR0tau_a_bin_15.n_background = 65.;
         results_SR0tau_a_bin_15.background_sys = 13.;
         results_SR0tau_a_bin_15.signal_sys = 0.;
-        results_SR0tau_a_bin_15.n_signal = _num_SR0tau_a_bin_15;
+        results_SR0tau_a_bin_15.n_signal = _num_SR0tau_a_bin_15.sumw;
+        results_SR0tau_a_bin_15.n_signal_sq = _num_SR0tau_a_bin_15.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_16;
         results_SR0tau_a_bin_16.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -961,7 +964,8 @@ namespace Gambit {
         results_SR0tau_a_bin_16.n_background = 4.6;
         results_SR0tau_a_bin_16.background_sys = 1.7;
         results_SR0tau_a_bin_16.signal_sys = 0.;
-        results_SR0tau_a_bin_16.n_signal = _num_SR0tau_a_bin_16;
+        results_SR0tau_a_bin_16.n_signal = _num_SR0tau_a_bin_16.sumw;
+        results_SR0tau_a_bin_16.n_signal_sq = _num_SR0tau_a_bin_16.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_17;
         results_SR0tau_a_bin_17.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -970,7 +974,8 @@ namespace Gambit {
         results_SR0tau_a_bin_17.n_background = 69.;
         results_SR0tau_a_bin_17.background_sys = 9.;
         results_SR0tau_a_bin_17.signal_sys = 0.;
-        results_SR0tau_a_bin_17.n_signal = _num_SR0tau_a_bin_17;
+        results_SR0tau_a_bin_17.n_signal = _num_SR0tau_a_bin_17.sumw;
+        results_SR0tau_a_bin_17.n_signal_sq = _num_SR0tau_a_bin_17.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_18;
         results_SR0tau_a_bin_18.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -979,7 +984,8 @@ namespace Gambit {
         results_SR0tau_a_bin_18.n_background = 3.4;
         results_SR0tau_a_bin_18.background_sys = 1.4;
         results_SR0tau_a_bin_18.signal_sys = 0.;
-        results_SR0tau_a_bin_18.n_signal = _num_SR0tau_a_bin_18;
+        results_SR0tau_a_bin_18.n_signal = _num_SR0tau_a_bin_18.sumw;
+        results_SR0tau_a_bin_18.n_signal_sq = _num_SR0tau_a_bin_18.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_19;
         results_SR0tau_a_bin_19.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -988,7 +994,8 @@ namespace Gambit {
         results_SR0tau_a_bin_19.n_background = 1.2;
         results_SR0tau_a_bin_19.background_sys = 0.4;
         results_SR0tau_a_bin_19.signal_sys = 0.;
-        results_SR0tau_a_bin_19.n_signal = _num_SR0tau_a_bin_19;
+        results_SR0tau_a_bin_19.n_signal = _num_SR0tau_a_bin_19.sumw;
+        results_SR0tau_a_bin_19.n_signal_sq = _num_SR0tau_a_bin_19.sumw2;
 
         SignalRegionData results_SR0tau_a_bin_20;
         results_SR0tau_a_bin_20.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -997,7 +1004,8 @@ namespace Gambit {
         results_SR0tau_a_bin_20.n_background = 0.29;
         results_SR0tau_a_bin_20.background_sys = 0.18;
         results_SR0tau_a_bin_20.signal_sys = 0.;
-        results_SR0tau_a_bin_20.n_signal = _num_SR0tau_a_bin_20;
+        results_SR0tau_a_bin_20.n_signal = _num_SR0tau_a_bin_20.sumw;
+        results_SR0tau_a_bin_20.n_signal_sq = _num_SR0tau_a_bin_20.sumw2;
 
         SignalRegionData results_SR1tau;
         results_SR1tau.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -1006,7 +1014,8 @@ namespace Gambit {
         results_SR1tau.n_background = 10.3;
         results_SR1tau.background_sys = 1.2;
         results_SR1tau.signal_sys = 0.;
-        results_SR1tau.n_signal = _num_SR1tau;
+        results_SR1tau.n_signal = _num_SR1tau.sumw;
+        results_SR1tau.n_signal_sq = _num_SR1tau.sumw2;
 
         SignalRegionData results_SR2tau_a;
         results_SR2tau_a.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -1015,7 +1024,8 @@ namespace Gambit {
         results_SR2tau_a.n_background = 6.9;
         results_SR2tau_a.background_sys = 0.8;
         results_SR2tau_a.signal_sys = 0.;
-        results_SR2tau_a.n_signal = _num_SR2tau_a;
+        results_SR2tau_a.n_signal = _num_SR2tau_a.sumw;
+        results_SR2tau_a.n_signal_sq = _num_SR2tau_a.sumw2;
 
         SignalRegionData results_SR2tau_b;
         results_SR2tau_b.analysis_name = "Analysis_ATLAS_3LEPEW_20invfb";
@@ -1024,7 +1034,8 @@ namespace Gambit {
         results_SR2tau_b.n_background = 7.2;
         results_SR2tau_b.background_sys = 0.8;
         results_SR2tau_b.signal_sys = 0.;
-        results_SR2tau_b.n_signal = _num_SR2tau_b;
+        results_SR2tau_b.n_signal = _num_SR2tau_b.sumw;
+        results_SR2tau_b.n_signal_sq = _num_SR2tau_b.sumw2;
 
         add_result(results_SR0tau_a_bin_1);
         add_result(results_SR0tau_a_bin_2);
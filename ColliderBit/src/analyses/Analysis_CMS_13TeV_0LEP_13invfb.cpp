@@ -20,14 +20,14 @@ namespace Gambit {
 
       // Numbers passing cuts
       static const size_t NUMSR = 12; //160;
-      double _srnums[NUMSR];
+      WeightedCount _srnums[NUMSR];
       Cutflow _cutflow;
 
       Analysis_CMS_13TeV_0LEP_13invfb() :
         _cutflow("CMS 0-lep 13 TeV", {"Njet >= 3", "HT > 300", "HTmiss > 300", "Nmuon = 0", "Nelectron = 0", "Nhadron = 0 (no-op)", "Dphi_htmiss_j1", "Dphi_htmiss_j2", "Dphi_htmiss_j3", "Dphi_htmiss_j4"})
       {
         set_luminosity(12.9);
-        for (size_t i = 0; i < NUMSR; ++i) _srnums[i] = 0;
+        for (size_t i = 0; i < NUMSR; ++i) _srnums[i] = WeightedCount();
       }
 
 
@@ -65,16 +65,12 @@ namespace Gambit {
 
 
         // Get baseline electrons
-        vector<const Particle*> baseelecs;
-        for (const Particle* electron : event->electrons())
-          if (electron->pT() > 10. && electron->abseta() < 2.5)
-            baseelecs.push_back(electron);
+        const vector<Particle*>& presElectrons = preselection().electrons(10., 2.5);
+        vector<const Particle*> baseelecs(presElectrons.begin(), presElectrons.end());
 
         // Get baseline muons
-        vector<const Particle*> basemuons;
-        for (const Particle* muon : event->muons())
-          if (muon->pT() > 10. && muon->abseta() < 2.4)
-            basemuons.push_back(muon);
+        const vector<Particle*>& presMuons = preselection().muons(10., 2.4);
+        vector<const Particle*> basemuons(presMuons.begin(), presMuons.end());
 
         // Electron isolation
         /// @todo Sum should actually be over all non-e/mu calo particles
@@ -187,24 +183,24 @@ namespace Gambit {
           const bool btagged = rand01() < (j->btag() ? 0.55 : j->ctag() ? 0.12 : 0.016);
           if (btagged) nbj += 1;
         }
-        if (nj >= 3 && nbj == 0 && ht >  500 && htmiss > 500) _srnums[ 0] += 1;
-        if (nj >= 3 && nbj == 0 && ht > 1500 && htmiss > 750) _srnums[ 1] += 1;
-        if (nj >= 5 && nbj == 0 && ht >  500 && htmiss > 500) _srnums[ 2] += 1;
-        if (nj >= 5 && nbj == 0 && ht > 1500 && htmiss > 750) _srnums[ 3] += 1;
-        if (nj >= 9 && nbj == 0 && ht > 1500 && htmiss > 750) _srnums[ 4] += 1;
-        if (nj >= 3 && nbj >= 2 && ht >  500 && htmiss > 500) _srnums[ 5] += 1;
-        if (nj >= 3 && nbj >= 1 && ht >  750 && htmiss > 750) _srnums[ 6] += 1;
-        if (nj >= 5 && nbj >= 3 && ht >  500 && htmiss > 500) _srnums[ 7] += 1;
-        if (nj >= 5 && nbj >= 2 && ht > 1500 && htmiss > 750) _srnums[ 8] += 1;
-        if (nj >= 9 && nbj >= 3 && ht >  750 && htmiss > 750) _srnums[ 9] += 1;
-        if (nj >= 7 && nbj >= 1 && ht >  300 && htmiss > 300) _srnums[10] += 1;
-        if (nj >= 5 && nbj >= 1 && ht >  750 && htmiss > 750) _srnums[11] += 1;
+        if (nj >= 3 && nbj == 0 && ht >  500 && htmiss > 500) _srnums[ 0].fill(event->weight());
+        if (nj >= 3 && nbj == 0 && ht > 1500 && htmiss > 750) _srnums[ 1].fill(event->weight());
+        if (nj >= 5 && nbj == 0 && ht >  500 && htmiss > 500) _srnums[ 2].fill(event->weight());
+        if (nj >= 5 && nbj == 0 && ht > 1500 && htmiss > 750) _srnums[ 3].fill(event->weight());
+        if (nj >= 9 && nbj == 0 && ht > 1500 && htmiss > 750) _srnums[ 4].fill(event->weight());
+        if (nj >= 3 && nbj >= 2 && ht >  500 && htmiss > 500) _srnums[ 5].fill(event->weight());
+        if (nj >= 3 && nbj >= 1 && ht >  750 && htmiss > 750) _srnums[ 6].fill(event->weight());
+        if (nj >= 5 && nbj >= 3 && ht >  500 && htmiss > 500) _srnums[ 7].fill(event->weight());
+        if (nj >= 5 && nbj >= 2 && ht > 1500 && htmiss > 750) _srnums[ 8].fill(event->weight());
+        if (nj >= 9 && nbj >= 3 && ht >  750 && htmiss > 750) _srnums[ 9].fill(event->weight());
+        if (nj >= 7 && nbj >= 1 && ht >  300 && htmiss > 300) _srnums[10].fill(event->weight());
+        if (nj >= 5 && nbj >= 1 && ht >  750 && htmiss > 750) _srnums[11].fill(event->weight());
 
       }
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_CMS_13TeV_0LEP_13invfb* specificOther = dynamic_cast<Analysis_CMS_13TeV_0LEP_13invfb*>(other);
@@ -216,8 +212,6 @@ namespace Gambit {
 
       /// Register results objects with the results for each SR; obs & bkg numbers from the CONF note
       void collect_results() {
-        cout << _cutflow << endl;
-
         static const string ANAME = "Analysis_CMS_13TeV_0LEP_13invfb";
         static const double OBSNUM[NUMSR] = {
           // 5180, 1780, 146, 2834, 2819, 202, 1070,  93, 134, 11, 1009, 411, 35, 512, 607, 47, 200, 27, 30, 4,   195, 77,  2,  65, 109,  9,   22,   6,   2,   1,    10,    3,  0,    3,   12,   2,   2,   0,   0,   0,
@@ -242,10 +236,18 @@ namespace Gambit {
         };
         for (size_t ibin = 0; ibin < NUMSR; ++ibin) {
           stringstream ss; ss << "sr-" << ibin;
-          add_result(SignalRegionData(ANAME, ss.str(), OBSNUM[ibin], {_srnums[ibin],  0.}, {BKGNUM[ibin], BKGERR[ibin]}));
+          add_result(SignalRegionData(ANAME, ss.str(), OBSNUM[ibin], _srnums[ibin], {BKGNUM[ibin], BKGERR[ibin]}));
         }
       }
 
+
+      /// Scale the results, and print the cutflow now that it is final.
+      /// @note Not done in collect_results, which also runs at every convergence check.
+      void scale(double factor=-1) {
+        HEPUtilsAnalysis::scale(factor);
+        cout << _cutflow << endl;
+      }
+
     };
 
 
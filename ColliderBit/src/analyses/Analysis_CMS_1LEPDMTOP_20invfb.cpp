@@ -38,7 +38,7 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      int _numSR;
+      WeightedCount _numSR;
 
       vector<int> cutFlowVector;
       vector<string> cutFlowVector_str;
@@ -47,7 +47,7 @@ namespace Gambit {
     public:
 
       Analysis_CMS_1LEPDMTOP_20invfb()
-        : _numSR(0),
+        : _numSR(),
           NCUTS(6)
       {
         set_luminosity(19.7);
@@ -55,6 +55,13 @@ namespace Gambit {
           cutFlowVector.push_back(0);
           cutFlowVector_str.push_back("");
         }
+
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "Presel ";
+        cutFlowVector_str[2] = "MET > 320 GeV ";
+        cutFlowVector_str[3] = "MT > 160 GeV ";
+        cutFlowVector_str[4] = "MT2W > 300 GeV ";
+        cutFlowVector_str[5] = "dPhiMin12 > 1.2 ";
       }
 
       double SmallestdPhi(std::vector<HEPUtils::Jet *> jets,double phi_met)
@@ -79,22 +86,10 @@ namespace Gambit {
         double met = event->met();
 
         // Now define vectors of baseline objects
-        vector<HEPUtils::Particle*> baselineLeptons;
-
-        vector<HEPUtils::Particle*> baselineElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 30. && fabs(electron->eta()) < 2.5) {
-            baselineElectrons.push_back(electron);
-            baselineLeptons.push_back(electron);
-          }
-        }
-        vector<HEPUtils::Particle*> baselineMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 30. && fabs(muon->eta()) < 2.1) {
-            baselineMuons.push_back(muon);
-            baselineLeptons.push_back(muon);
-          }
-        }
+        vector<HEPUtils::Particle*> baselineElectrons = preselection().electrons(30., 2.5);
+        vector<HEPUtils::Particle*> baselineMuons = preselection().muons(30., 2.1);
+        vector<HEPUtils::Particle*> baselineLeptons = baselineElectrons;
+        baselineLeptons.insert(baselineLeptons.end(), baselineMuons.begin(), baselineMuons.end());
 
         vector<HEPUtils::Jet*> baselineJets;
         //vector<LorentzVector> jets;
@@ -148,16 +143,16 @@ namespace Gambit {
           mT=sqrt(2.*lepVec.pT()*met*(1. - cos(_Phi_mpi_pi(lepVec.phi()-ptot.phi()))));
         }
 
-        //Calculate MT2W
-        double MT2W=0;
+        //Calculate MT2W > 300, only needed after the MET and mT cuts
+        bool passMT2W=false;
         // double MT2W_HU=0;
-        if (nJets > 1 && nLeptons==1) {
+        if (nJets > 1 && nLeptons==1 && passPresel && met > 320. && mT > 160.) {
           HEPUtils::P4 lepVec;
           lepVec=baselineLeptons[0]->mom();
           //LorentzVector lep (lepVec.px(),lepVec.py(),lepVec.pz(),lepVec.E());
           float phi=float (ptot.phi());
           //MT2W=calculateMT2w(jets, btag, lep, met, phi);
-          MT2W=calculateMT2wHepUtils(jets,btag,lepVec,met,phi);
+          passMT2W=mt2wAboveHepUtils(jets,btag,lepVec,met,phi,300.);
         }
 
         //Calculate dPhi variable
@@ -170,13 +165,6 @@ namespace Gambit {
         //MT2W > 300
         //dPhiMin12 > 1.2
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "Presel ";
-        cutFlowVector_str[2] = "MET > 320 GeV ";
-        cutFlowVector_str[3] = "MT > 160 GeV ";
-        cutFlowVector_str[4] = "MT2W > 300 GeV ";
-        cutFlowVector_str[5] = "dPhiMin12 > 1.2 ";
-
         for(int j=0;j<NCUTS;j++){
           if(
              (j==0) ||
@@ -187,9 +175,9 @@ namespace Gambit {
 
              (j==3 && passPresel && met > 320. && mT > 160.) ||
 
-             (j==4 && passPresel && met > 320. && mT > 160. && MT2W > 300.) ||
+             (j==4 && passPresel && met > 320. && mT > 160. && passMT2W) ||
 
-             (j==5 && passPresel && met > 320. && mT > 160. && MT2W > 300. && dPhiMin12 > 1.2))
+             (j==5 && passPresel && met > 320. && mT > 160. && passMT2W && dPhiMin12 > 1.2))
 
             cutFlowVector[j]++;
         }
@@ -197,14 +185,14 @@ namespace Gambit {
         //We're now ready to apply the cuts for each signal region
         //_numSR1, _numSR2, _numSR3;
 
-        if(passPresel && met > 320. && mT > 160. && MT2W > 300. && dPhiMin12 > 1.2)_numSR++;
+        if(passPresel && met > 320. && mT > 160. && passMT2W && dPhiMin12 > 1.2)_numSR.fill(event->weight());
 
         return;
       }
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_CMS_1LEPDMTOP_20invfb* specificOther
@@ -214,7 +202,6 @@ namespace Gambit {
         if (NCUTS != specificOther->NCUTS) NCUTS = specificOther->NCUTS;
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
         _numSR += specificOther->_numSR;
       }
@@ -233,7 +220,8 @@ namespace Gambit {
         results_SR.n_background = 16.4;
         results_SR.background_sys = 3.48;
         results_SR.signal_sys = 0.;
-        results_SR.n_signal = _numSR;
+        results_SR.n_signal = _numSR.sumw;
+        results_SR.n_signal_sq = _numSR.sumw2;
 
         add_result(results_SR);
 
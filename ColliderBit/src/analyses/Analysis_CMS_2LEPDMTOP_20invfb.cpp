@@ -29,7 +29,7 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      int _numSR;
+      WeightedCount _numSR;
 
       vector<int> cutFlowVector;
       vector<string> cutFlowVector_str;
@@ -40,7 +40,7 @@ namespace Gambit {
     public:
 
       Analysis_CMS_2LEPDMTOP_20invfb()
-        : _numSR(0),
+        : _numSR(),
           NCUTS(6)
       {
         set_luminosity(19.7);
@@ -48,6 +48,13 @@ namespace Gambit {
           cutFlowVector.push_back(0);
           cutFlowVector_str.push_back("");
         }
+
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "Presel ";
+        cutFlowVector_str[2] = "MET > 320 GeV ";
+        cutFlowVector_str[3] = "pT_j1 + pT_j2 < 400 GeV ";
+        cutFlowVector_str[4] = "pT_l1 + pT_l2 > 120 GeV ";
+        cutFlowVector_str[5] = "dPhi_ll < 2. ";
       }
 
       double SmallestdPhi(std::vector<HEPUtils::Jet *> jets,double phi_met)
@@ -72,22 +79,10 @@ namespace Gambit {
         double met = event->met();
 
         // Now define vectors of baseline objects
-	vector<HEPUtils::Particle*> baselineLeptons;
-
-        vector<HEPUtils::Particle*> baselineElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 20. && fabs(electron->eta()) < 2.5) {
-	    baselineElectrons.push_back(electron);
-	    baselineLeptons.push_back(electron);
-	  }
-        }
-        vector<HEPUtils::Particle*> baselineMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 20. && fabs(muon->eta()) < 2.4) {
-	    baselineMuons.push_back(muon);
-	    baselineLeptons.push_back(muon);
-	  }
-        }
+        vector<HEPUtils::Particle*> baselineElectrons = preselection().electrons(20., 2.5);
+        vector<HEPUtils::Particle*> baselineMuons = preselection().muons(20., 2.4);
+        vector<HEPUtils::Particle*> baselineLeptons = baselineElectrons;
+        baselineLeptons.insert(baselineLeptons.end(), baselineMuons.begin(), baselineMuons.end());
 
         vector<HEPUtils::Jet*> baselineJets;
 	vector<HEPUtils::P4> jets;
@@ -159,13 +154,6 @@ namespace Gambit {
 	double dPhiLL=99.;
 	if(baselineLeptons.size()==2)dPhiLL=acos(cos((baselineLeptons[0]->phi() - baselineLeptons[1]->phi())));
 
-	cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "Presel ";
-        cutFlowVector_str[2] = "MET > 320 GeV ";
-        cutFlowVector_str[3] = "pT_j1 + pT_j2 < 400 GeV ";
-        cutFlowVector_str[4] = "pT_l1 + pT_l2 > 120 GeV ";
-        cutFlowVector_str[5] = "dPhi_ll < 2. ";
-
         for(int j=0;j<NCUTS;j++){
           if(
              (j==0) ||
@@ -186,14 +174,14 @@ namespace Gambit {
         //We're now ready to apply the cuts for each signal region
         //_numSR1, _numSR2, _numSR3;
 
-        if(passPresel && met > 320. && jetPtSum < 400. && lepPtSum > 120. && dPhiLL < 2.)_numSR++;
+        if(passPresel && met > 320. && jetPtSum < 400. && lepPtSum > 120. && dPhiLL < 2.)_numSR.fill(event->weight());
 
         return;
       }
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_CMS_2LEPDMTOP_20invfb* specificOther
@@ -203,7 +191,6 @@ namespace Gambit {
         if (NCUTS != specificOther->NCUTS) NCUTS = specificOther->NCUTS;
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
         _numSR += specificOther->_numSR;
       }
@@ -222,7 +209,8 @@ namespace Gambit {
         results_SR.n_background = 1.89;
         results_SR.background_sys = 0.66;
         results_SR.signal_sys = 0.;
-        results_SR.n_signal = _numSR;
+        results_SR.n_signal = _numSR.sumw;
+        results_SR.n_signal_sq = _numSR.sumw2;
 
         add_result(results_SR);
 
@@ -25,7 +25,7 @@ namespace Gambit {
     private:
 
       // Array of signal regions, set to zero
-      int SR [180];
+      WeightedCount SR [180];
       //int Region45=0;
       //int Region46=0;
       vector<double> boundsMll = {0.,75.,105.,9999.};
@@ -40,7 +40,7 @@ namespace Gambit {
         set_luminosity(19.5);
 
         for(int i=0;i<180;i++){
-          SR[i]=0;
+          SR[i] = WeightedCount();
         }
 
       }
@@ -111,28 +111,14 @@ namespace Gambit {
         double missingPhi = ptot.phi();
 
         // Now define vectors of baseline objects
-        vector<HEPUtils::Particle*> signalElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.4) signalElectrons.push_back(electron);
-        }
-        vector<HEPUtils::Particle*> signalMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.4) signalMuons.push_back(muon);
-        }
-        vector<HEPUtils::Particle*> signalTaus;
-        for (HEPUtils::Particle* tau : event->taus()) {
-          if (tau->pT() > 20. && fabs(tau->eta()) < 2.4) signalTaus.push_back(tau);
-        }
+        vector<HEPUtils::Particle*> signalElectrons = preselection().electrons(10., 2.4);
+        vector<HEPUtils::Particle*> signalMuons = preselection().muons(10., 2.4);
+        vector<HEPUtils::Particle*> signalTaus = preselection().taus(20., 2.4);
         /// @TODO ATLAS? Really?
         ATLAS::applyTauEfficiencyR1(signalTaus);
 
-        vector<HEPUtils::Jet*> signalJets;
-        vector<HEPUtils::Jet*> bJets;
-
-        for (HEPUtils::Jet* jet : event->jets()) {
-          if (jet->pT() > 30. && fabs(jet->eta()) < 2.5) signalJets.push_back(jet);
-          if(jet->btag() && fabs(jet->eta()) < 2.5 && jet->pT() > 30.) bJets.push_back(jet);
-        }
+        vector<HEPUtils::Jet*> signalJets = preselection().jets(30., 2.5);
+        vector<HEPUtils::Jet*> bJets = preselection().bjets(30., 2.5);
 
         //Overlap Removal
 
@@ -272,7 +258,7 @@ namespace Gambit {
 	      for(unsigned int l=0;l<(boundsmet.size()-1);l++){
 		//cout << "FLAVSIGN " << flavourSign.at(i) << endl;
 		if(flavourSign.at(i) && mLL>=boundsMll.at(j) && mLL<boundsMll.at(j+1) && mT>=boundsMt.at(k) && mT<boundsMt.at(k+1) && met>=boundsmet.at(l) && met<boundsmet.at(l+1)){
-		  SR[m]++;
+		  SR[m].fill(event->weight());
 		}
 		//cout << m << " ";
 		//std::cout << "REGION " << m << " Mll bounds " << boundsMll[j]<< " to " << boundsMll[j+1] << " MT bound " << boundsMt[k] << " to " << boundsMt[k+1] << " MET bound " << boundsmet[l] << " to " << boundsmet[l+1] << std::endl;
@@ -286,7 +272,7 @@ namespace Gambit {
 	      for(unsigned int k=0;k<(boundsMt.size()-1);k++){
 		for(unsigned int l=0;l<(boundsmet.size()-1);l++){
 		  if(flavourSign.at(i) && mLL>=boundsMll2.at(j) && mLL<boundsMll2.at(j+1) && mT>=boundsMt.at(k) && mT<boundsMt.at(k+1) && met>=boundsmet.at(l) && met<boundsmet.at(l+1)){
-		    SR[m]++;
+		    SR[m].fill(event->weight());
 		  }
 
 		  //std::cout << "REGION " << m << " Mll bounds " << boundsMll2[j]<< " to " << boundsMll2[j+1] << " MT bound " << boundsMt[k] << " to " << boundsMt[k+1] << " MET bound " << boundsmet[l] << " to " << boundsmet[l+1] << std::endl;
@@ -353,7 +339,7 @@ namespace Gambit {
 
       void add(BaseAnalysis* other) {
         // TODO: Need to combine the signal region results here
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_CMS_3LEPEW_20invfb* specificOther
@@ -405,7 +391,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_highmt[region];
 	  results_tmp.background_sys = err_highmt[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_highmt[region]];
+	  results_tmp.n_signal = SR[regions_highmt[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_highmt[region]].sumw2;
 	  add_result(results_tmp);
 
 	}
@@ -441,7 +428,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_medmt[region];
 	  results_tmp.background_sys = err_medmt[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_medmt[region]];
+	  results_tmp.n_signal = SR[regions_medmt[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_medmt[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -476,7 +464,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_lowmt[region];
 	  results_tmp.background_sys = err_lowmt[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_lowmt[region]];
+	  results_tmp.n_signal = SR[regions_lowmt[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_lowmt[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -509,7 +498,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_highmt_osof[region];
 	  results_tmp.background_sys = err_highmt_osof[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_highmt_osof[region]];
+	  results_tmp.n_signal = SR[regions_highmt_osof[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_highmt_osof[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -540,7 +530,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_medmt_osof[region];
 	  results_tmp.background_sys = err_medmt_osof[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_medmt_osof[region]];
+	  results_tmp.n_signal = SR[regions_medmt_osof[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_medmt_osof[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -571,7 +562,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_lowmt_osof[region];
 	  results_tmp.background_sys = err_lowmt_osof[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_lowmt_osof[region]];
+	  results_tmp.n_signal = SR[regions_lowmt_osof[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_lowmt_osof[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -603,7 +595,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_highmt_ss1tau[region];
 	  results_tmp.background_sys = err_highmt_ss1tau[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_highmt_ss1tau[region]];
+	  results_tmp.n_signal = SR[regions_highmt_ss1tau[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_highmt_ss1tau[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -634,7 +627,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_medmt_ss1tau[region];
 	  results_tmp.background_sys = err_medmt_ss1tau[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_medmt_ss1tau[region]];
+	  results_tmp.n_signal = SR[regions_medmt_ss1tau[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_medmt_ss1tau[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -666,7 +660,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_lowmt_ss1tau[region];
 	  results_tmp.background_sys = err_lowmt_ss1tau[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_lowmt_ss1tau[region]];
+	  results_tmp.n_signal = SR[regions_lowmt_ss1tau[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_lowmt_ss1tau[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -699,7 +694,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_highmt_osof1tau[region];
 	  results_tmp.background_sys = err_highmt_osof1tau[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_highmt_osof1tau[region]];
+	  results_tmp.n_signal = SR[regions_highmt_osof1tau[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_highmt_osof1tau[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -730,7 +726,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_medmt_osof1tau[region];
 	  results_tmp.background_sys = err_medmt_osof1tau[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_medmt_osof1tau[region]];
+	  results_tmp.n_signal = SR[regions_medmt_osof1tau[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_medmt_osof1tau[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -762,7 +759,8 @@ namespace Gambit {
 	  results_tmp.n_background = background_lowmt_osof1tau[region];
 	  results_tmp.background_sys = err_lowmt_osof1tau[region];
 	  results_tmp.signal_sys = 0.;
-	  results_tmp.n_signal = SR[regions_lowmt_osof1tau[region]];
+	  results_tmp.n_signal = SR[regions_lowmt_osof1tau[region]].sumw;
+	  results_tmp.n_signal_sq = SR[regions_lowmt_osof1tau[region]].sumw2;
 	  add_result(results_tmp);
 	}
 
@@ -28,7 +28,7 @@ namespace Gambit {
     private:
 
       // Numbers passing cuts
-      int _num250,_num300,_num350,_num400,_num450,_num500,_num550;
+      WeightedCount _num250,_num300,_num350,_num400,_num450,_num500,_num550;
 
       vector<int> cutFlowVector;
       vector<string> cutFlowVector_str;
@@ -39,7 +39,7 @@ namespace Gambit {
     public:
 
       Analysis_CMS_MONOJET_20invfb()
-        : _num250(0),_num300(0),_num350(0),_num400(0),_num450(0),_num500(0),_num550(0),
+        : _num250(),_num300(),_num350(),_num400(),_num450(),_num500(),_num550(),
           NCUTS(12)
       {
         set_luminosity(19.7);
@@ -47,6 +47,19 @@ namespace Gambit {
           cutFlowVector.push_back(0);
           cutFlowVector_str.push_back("");
         }
+
+        cutFlowVector_str[0] = "No cuts ";
+        cutFlowVector_str[1] = "pT(j1) > 110 GeV and |eta(j1)| < 2.4 ";
+        cutFlowVector_str[2] = "njets <=2 ";
+        cutFlowVector_str[3] = "dPhi(j1,j2) < 2.5 ";
+        cutFlowVector_str[4] = "nLeptons = 0 ";
+        cutFlowVector_str[5] = "met > 250 ";
+        cutFlowVector_str[6] = "met > 300 ";
+        cutFlowVector_str[7] = "met > 350 ";
+        cutFlowVector_str[8] = "met > 400 ";
+        cutFlowVector_str[9] = "met > 450 ";
+        cutFlowVector_str[10] = "met > 500 ";
+        cutFlowVector_str[11] = "met > 550 ";
       }
 
       double SmallestdPhi(std::vector<HEPUtils::Jet *> jets,double phi_met)
@@ -72,37 +85,16 @@ namespace Gambit {
 
         // Now define vectors of baseline objects
 
-        vector<HEPUtils::Particle*> baselineElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.5) {
-            baselineElectrons.push_back(electron);
-          }
-        }
-        vector<HEPUtils::Particle*> baselineMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.5) {
-            baselineMuons.push_back(muon);
-          }
-        }
+        vector<HEPUtils::Particle*> baselineElectrons = preselection().electrons(10., 2.5);
+        vector<HEPUtils::Particle*> baselineMuons = preselection().muons(10., 2.5);
 
-        vector<HEPUtils::Particle*> baselineTaus;
-        for (HEPUtils::Particle* tau : event->taus()) {
-          if (tau->pT() > 20. && fabs(tau->eta()) < 2.3) {
-            baselineTaus.push_back(tau);
-          }
-        }
+        vector<HEPUtils::Particle*> baselineTaus = preselection().taus(20., 2.3);
         /// @TODO ATLAS? Really?
         ATLAS::applyTauEfficiencyR1(baselineTaus);
 
-        vector<HEPUtils::Jet*> baselineJets;
+        vector<HEPUtils::Jet*> baselineJets = preselection().jets(30., 4.5);
         vector<HEPUtils::P4> jets;
 
-        for (HEPUtils::Jet* jet : event->jets()) {
-          if (jet->pT() > 30. && fabs(jet->eta()) < 4.5) {
-            baselineJets.push_back(jet);
-          }
-        }
-
         // Calculate common variables and cuts first
         //applyTightIDElectronSelection(signalElectrons);
 
@@ -124,19 +116,6 @@ namespace Gambit {
         // met > 500
         // met > 550
 
-        cutFlowVector_str[0] = "No cuts ";
-        cutFlowVector_str[1] = "pT(j1) > 110 GeV and |eta(j1)| < 2.4 ";
-        cutFlowVector_str[2] = "njets <=2 ";
-        cutFlowVector_str[3] = "dPhi(j1,j2) < 2.5 ";
-        cutFlowVector_str[4] = "nLeptons = 0 ";
-        cutFlowVector_str[5] = "met > 250 ";
-        cutFlowVector_str[6] = "met > 300 ";
-        cutFlowVector_str[7] = "met > 350 ";
-        cutFlowVector_str[8] = "met > 400 ";
-        cutFlowVector_str[9] = "met > 450 ";
-        cutFlowVector_str[10] = "met > 500 ";
-        cutFlowVector_str[11] = "met > 550 ";
-
         double dPhiJ1J2 = 5.;
         if(nJets>=2)dPhiJ1J2=acos(cos((baselineJets[0]->phi() - baselineJets[1]->phi())));
 
@@ -173,12 +152,12 @@ namespace Gambit {
         //We're now ready to apply the cuts for each signal region
         //_numSR1, _numSR2, _numSR3;
 
-        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 250.)_num250++;
-        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 350.)_num350++;
-        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 400.)_num400++;
-        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 450.)_num450++;
-        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 500.)_num500++;
-        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 550.)_num550++;
+        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 250.)_num250.fill(event->weight());
+        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 350.)_num350.fill(event->weight());
+        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 400.)_num400.fill(event->weight());
+        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 450.)_num450.fill(event->weight());
+        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 500.)_num500.fill(event->weight());
+        if(nJets > 0 && baselineJets[0]->pT() > 110. && fabs(baselineJets[0]->eta()) < 2.4 && nJets <=2 && dPhiJ1J2 < 2.5 && nLeptons==0 && met > 550.)_num550.fill(event->weight());
 
         return;
 
@@ -186,7 +165,7 @@ namespace Gambit {
 
 
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 
         Analysis_CMS_MONOJET_20invfb* specificOther
@@ -196,7 +175,6 @@ namespace Gambit {
         if (NCUTS != specificOther->NCUTS) NCUTS = specificOther->NCUTS;
         for (int j=0; j<NCUTS; j++) {
           cutFlowVector[j] += specificOther->cutFlowVector[j];
-          cutFlowVector_str[j] = specificOther->cutFlowVector_str[j];
         }
         _num250 += specificOther->_num250;
         _num300 += specificOther->_num300;
@@ -221,7 +199,8 @@ namespace Gambit {
         results_250.n_background = 51800.;
         results_250.background_sys = 2000.;
         results_250.signal_sys = 0.;
-        results_250.n_signal = _num250;
+        results_250.n_signal = _num250.sumw;
+        results_250.n_signal_sq = _num250.sumw2;
 
         SignalRegionData results_300;
         results_300.analysis_name = "Analysis_CMS_MONOJET_20invfb";
@@ -230,7 +209,8 @@ namespace Gambit {
         results_300.n_background = 19600.;
         results_300.background_sys = 830.;
         results_300.signal_sys = 0.;
-        results_300.n_signal = _num300;
+        results_300.n_signal = _num300.sumw;
+        results_300.n_signal_sq = _num300.sumw2;
 
         SignalRegionData results_350;
         results_350.analysis_name = "Analysis_CMS_MONOJET_20invfb";
@@ -239,7 +219,8 @@ namespace Gambit {
         results_350.n_background = 8190.;
         results_350.background_sys = 400.;
         results_350.signal_sys = 0.;
-        results_350.n_signal = _num350;
+        results_350.n_signal = _num350.sumw;
+        results_350.n_signal_sq = _num350.sumw2;
 
         SignalRegionData results_400;
         results_400.analysis_name = "Analysis_CMS_MONOJET_20invfb";
@@ -248,7 +229,8 @@ namespace Gambit {
         results_400.n_background = 3930.;
         results_400.background_sys = 230.;
         results_400.signal_sys = 0.;
-        results_400.n_signal = _num400;
+        results_400.n_signal = _num400.sumw;
+        results_400.n_signal_sq = _num400.sumw2;
 
         SignalRegionData results_450;
         results_450.analysis_name = "Analysis_CMS_MONOJET_20invfb";
@@ -257,7 +239,8 @@ namespace Gambit {
         results_450.n_background = 2050.;
         results_450.background_sys = 150.;
         results_450.signal_sys = 0.;
-        results_450.n_signal = _num450;
+        results_450.n_signal = _num450.sumw;
+        results_450.n_signal_sq = _num450.sumw2;
 
         SignalRegionData results_500;
         results_500.analysis_name = "Analysis_CMS_MONOJET_20invfb";
@@ -266,7 +249,8 @@ namespace Gambit {
         results_500.n_background = 1040.;
         results_500.background_sys = 100.;
         results_500.signal_sys = 0.;
-        results_500.n_signal = _num500;
+        results_500.n_signal = _num500.sumw;
+        results_500.n_signal_sq = _num500.sumw2;
 
         SignalRegionData results_550;
         results_550.analysis_name = "Analysis_CMS_MONOJET_20invfb";
@@ -275,7 +259,8 @@ namespace Gambit {
         results_550.n_background = 509.;
         results_550.background_sys = 66.;
         results_550.signal_sys = 0.;
-        results_550.n_signal = _num550;
+        results_550.n_signal = _num550.sumw;
+        results_550.n_signal_sq = _num550.sumw2;
 
         add_result(results_250);
         add_result(results_300);
@@ -18,7 +18,7 @@ namespace Gambit {
 
       // Variables that holds the number of events passing
       // signal region cuts
-      double _numSR;
+      WeightedCount _numSR;
 	
     public:
 
@@ -26,7 +26,7 @@ namespace Gambit {
 
         // Set number of events passing cuts to zero upon initialisation
 
-	_numSR=0;
+	_numSR = WeightedCount();
 
 	// Set the LHC luminosity
         set_luminosity(20.3);
@@ -43,18 +43,9 @@ namespace Gambit {
         // Now define vectors of baseline objects,  including:
 	// - retrieval of electron, muon and jets from the event)
 	// - application of basic pT and eta cuts
-        vector<HEPUtils::Particle*> baselineElectrons;
-        for (HEPUtils::Particle* electron : event->electrons()) {
-          if (electron->pT() > 10. && fabs(electron->eta()) < 2.47) baselineElectrons.push_back(electron);
-        }
-        vector<HEPUtils::Particle*> baselineMuons;
-        for (HEPUtils::Particle* muon : event->muons()) {
-          if (muon->pT() > 10. && fabs(muon->eta()) < 2.4) baselineMuons.push_back(muon);
-        }
-        vector<HEPUtils::Jet*> baselineJets;
-        for (HEPUtils::Jet* jet : event->jets()) {
-          if (jet->pT() > 20. && fabs(jet->eta()) < 4.5) baselineJets.push_back(jet);
-        }
+        const vector<HEPUtils::Particle*>& baselineElectrons = preselection().electrons(10., 2.47);
+        const vector<HEPUtils::Particle*>& baselineMuons = preselection().muons(10., 2.4);
+        const vector<HEPUtils::Jet*>& baselineJets = preselection().jets(20., 4.5);
 
 	// Could add ATLAS style overlap removal here
 	// See Analysis_ATLAS_0LEP_20invfb for example
@@ -71,13 +62,13 @@ namespace Gambit {
 	// Increment number of events passing signal region cuts
 	// Dummy signal region: need 2 jets, met > 150 and no leptons
 
-	if((nElectrons+nMuons)==0 && nJets==2 && met>150.)_numSR++;
+	if((nElectrons+nMuons)==0 && nJets==2 && met>150.)_numSR.fill(event->weight());
 
       }
       
       
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region number and total # events combination across threads
+        // The base class add function only adds the total # events, and drops the collected results: they are collected again from the counters added here.
         HEPUtilsAnalysis::add(other);
 	
         Analysis_Minimum* specificOther
@@ -100,7 +91,8 @@ namespace Gambit {
         results_SR.n_background = 95.; // set number of predicted background events (in LHC paper)
         results_SR.background_sys = 9.5; // set background uncertainty (in LHC paper)
         results_SR.signal_sys = 0.; // set signal uncertainty
-        results_SR.n_signal = _numSR; // set this to number of signal events incremented in the analysis above
+        results_SR.n_signal = _numSR.sumw; // set this to number of signal events incremented in the analysis above
+        results_SR.n_signal_sq = _numSR.sumw2;
         add_result(results_SR);
 	
       }
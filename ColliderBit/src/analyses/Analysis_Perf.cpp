@@ -344,7 +344,7 @@ namespace Gambit {
 
       /// @todo -> *const* other?
       void add(BaseAnalysis* other) {
-        // The base class add function handles the signal region vector and total # events.
+        // The base class add function only adds the total # events, and drops the collected results.
         HEPUtilsAnalysis::add(other);
 
         // Add the subclass member variables
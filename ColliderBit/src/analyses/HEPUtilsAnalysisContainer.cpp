@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <unordered_map>
 #include "gambit/ColliderBit/ColliderBit_macros.hpp"
 #include "gambit/ColliderBit/analyses/HEPUtilsAnalysisContainer.hpp"
 
@@ -26,26 +27,41 @@ namespace Gambit
     DECLARE_ANALYSIS_FACTORY(Perf);
     /// @}
 
+    /// Factories by analysis name, using #ANALYSIS_FACTORY_ENTRY(ANAME)
+    typedef HEPUtilsAnalysis* (*AnalysisFactory)();
+    const std::unordered_map<std::string, AnalysisFactory> analysisFactories =
+    {
+      ANALYSIS_FACTORY_ENTRY(Minimum),
+      ANALYSIS_FACTORY_ENTRY(ATLAS_0LEP_20invfb),
+      ANALYSIS_FACTORY_ENTRY(ATLAS_13TeV_0LEP_13invfb),
+      ANALYSIS_FACTORY_ENTRY(ATLAS_0LEPStop_20invfb),
+      ANALYSIS_FACTORY_ENTRY(ATLAS_1LEPStop_20invfb),
+      ANALYSIS_FACTORY_ENTRY(ATLAS_2bStop_20invfb),
+      ANALYSIS_FACTORY_ENTRY(ATLAS_2LEPEW_20invfb),
+      ANALYSIS_FACTORY_ENTRY(ATLAS_2LEPStop_20invfb),
+      ANALYSIS_FACTORY_ENTRY(ATLAS_3LEPEW_20invfb),
+      ANALYSIS_FACTORY_ENTRY(CMS_13TeV_0LEP_13invfb),
+      ANALYSIS_FACTORY_ENTRY(CMS_1LEPDMTOP_20invfb),
+      ANALYSIS_FACTORY_ENTRY(CMS_2LEPDMTOP_20invfb),
+      ANALYSIS_FACTORY_ENTRY(CMS_3LEPEW_20invfb),
+      ANALYSIS_FACTORY_ENTRY(CMS_MONOJET_20invfb),
+      ANALYSIS_FACTORY_ENTRY(Perf),
+    };
+
     // Factory definition
     HEPUtilsAnalysis* mkAnalysis(const std::string& name)
     {
-      IF_X_RTN_CREATE_ANA_X(Minimum);
-      IF_X_RTN_CREATE_ANA_X(ATLAS_0LEP_20invfb);
-      IF_X_RTN_CREATE_ANA_X(ATLAS_13TeV_0LEP_13invfb);
-      IF_X_RTN_CREATE_ANA_X(ATLAS_0LEPStop_20invfb);
-      IF_X_RTN_CREATE_ANA_X(ATLAS_1LEPStop_20invfb);
-      IF_X_RTN_CREATE_ANA_X(ATLAS_2bStop_20invfb);
-      IF_X_RTN_CREATE_ANA_X(ATLAS_2LEPEW_20invfb);
-      IF_X_RTN_CREATE_ANA_X(ATLAS_2LEPStop_20invfb);
-      IF_X_RTN_CREATE_ANA_X(ATLAS_3LEPEW_20invfb);
-      IF_X_RTN_CREATE_ANA_X(CMS_13TeV_0LEP_13invfb);
-      IF_X_RTN_CREATE_ANA_X(CMS_1LEPDMTOP_20invfb);
-      IF_X_RTN_CREATE_ANA_X(CMS_2LEPDMTOP_20invfb);
-      IF_X_RTN_CREATE_ANA_X(CMS_3LEPEW_20invfb);
-      IF_X_RTN_CREATE_ANA_X(CMS_MONOJET_20invfb);
-      IF_X_RTN_CREATE_ANA_X(Perf);
-      throw std::runtime_error(name + " isn't a known collider analysis!");
-      return nullptr;
+      auto it = analysisFactories.find(name);
+      if (it == analysisFactories.end()) throw std::runtime_error(name + " isn't a known collider analysis!");
+      return it->second();
+    }
+
+
+    std::vector<std::string> analysisNames()
+    {
+      std::vector<std::string> names;
+      for (auto it = analysisFactories.begin(); it != analysisFactories.end(); ++it) names.push_back(it->first);
+      return names;
     }
 
 
@@ -73,6 +89,7 @@ namespace Gambit
       for (auto it = analysisNames.begin(); it != analysisNames.end(); ++it)
       {
         analyses.push_back(mkAnalysis(*it));
+        analyses.back()->set_preselection(&preselection);
       }
 
       ready=true;
@@ -83,6 +100,7 @@ namespace Gambit
     {
       assert(!analyses.empty());
       assert(ready);
+      preselection.reset(&event);
       for (auto it = analyses.begin(); it != analyses.end(); ++it)
         (*it)->analyze(event);
     }
@@ -119,8 +137,14 @@ namespace Gambit
     {
       assert(other->analyses.size() != 0);
       assert(ready);
+      assert(analyses.size() == other->analyses.size());
+      auto myIter = analyses.begin();
       auto otherIter = other->analyses.begin();
-      improve_xsec((*otherIter)->xsec(), (*otherIter)->xsec_err());
+      while (myIter != analyses.end())
+      {
+        (*myIter++)->improve_xsec((*otherIter)->xsec(), (*otherIter)->xsec_err(), (*otherIter)->num_events());
+        otherIter++;
+      }
     }
 
 
@@ -138,6 +162,22 @@ namespace Gambit
     }
 
 
+    void reduce_analyses(const std::vector<HEPUtilsAnalysisContainer*>& containers)
+    {
+      const int n = containers.size();
+      // In each round, container i takes in container i+step, for every i that is a multiple of 2*step
+      for (int step = 1; step < n; step *= 2)
+      {
+        #pragma omp parallel for schedule(static, 1)
+        for (int i = 0; i < n - step; i += 2*step)
+        {
+          containers[i]->improve_xsec(containers[i+step]);
+          containers[i]->add(containers[i+step]);
+        }
+      }
+    }
+
+
     void HEPUtilsAnalysisContainer::scale(double factor)
     {
       assert(!analyses.empty());
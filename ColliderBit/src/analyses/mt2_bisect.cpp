@@ -27,6 +27,11 @@
   3. Use mt2::get_mt2() to obtain the value of mt2:
 
      double mt2_value = mt2_event.get_mt2();       
+
+     or, if only a cut on mt2 is needed, mt2::is_above(), which bisects
+     only until the answer is known:
+
+     bool pass = mt2_event.is_above(90.);
           
 *******************************************************************************/ 
               
@@ -45,6 +50,9 @@ mt2::mt2()
    momenta_set = false;
    mt2_b  = 0.;
    scale = 1.;
+   use_threshold = false;
+   above = false;
+   threshold = 0.;
 }
 
 double mt2::get_mt2()
@@ -59,6 +67,19 @@ double mt2::get_mt2()
    return mt2_b*scale;
 }
 
+bool mt2::is_above(double threshold)
+{
+   if (momenta_set && !solved)
+   {
+      use_threshold = true;
+      this->threshold = threshold;
+      mt2_bisect();
+      use_threshold = false;
+      if (!solved) return above;   // stopped early, with the answer decided
+   }
+   return get_mt2() > threshold;
+}
+
 void mt2::set_momenta(double* pa0, double* pb0, double* pmiss0)
 {
    solved = false;     //reset solved tag when momenta are changed.
@@ -260,6 +281,14 @@ void mt2::mt2_massless()
    maxmass = sqrt(Deltasq_high+mnsq);
    while(maxmass - minmass > precision)
    {
+      // mt2 will end up in [minmass, maxmass), so if we are only asked whether it is above
+      // a threshold, we can stop as soon as both ends are on the same side of it
+      if (use_threshold && (minmass*scale > threshold || maxmass*scale <= threshold))
+      {
+         solved = false;
+         above = (minmass*scale > threshold);
+         return;
+      }
       double Delta_mid, midmass, nsols_mid;
       midmass   = (minmass+maxmass)/2.;
       Delta_mid = midmass * midmass - mnsq;
@@ -459,6 +488,15 @@ void mt2::mt2_bisect()
 
    while(sqrt(Deltasq_high+mnsq) - sqrt(Deltasq_low+mnsq) > precision)
    {
+      // Deltasq_high only ever decreases, so if we are only asked whether mt2 is above a threshold,
+      // we can stop once the upper bound is below it.  (The lower bound is not safe to stop on,
+      // as find_high may move Deltasq_high below it.)
+      if (use_threshold && sqrt(mnsq + Deltasq_high)*scale <= threshold)
+      {
+         solved = false;
+         above = false;
+         return;
+      }
       double Deltasq_mid,nsols_mid;
       //bisect
       Deltasq_mid = (Deltasq_high+Deltasq_low)/2.;
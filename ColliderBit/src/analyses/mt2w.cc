@@ -1,11 +1,13 @@
 #include "gambit/ColliderBit/mt2w.h"
 
-double calculateMT2wHepUtils(vector<HEPUtils::P4>& jets, vector<bool>& btag, HEPUtils::P4& lep, float met, float metphi){
+typedef pair<const HEPUtils::P4*, const HEPUtils::P4*> JetPairing;
+
+// The (b1, b2) jet pairings over which calculateMT2wHepUtils minimises MT2W
+static void mt2wPairings(vector<HEPUtils::P4>& jets, vector<bool>& btag, vector<JetPairing>& pairings){
 
     // I am asumming that jets is sorted by Pt
     assert ( jets.size() == btag.size() );
-    // require at least 2 jets
-    if ( jets.size()<2 ) return 99999.; 
+    pairings.clear();
 
     // First we count the number of b-tagged jets, and separate those non b-tagged
     std::vector<int> bjets;
@@ -31,52 +33,90 @@ double calculateMT2wHepUtils(vector<HEPUtils::P4>& jets, vector<bool>& btag, HEP
     if (n_btag == 0){                  //  0 b-tags
         // If no b-jets select the minimum of the mt2w from all combinations with 
         // the three leading jets
-        float min_mt2w = 9999;
-
         for (int i=0; i<nMax; i++)
             for (int j=0; j<nMax; j++){
                 if (i == j) continue;
-                float c_mt2w = mt2wWrapperHepUtils(lep, 
-                        jets[non_bjets[i]],
-                        jets[non_bjets[j]], met, metphi);
-                if (c_mt2w < min_mt2w)
-                    min_mt2w = c_mt2w;
+                pairings.push_back(JetPairing(&jets[non_bjets[i]], &jets[non_bjets[j]]));
             }
-        return min_mt2w;
 
     } else if (n_btag == 1 ){          //  1 b-tags
         // if only one b-jet choose the three non-b leading jets and choose the smaller
-        float min_mt2w = 9999;
-
-        for (int i=0; i<nMax; i++){
-            float c_mt2w = mt2wWrapperHepUtils(lep, jets[bjets[0]], jets[non_bjets[i]], met, metphi);
-            if (c_mt2w < min_mt2w)
-                min_mt2w = c_mt2w;
-        }
-        for (int i=0; i<nMax; i++){
-            float c_mt2w = mt2wWrapperHepUtils(lep, jets[non_bjets[i]], jets[bjets[0]], met, metphi);
-            if (c_mt2w < min_mt2w)
-                min_mt2w = c_mt2w;
-        }
-        return min_mt2w;
+        for (int i=0; i<nMax; i++)
+            pairings.push_back(JetPairing(&jets[bjets[0]], &jets[non_bjets[i]]));
+        for (int i=0; i<nMax; i++)
+            pairings.push_back(JetPairing(&jets[non_bjets[i]], &jets[bjets[0]]));
 
     } else if (n_btag >= 2) {          // >=2 b-tags
         // if 3 or more b-jets the paper says ignore b-tag and do like 0-bjets 
         // but we are going to make the combinations with the b-jets
-        float min_mt2w = 9999;
         for (int i=0; i<n_btag; i++)
             for (int j=0; j<n_btag; j++){
                 if (i == j) continue;
-                float c_mt2w = mt2wWrapperHepUtils(lep, 
-                        jets[bjets[i]],
-                        jets[bjets[j]], met, metphi);
-                if (c_mt2w < min_mt2w)
-                    min_mt2w = c_mt2w;
+                pairings.push_back(JetPairing(&jets[bjets[i]], &jets[bjets[j]]));
             }
-        return min_mt2w;
     }
+}
+
+double calculateMT2wHepUtils(vector<HEPUtils::P4>& jets, vector<bool>& btag, HEPUtils::P4& lep, float met, float metphi){
+
+    // require at least 2 jets
+    if ( jets.size()<2 ) return 99999.; 
+
+    // Select the minimum of the mt2w over the jet pairings
+    vector<JetPairing> pairings;
+    vector<double> mt2ws;
+    mt2wPairings(jets, btag, pairings);
+    mt2wBatchHepUtils(lep, pairings, met, metphi, mt2ws);
+
+    float min_mt2w = 9999;
+    for (size_t i=0; i<mt2ws.size(); i++){
+        float c_mt2w = mt2ws[i];
+        if (c_mt2w < min_mt2w)
+            min_mt2w = c_mt2w;
+    }
+    return min_mt2w;
+}
+
+bool mt2wAboveHepUtils(vector<HEPUtils::P4>& jets, vector<bool>& btag, HEPUtils::P4& lep, float met, float metphi, double cut){
+
+    // require at least 2 jets
+    if ( jets.size()<2 ) return 99999. > cut;
+
+    // The minimum (kept in a float, starting from 9999) is above the cut only if every pairing is
+    float no_pairing = 9999;
+    if (!(no_pairing > cut)) return false;
+
+    vector<JetPairing> pairings;
+    mt2wPairings(jets, btag, pairings);
+
+    float metx = met * cos( metphi );
+    float mety = met * sin( metphi );
+    mt2w_bisect::mt2w mt2w_event;
+    for (size_t i=0; i<pairings.size(); i++){
+        mt2w_event.set_momenta(lep.E(), lep.px(), lep.py(), lep.pz(),
+                               pairings[i].first->E(), pairings[i].first->px(), pairings[i].first->py(), pairings[i].first->pz(),
+                               pairings[i].second->E(), pairings[i].second->px(), pairings[i].second->py(), pairings[i].second->pz(),
+                               metx, mety);
+        if (!mt2w_event.is_above(cut, true)) return false;
+    }
+    return true;
+}
 
-    return -1.;
+void mt2wBatchHepUtils(HEPUtils::P4& lep, vector<JetPairing>& pairings, float met, float metphi, vector<double>& results){
+
+    // same for all pairings
+    float metx = met * cos( metphi );
+    float mety = met * sin( metphi );
+
+    results.resize(pairings.size());
+    mt2w_bisect::mt2w mt2w_event;
+    for (size_t i=0; i<pairings.size(); i++){
+        mt2w_event.set_momenta(lep.E(), lep.px(), lep.py(), lep.pz(),
+                               pairings[i].first->E(), pairings[i].first->px(), pairings[i].first->py(), pairings[i].first->pz(),
+                               pairings[i].second->E(), pairings[i].second->px(), pairings[i].second->py(), pairings[i].second->pz(),
+                               metx, mety);
+        results[i] = mt2w_event.get_mt2w();
+    }
 }
 
 // This funcion is a wrapper for mt2w_bisect etc that takes HEPUtils::P4 vectors instead of doubles
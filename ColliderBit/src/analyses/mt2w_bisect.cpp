@@ -30,6 +30,11 @@
   3. Use mt2w::get_mt2w() to obtain the value of mt2w:
 
      double mt2w_value = mt2w_event.get_mt2w();       
+
+     or, if only a cut on mt2w is needed, mt2w::is_above(), which bisects
+     only until the answer is known:
+
+     bool pass = mt2w_event.is_above(300.);
           
 *******************************************************************************/ 
               
@@ -46,6 +51,10 @@ mt2w::mt2w(double upper_bound, double error_value, double scan_step)
 {
    solved = false;
    momenta_set = false;
+   use_threshold = false;
+   threshold_float = false;
+   above = false;
+   threshold = 0.;
    mt2w_b  = 0.;  // The result field.  Start it off at zero.
    this->upper_bound = upper_bound;  // the upper bound of search for MT2W, default value is 500 GeV 
    this->error_value = error_value;  // if we couldn't find any compatible region below the upper_bound, output mt2w = error_value;
@@ -64,6 +73,22 @@ double mt2w::get_mt2w()
    return mt2w_b;
 }
 
+bool mt2w::is_above(double threshold, bool single_precision)
+{
+   if (momenta_set && !solved)
+   {
+      use_threshold = true;
+      this->threshold = threshold;
+      threshold_float = single_precision;
+      mt2w_bisect();
+      use_threshold = false;
+      if (!solved) return above;   // stopped early, with the answer decided
+   }
+   double result = get_mt2w();
+   if (single_precision) result = (float) result;
+   return result > threshold;
+}
+
 
 void mt2w::set_momenta(double *pl, double *pb1, double *pb2, double* pmiss)
 {
@@ -146,6 +171,26 @@ void mt2w::set_momenta(double El,  double plx,  double ply,  double plz,
 
    if (ABSOLUTE_PRECISION > 100.*RELATIVE_PRECISION) precision = ABSOLUTE_PRECISION;
    else precision = 100.*RELATIVE_PRECISION;
+
+//the parts of the coefficients in teco that do not depend on the trial top mass
+
+	ETb2sq = Eb2sq - pb2z*pb2z;  //transverse energy of b2
+	del1 = mw*mw - mv*mv - mlsq;
+	Elb1 = El*Eb1-plx*pb1x-ply*pb1y-plz*pb1z;
+
+	aa = (El*pb1x-Eb1*plx)/(Eb1*plz-El*pb1z);
+	bb = (El*pb1y-Eb1*ply)/(Eb1*plz-El*pb1z);
+	cc_den = 2.*Eb1*plz-2.*El*pb1z;
+
+	pb1xa = pb1x+pb1z*aa;
+	pb1yb = pb1y+pb1z*bb;
+	a1 = Eb1sq*(1.+aa*aa)-pb1xa*pb1xa;
+	b1 = Eb1sq*aa*bb - pb1xa*pb1yb;
+	c1 = Eb1sq*(1.+bb*bb)-pb1yb*pb1yb;
+
+	a2 = 1-pb2x*pb2x/(ETb2sq);
+	b2 = -pb2x*pb2y/(ETb2sq);
+	c2 = 1-pb2y*pb2y/(ETb2sq);
 }
 
 
@@ -176,6 +221,9 @@ void mt2w::mt2w_bisect()
 
 		mtop_low=mtop_high;
 		mtop_high = mtop_high + scan_step;
+
+		// From here mt2w can only be error_value, or between mtop_low and upper_bound
+		if (use_threshold && threshold_decides(fmin(mtop_low, error_value), fmax(upper_bound, error_value))) return;
 	}
 	
 	// if we can not find a compatible region under the upper bound, output the error value
@@ -187,6 +235,9 @@ void mt2w::mt2w_bisect()
     // Once we have an compatible mtop_high, we can find mt2w using bisection method
    while(mtop_high - mtop_low > precision)
    {
+      // mt2w will end up in [mtop_low, mtop_high]
+      if (use_threshold && threshold_decides(mtop_low, mtop_high)) return;
+
       double mtop_mid,teco_mid;
       //bisect
       mtop_mid = (mtop_high+mtop_low)/2.;
@@ -201,6 +252,20 @@ void mt2w::mt2w_bisect()
 }
 
 
+// when is_above is only asking whether mt2w > threshold, and mt2w is known to lie in [lowest, highest],
+// stop the search if that decides it.
+
+bool mt2w::threshold_decides(double lowest, double highest)
+{
+   if (threshold_float) {lowest = (float) lowest; highest = (float) highest;}
+   if (lowest > threshold) {above = true;}
+   else if (highest <= threshold) {above = false;}
+   else return false;
+   solved = false;   // the value itself is still unknown
+   return true;
+}
+
+
 // for a given event, teco ( mtop ) gives 1 if trial top mass mtop is compatible, 0 if mtop is not.
 	
 int mt2w::teco(  double mtop)
@@ -211,21 +276,18 @@ int mt2w::teco(  double mtop)
 	if (mtop < mb1+mw || mtop < mb2+mw) {return 0;}
 
 //define delta for convenience, note the definition is different from the one in mathematica code by 2*E^2_{b2}
+//(ETb2sq is the transverse energy of b2, set with the momenta)
 	  	
-	double ETb2sq = Eb2sq - pb2z*pb2z;  //transverse energy of b2
 	double delta = (mtop*mtop-mw*mw-mb2sq)/(2.*ETb2sq);
 	
 	
-//del1 and del2 are \Delta'_1 and \Delta'_2 in the notes eq. 10,11
+//del1 and del2 are \Delta'_1 and \Delta'_2 in the notes eq. 10,11 (del1 is set with the momenta)
 	
-	double del1 = mw*mw - mv*mv - mlsq;
-	double del2 = mtop*mtop - mw*mw - mb1sq - 2*(El*Eb1-plx*pb1x-ply*pb1y-plz*pb1z);
+	double del2 = mtop*mtop - mw*mw - mb1sq - 2*Elb1;
 	
-// aa bb cc are A B C in the notes eq.15
+// aa bb cc are A B C in the notes eq.15 (aa and bb are set with the momenta)
 	
-	double aa = (El*pb1x-Eb1*plx)/(Eb1*plz-El*pb1z);
-	double bb = (El*pb1y-Eb1*ply)/(Eb1*plz-El*pb1z);
-	double cc = (El*del2-Eb1*del1)/(2.*Eb1*plz-2.*El*pb1z);
+	double cc = (El*del2-Eb1*del1)/cc_den;
 	
   
 //calculate coefficients for the two quadratic equations (ellipses), which are
@@ -235,12 +297,10 @@ int mt2w::teco(  double mtop)
 //  a2 x^2 + 2 b2 x y + c2 y^2 + 2 d2 x + 2 e2 y + f2 <= 0 , from the 1 stop decay chain (with W missing)
 //
 //  where x and y are px and py of the neutrino on the visible lepton chain
+//  (a1 b1 c1 and a2 b2 c2 do not depend on mtop, and are set with the momenta)
 
-	a1 = Eb1sq*(1.+aa*aa)-(pb1x+pb1z*aa)*(pb1x+pb1z*aa);
-	b1 = Eb1sq*aa*bb - (pb1x+pb1z*aa)*(pb1y+pb1z*bb);
-	c1 = Eb1sq*(1.+bb*bb)-(pb1y+pb1z*bb)*(pb1y+pb1z*bb);
-	d1 = Eb1sq*aa*cc - (pb1x+pb1z*aa)*(pb1z*cc+del2/2.0);
-	e1 = Eb1sq*bb*cc - (pb1y+pb1z*bb)*(pb1z*cc+del2/2.0);
+	d1 = Eb1sq*aa*cc - pb1xa*(pb1z*cc+del2/2.0);
+	e1 = Eb1sq*bb*cc - pb1yb*(pb1z*cc+del2/2.0);
 	f1 = Eb1sq*(mv*mv+cc*cc) - (pb1z*cc+del2/2.0)*(pb1z*cc+del2/2.0);
 	
 //  First check if ellipse 1 is real (don't need to do this for ellipse 2, ellipse 2 is always real for mtop > mw+mb)
@@ -251,10 +311,6 @@ int mt2w::teco(  double mtop)
 	
 //coefficients of the ellptical region
 	
-	a2 = 1-pb2x*pb2x/(ETb2sq);
-	b2 = -pb2x*pb2y/(ETb2sq);
-	c2 = 1-pb2y*pb2y/(ETb2sq);
-	
 	// d2o e2o f2o are coefficients in the p2x p2y plane (p2 is the momentum of the missing W-boson)
 	// it is convenient to calculate them first and transfer the ellipse to the p1x p1y plane
 	d2o = -delta*pb2x;
@@ -5,7 +5,6 @@
 ///  Class function definitions and specialization init functions for SpecializablePythia.
 
 #include <stdexcept>
-#include <sstream>
 #include "gambit/ColliderBit/colliders/SpecializablePythia.hpp"
 #include "gambit/ColliderBit/ColliderBit_macros.hpp"
 
@@ -74,11 +73,18 @@ namespace Gambit
 
 
 
+    /// Settings that change from one parameter point to the next.  These are given to each new
+    /// Pythia instance rather than to the long-lived base instance.
+    static bool isPointSetting(const std::string& command)
+    {
+      return command.compare(0, 11, "Random:seed") == 0;
+    }
+
     SpecializablePythia::~SpecializablePythia()
     {
       _pythiaSettings.clear();
       if (_pythiaInstance) delete _pythiaInstance;
-      if (_pythiaBase) delete _pythiaBase;
+      for (auto& base : _pythiaBases) delete base.second;
     }
 
     void SpecializablePythia::clear()
@@ -104,21 +110,7 @@ namespace Gambit
       // Specialized settings:
       _specialInit(this);
 
-      if (!_pythiaBase)
-      {
-        _pythiaBase = new Pythia8::Pythia(pythiaDocPath, false);
-      }
-      // Pass all settings to _pythiaBase
-      for(const auto command : _pythiaSettings) _pythiaBase->readString(command);
-
-      // Create new _pythiaInstance from _pythiaBase
-      if (_pythiaInstance) delete _pythiaInstance;
-      _pythiaInstance = new Pythia8::Pythia(_pythiaBase->particleData, _pythiaBase->settings);
-
-      // Send along the SLHAea::Coll pointer, if it exists
-      if (slhaea) _pythiaInstance->slhaInterface.slha.setSLHAea(slhaea);
-
-      if (!_pythiaInstance->init(os)) throw InitializationError();
+      _initInstance(pythiaDocPath, slhaea, os);
     }
 
     void SpecializablePythia::init(const std::string pythiaDocPath,
@@ -130,27 +122,75 @@ namespace Gambit
       // Specialized settings:
       _specialInit(this);
 
-      if (!_pythiaBase)
+      _initInstance(pythiaDocPath, slhaea, os);
+    }
+
+    void SpecializablePythia::_initInstance(const std::string& pythiaDocPath,
+                                            const SLHAea::Coll* slhaea, std::ostream& os)
+    {
+      // Split the settings into those common to all points and those for this point only
+      std::vector<std::string> baseSettings, pointSettings;
+      for(const auto command : _pythiaSettings)
+      {
+        if (isPointSetting(command)) pointSettings.push_back(command);
+        else baseSettings.push_back(command);
+      }
+
+      // Get the base instance for this specialization, reading the xml documentation
+      // only the first time it is needed
+      Pythia8::Pythia*& base = _pythiaBases[_specName];
+      std::vector<std::string>& appliedSettings = _pythiaBaseSettings[_specName];
+      if (!base)
+      {
+        base = new Pythia8::Pythia(pythiaDocPath, false);
+        appliedSettings.clear();
+      }
+      _pythiaBase = base;
+
+      // Pass the common settings to the base instance, unless it already has exactly these
+      if (baseSettings != appliedSettings)
       {
-        _pythiaBase = new Pythia8::Pythia(pythiaDocPath, false);
+        for(const auto command : baseSettings) _pythiaBase->readString(command);
+        appliedSettings = baseSettings;
       }
-      // Pass all settings to _pythiaBase
-      for(const auto command : _pythiaSettings) _pythiaBase->readString(command);
 
-      // Create new _pythiaInstance from _pythiaBase
+      // Create new _pythiaInstance from _pythiaBase, and give it the settings for this point
       if (_pythiaInstance) delete _pythiaInstance;
       _pythiaInstance = new Pythia8::Pythia(_pythiaBase->particleData, _pythiaBase->settings);
+      for(const auto command : pointSettings) _pythiaInstance->readString(command);
 
       // Send along the SLHAea::Coll pointer, if it exists
       if (slhaea) _pythiaInstance->slhaInterface.slha.setSLHAea(slhaea);
 
-      if (!_pythiaInstance->init(os)) throw InitializationError();
+      bool initialized = _pythiaInstance->init(os);
+      _readProcessXsecEstimates();
+
+      if (!initialized) throw InitializationError();
+    }
+
+    void SpecializablePythia::_readProcessXsecEstimates()
+    {
+      // Pythia's ProcessLevel stores the code and maximum cross-section (in mb) of each
+      // subprocess in these settings when it initializes (see the Gambit Pythia patch).
+      _processXsecEstimates.clear();
+      Pythia8::Settings& settings = _pythiaInstance->settings;
+      if (!settings.isMVec("Gambit:processCodes") or !settings.isPVec("Gambit:processSigmaMax")) return;
+      std::vector<int> codes = settings.mvec("Gambit:processCodes");
+      std::vector<double> sigmaMax = settings.pvec("Gambit:processSigmaMax");
+      for (size_t i = 0; i < codes.size() and i < sigmaMax.size(); ++i)
+      {
+        ProcessXsecEstimate estimate;
+        estimate.code = codes[i];
+        estimate.xsecMax_pb = sigmaMax[i] * 1e9;
+        _processXsecEstimates.push_back(estimate);
+      }
     }
 
     void SpecializablePythia::resetSpecialization(const std::string& specName)
     {
 
       clear();
+      _specName = specName;
       IF_X_SPECIALIZEX(Pythia_external)
       IF_X_SPECIALIZEX(Pythia_SUSY_LHC_8TeV)
       IF_X_SPECIALIZEX(Pythia_glusq_LHC_8TeV)
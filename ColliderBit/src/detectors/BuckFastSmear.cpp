@@ -26,8 +26,8 @@ namespace Gambit {
   namespace ColliderBit {
 
 
-    /// BuckFastIdentity definition
-    void BuckFastIdentity::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
+    /// BuckFastBase conversion, common to all BuckFast detectors
+    void BuckFastBase::convertEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
       if (partonOnly)
         convertPythia8PartonEvent(eventIn, eventOut);
       else
@@ -35,13 +35,12 @@ namespace Gambit {
     }
 
 
-    /// BuckFastSmearATLAS definitions
-    void BuckFastSmearATLAS::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
-      if (partonOnly)
-        convertPythia8PartonEvent(eventIn, eventOut);
-      else
-        convertPythia8ParticleEvent(eventIn, eventOut);
+    /// BuckFastIdentity definition
+    void BuckFastIdentity::smearEvent(HEPUtils::Event&) const { }
+
 
+    /// BuckFastSmearATLAS definitions
+    void BuckFastSmearATLAS::smearEvent(HEPUtils::Event& eventOut) const {
       // Electron smearing and efficiency
       /// @todo Run-dependence?
       ATLAS::applyElectronTrackingEff(eventOut.electrons());
@@ -70,12 +69,7 @@ namespace Gambit {
 
 
     /// BuckFastSmearCMS definition
-    void BuckFastSmearCMS::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
-      if (partonOnly)
-        convertPythia8PartonEvent(eventIn, eventOut);
-      else
-        convertPythia8ParticleEvent(eventIn, eventOut);
-
+    void BuckFastSmearCMS::smearEvent(HEPUtils::Event& eventOut) const {
       //MJW debug- make this the same as ATLAS temporarily
       // Electron smearing and efficiency
       CMS::applyElectronTrackingEff(eventOut.electrons());
@@ -165,8 +159,12 @@ namespace Gambit {
         }
       }
 
+      // Classify the ancestry of all particles at once
+      if (!recursiveAncestry) ancestry.classify(pevt);
+
       // Loop over final state particles for jet inputs and MET
-      std::vector<FJNS::PseudoJet> jetparticles;
+      std::vector<FJNS::PseudoJet>& jetparticles = jetWorkspace.particles();
+      jetparticles.clear();
       for (int i = 0; i < pevt.size(); ++i) {
         const Pythia8::Particle& p = pevt[i];
 
@@ -193,7 +191,7 @@ namespace Gambit {
         }
 
         // Promptness: for leptons and photons we're only interested if they don't come from hadron/tau decays
-        const bool prompt = !fromHadron(i, pevt); //&& !fromTau(i, pevt);
+        const bool prompt = recursiveAncestry ? !fromHadron(i, pevt) : ancestry.prompt(i); //&& !ancestry.fromTau(i);
         const bool visible = MCUtils::PID::isStrongInteracting(p.id()) || MCUtils::PID::isEMInteracting(p.id());
 
         // Add prompt and invisible particles as individual particles
@@ -209,14 +207,12 @@ namespace Gambit {
 
       /// Jet finding
       /// @todo Choose jet algorithm via detector _settings? Run several algs?
-      const FJNS::JetDefinition jet_def(FJNS::antikt_algorithm, antiktR);
-      FJNS::ClusterSequence cseq(jetparticles, jet_def);
-      std::vector<FJNS::PseudoJet> pjets = sorted_by_pt(cseq.inclusive_jets(10));
+      const std::vector<FJNS::PseudoJet>& pjets = jetWorkspace.cluster(antiktR, 10);
 
       /// Do jet b-tagging, etc. and add to the Event
       /// @todo Use ghost tagging?
       /// @note We need to _remove_ this b-tag in the detector sim if outside the tracker acceptance!
-      for (auto& pj : pjets) {
+      for (const FJNS::PseudoJet& pj : pjets) {
         HEPUtils::P4 jetMom = HEPUtils::mk_p4(pj);
 
         /// @todo Replace with HEPUtils::any(bhadrons, [&](const auto& pb){ pj.delta_R(pb) < 0.4 })
@@ -305,7 +301,8 @@ namespace Gambit {
         }
       }
 
-      std::vector<FJNS::PseudoJet> jetparticles; //< Pseudojets for input to FastJet
+      std::vector<FJNS::PseudoJet>& jetparticles = jetWorkspace.particles(); //< Pseudojets for input to FastJet
+      jetparticles.clear();
       HEPUtils::P4 pout; //< Sum of momenta outside acceptance
 
       // Make a single pass over the event to gather final leptons, partons, and photons
@@ -346,9 +343,7 @@ namespace Gambit {
 
       /// Jet finding
       /// @todo choose jet algorithm via _settings?
-      const FJNS::JetDefinition jet_def(FJNS::antikt_algorithm, antiktR);
-      FJNS::ClusterSequence cseq(jetparticles, jet_def);
-      std::vector<FJNS::PseudoJet> pjets = sorted_by_pt(cseq.inclusive_jets(10));
+      const std::vector<FJNS::PseudoJet>& pjets = jetWorkspace.cluster(antiktR, 10);
       // Add to the event, with b-tagging info"
       for (const FJNS::PseudoJet& pj : pjets) {
         // Do jet b-tagging, etc. by looking for b quark constituents (i.e. user index = |parton ID| = 5)
@@ -1,10 +1,13 @@
 #include "gambit/ColliderBit/detectors/DelphesVanilla.hpp"
 #ifndef EXCLUDE_DELPHES
 
+#include <unordered_map>
+
 #include "TROOT.h"
 #include "TTask.h"
 #include "TApplication.h"
 #include "TObjArray.h"
+#include "TRandom.h"
 #include "TDatabasePDG.h"
 #include "TParticlePDG.h"
 #include "TLorentzVector.h"
@@ -31,6 +34,11 @@ namespace Gambit {
         allParticleOutputArray(nullptr),
         stableParticleOutputArray(nullptr),
         partonOutputArray(nullptr),
+        missingETArray(nullptr),
+        photonArray(nullptr),
+        electronArray(nullptr),
+        muonArray(nullptr),
+        jetArray(nullptr),
         pdg(nullptr) {}
 
       ~DelphesVanillaImpl() {
@@ -59,44 +67,88 @@ namespace Gambit {
       TObjArray *stableParticleOutputArray;
       TObjArray *partonOutputArray;
 
+      // Delphes particle arrays: Post-Detector-Sim
+      const TObjArray *missingETArray;
+      const TObjArray *photonArray;
+      const TObjArray *electronArray;
+      const TObjArray *muonArray;
+      const TObjArray *jetArray;
+
       // Database of PDG codes and particle info
       TDatabasePDG *pdg;
 
+      /// Particle info by PDG code, as looked up in the database so far (null if not there)
+      std::unordered_map<int, TParticlePDG*> pdgParticles;
+
+      /// Particle info of PDG code @a id, or null if the database does not have it
+      TParticlePDG* getParticle(int id) {
+        std::unordered_map<int, TParticlePDG*>::const_iterator it = pdgParticles.find(id);
+        if (it != pdgParticles.end()) return it->second;
+        return pdgParticles[id] = pdg->GetParticle(id);
+      }
+
     };
 
 
 
     void DelphesVanilla::init(const vector<string>& settings) {
+      // Reuse the Delphes chain of this config file if it has been set up before
+      const string configFilename = settings[0];
+      map<string, DelphesVanillaImpl*>::const_iterator it = _impls.find(configFilename);
+      if (it != _impls.end()) {
+        _impl = it->second;
+        // Initialising a chain seeds ROOT's global random generator from the card.  Seed it again here,
+        // as a new chain would, so that the smearing does not depend on the cards and points run before.
+        gRandom->SetSeed(_impl->confReader->GetInt("::RandomSeed", 0));
+        return;
+      }
+
       // Create the implementation object, for PIMPL abstraction
       _impl = new DelphesVanillaImpl();
 
-      // To read Delphes Config File
-      const string configFilename = settings[0];
-      _impl->confReader = new ExRootConfReader();
-      _impl->confReader->ReadFile(configFilename.c_str());
+      try {
+        // To read Delphes Config File
+        _impl->confReader = new ExRootConfReader();
+        _impl->confReader->ReadFile(configFilename.c_str());
 
-      // Modularity of Delphes set by Config File
-      _impl->modularDelphes = new Delphes("Delphes");
-      _impl->modularDelphes->SetConfReader(_impl->confReader);
+        // Modularity of Delphes set by Config File
+        _impl->modularDelphes = new Delphes("Delphes");
+        _impl->modularDelphes->SetConfReader(_impl->confReader);
 
-      // Factory production of particle "candidates"
-      _impl->factory = _impl->modularDelphes->GetFactory();
+        // Factory production of particle "candidates"
+        _impl->factory = _impl->modularDelphes->GetFactory();
 
-      // Delphes particle arrays: Pre-Detector-Sim
-      _impl->allParticleOutputArray = _impl->modularDelphes->ExportArray("allParticles");
-      _impl->stableParticleOutputArray = _impl->modularDelphes->ExportArray("stableParticles");
-      _impl->partonOutputArray = _impl->modularDelphes->ExportArray("partons");
+        // Delphes particle arrays: Pre-Detector-Sim
+        _impl->allParticleOutputArray = _impl->modularDelphes->ExportArray("allParticles");
+        _impl->stableParticleOutputArray = _impl->modularDelphes->ExportArray("stableParticles");
+        _impl->partonOutputArray = _impl->modularDelphes->ExportArray("partons");
 
-      // Database of PDG codes and particle info
-      _impl->pdg = TDatabasePDG::Instance();
+        // Database of PDG codes and particle info
+        _impl->pdg = TDatabasePDG::Instance();
+
+        _impl->modularDelphes->InitTask();
 
-      _impl->modularDelphes->InitTask();
+        // Delphes particle arrays: Post-Detector-Sim.  These only exist once the modules are initialised.
+        _impl->missingETArray = _impl->modularDelphes->ImportArray("MissingET/momentum");
+        _impl->photonArray = _impl->modularDelphes->ImportArray("PhotonIsolation/photons");
+        _impl->electronArray = _impl->modularDelphes->ImportArray("ElectronIsolation/electrons");
+        _impl->muonArray = _impl->modularDelphes->ImportArray("MuonIsolation/muons");
+        _impl->jetArray = _impl->modularDelphes->ImportArray("FastJetFinder/jets");
+      }
+      catch (...) {
+        // Do not keep a half-built chain
+        delete _impl;
+        _impl = nullptr;
+        throw;
+      }
+      _impls[configFilename] = _impl;
     }
 
 
     void DelphesVanilla::clear() {
-      if(_impl)
-        delete _impl;
+      for (map<string, DelphesVanillaImpl*>::iterator it = _impls.begin(); it != _impls.end(); ++it)
+        delete it->second;
+      _impls.clear();
       _impl = nullptr;
     }
 
@@ -115,7 +167,7 @@ namespace Gambit {
         pdgCode = abs(candidate->PID);
 
         candidate->Status = p.status();
-        pdgParticle = _impl->pdg->GetParticle(p.id());
+        pdgParticle = _impl->getParticle(p.id());
 
         candidate->Charge = pdgParticle ? Int_t(pdgParticle->Charge()/3.0) : -999;
         candidate->Mass = pdgParticle ? pdgParticle->Mass() : -999.9;
@@ -143,7 +195,7 @@ namespace Gambit {
       HEPUtils::Jet *recoJet;
       // Delphes particle arrays: Post-Detector Sim
       //    MISSING ET:
-      const TObjArray *arrayMissingET = _impl->modularDelphes->ImportArray("MissingET/momentum");
+      const TObjArray *arrayMissingET = _impl->missingETArray;
       if ((candidate = static_cast<Candidate*>(arrayMissingET->At(0)))) {
         const TLorentzVector &momentum = candidate->Momentum;
         event.set_missingmom(HEPUtils::P4::mkXYZM(-1*momentum.Px(), -1*momentum.Py(), 0., 0.));
@@ -151,10 +203,9 @@ namespace Gambit {
 
       // Delphes particle arrays: Post-Detector Sim
       //    PHOTONS:
-      const TObjArray *arrayPhotons = _impl->modularDelphes->ImportArray("PhotonIsolation/photons");
-      TIter iteratorPhotons(arrayPhotons);
-      iteratorPhotons.Reset();
-      while ((candidate = static_cast<Candidate*>(iteratorPhotons.Next()))) {
+      const TObjArray *arrayPhotons = _impl->photonArray;
+      for (Int_t i = 0; i < arrayPhotons->GetEntriesFast(); ++i) {
+        if (!(candidate = static_cast<Candidate*>(arrayPhotons->At(i)))) continue;
         const TLorentzVector &momentum = candidate->Momentum;
         recoParticle = new HEPUtils::Particle(HEPUtils::P4::mkXYZM(momentum.Px(), momentum.Py(), momentum.Pz(), 0.), MCUtils::PID::PHOTON);
         recoParticle->set_prompt(true);
@@ -163,10 +214,9 @@ namespace Gambit {
 
       // Delphes particle arrays: Post-Detector Sim
       //    ELECTRONS:
-      const TObjArray *arrayElectrons = _impl->modularDelphes->ImportArray("ElectronIsolation/electrons");
-      TIter iteratorElectrons(arrayElectrons);
-      iteratorElectrons.Reset();
-      while ((candidate = static_cast<Candidate*>(iteratorElectrons.Next()))) {
+      const TObjArray *arrayElectrons = _impl->electronArray;
+      for (Int_t i = 0; i < arrayElectrons->GetEntriesFast(); ++i) {
+        if (!(candidate = static_cast<Candidate*>(arrayElectrons->At(i)))) continue;
         const TLorentzVector &momentum = candidate->Momentum;
         recoParticle = new HEPUtils::Particle(HEPUtils::P4::mkXYZM(momentum.Px(), momentum.Py(), momentum.Pz(), 0.000510998902),
                                               -HEPUtils::sign(candidate->Charge) * MCUtils::PID::ELECTRON);
@@ -176,10 +226,9 @@ namespace Gambit {
 
       // Delphes particle arrays: Post-Detector Sim
       //    MUONS:
-      const TObjArray *arrayMuons = _impl->modularDelphes->ImportArray("MuonIsolation/muons");
-      TIter iteratorMuons(arrayMuons);
-      iteratorMuons.Reset();
-      while ((candidate = static_cast<Candidate*>(iteratorMuons.Next()))) {
+      const TObjArray *arrayMuons = _impl->muonArray;
+      for (Int_t i = 0; i < arrayMuons->GetEntriesFast(); ++i) {
+        if (!(candidate = static_cast<Candidate*>(arrayMuons->At(i)))) continue;
         const TLorentzVector &momentum = candidate->Momentum;
         recoParticle = new HEPUtils::Particle(HEPUtils::P4::mkXYZM(momentum.Px(), momentum.Py(), momentum.Pz(), 0.105658389),
                                               -HEPUtils::sign(candidate->Charge) * MCUtils::PID::MUON);
@@ -189,10 +238,9 @@ namespace Gambit {
 
       // Delphes particle arrays: Post-Detector Sim
       //    JETS and TAUS:
-      const TObjArray *arrayJets = _impl->modularDelphes->ImportArray("FastJetFinder/jets");
-      TIter iteratorJets(arrayJets);
-      iteratorJets.Reset();
-      while ((candidate = static_cast<Candidate*>(iteratorJets.Next()))) {
+      const TObjArray *arrayJets = _impl->jetArray;
+      for (Int_t i = 0; i < arrayJets->GetEntriesFast(); ++i) {
+        if (!(candidate = static_cast<Candidate*>(arrayJets->At(i)))) continue;
         const TLorentzVector &momentum = candidate->Momentum;
         if (candidate->TauTag) {
           recoParticle = new HEPUtils::Particle(HEPUtils::P4::mkXYZM(momentum.Px(), momentum.Py(), momentum.Pz(), 1e-6),
@@ -211,6 +259,7 @@ namespace Gambit {
 
 
     void DelphesVanilla::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
+      // Clearing the chain recycles the candidates of the previous event and empties its arrays
       _impl->modularDelphes->Clear();
       convertInput(eventIn);
       _impl->modularDelphes->ProcessTask();
@@ -26,6 +26,7 @@
 #include <iostream>
 #include <fstream>
 #include <math.h>
+#include <string>
 
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/Elements/mssm_slhahelp.hpp"
@@ -41,6 +42,85 @@ namespace Gambit
   namespace ColliderBit
   {
 
+    /// The charged slepton or sneutrino mass eigenstate called mass_es
+    const LEPSparticleMass& LEPSpectrumInputs::sfermion(const str& mass_es) const
+    {
+      const int i = (mass_es.size() > 0 ? mass_es[mass_es.size()-1] - '1' : -1);
+      if (mass_es.compare(0, 4, "~e-_") == 0 and mass_es.size() == 5 and i >= 0 and i < 6) return slepton[i];
+      if (mass_es.compare(0, 4, "~nu_") == 0 and mass_es.size() == 5 and i >= 0 and i < 3) return sneutrino[i];
+      ColliderBit_error().raise(LOCAL_INFO, "Not a charged slepton or sneutrino mass eigenstate: " + mass_es);
+      return slepton[0];
+    }
+
+
+    /// Retrieve the spectrum inputs to the cross-sections.
+    void get_LEP_spectrum_inputs(LEPSpectrumInputs& result, const Spectrum& spec, const double gammaZ)
+    {
+      static const int neutid[4] = {1000022, 1000023, 1000025, 1000035};
+      static const int charid[2] = {1000024, 1000037};
+
+      // Subspectrum
+      const SubSpectrum& mssm = spec.get_HE();
+
+      // SM parameters
+      result.mZ = spec.safeget(Par::Pole_Mass,23,0);
+      result.gammaZ = gammaZ;
+      const double g2 = mssm.safeget(Par::dimensionless,"g2");
+      result.sinW2 = mssm.safeget(Par::dimensionless,"sinW2");
+      result.alpha = 0.25*result.sinW2*g2*g2/pi;
+      // MSSM parameters
+      result.tanb = mssm.safeget(Par::dimensionless,"tanbeta");
+
+      // Get the neutralino and chargino masses
+      for (int i=0; i<4; i++)
+      {
+        result.neutralino[i].m = result.neutmass[i] = spec.safeget(Par::Pole_Mass,neutid[i],0);
+        result.neutralino[i].uncert_high = mssm.safeget(Par::Pole_Mass_1srd_high, neutid[i], 0);
+        result.neutralino[i].uncert_low = mssm.safeget(Par::Pole_Mass_1srd_low, neutid[i], 0);
+      }
+      for (int i=0; i<2; i++)
+      {
+        result.chargino[i].m = spec.safeget(Par::Pole_Mass,charid[i],0);
+        result.chargino[i].uncert_high = mssm.safeget(Par::Pole_Mass_1srd_high, charid[i], 0);
+        result.chargino[i].uncert_low = mssm.safeget(Par::Pole_Mass_1srd_low, charid[i], 0);
+        result.antichargino[i].m = spec.safeget(Par::Pole_Mass,-charid[i],0);
+        result.antichargino[i].uncert_high = mssm.safeget(Par::Pole_Mass_1srd_high, -charid[i], 0);
+        result.antichargino[i].uncert_low = mssm.safeget(Par::Pole_Mass_1srd_low, -charid[i], 0);
+      }
+
+      // Get the charged slepton and sneutrino masses
+      for (int i=0; i<6; i++)
+      {
+        const str mass_es = "~e-_" + std::to_string(i+1);
+        result.slepton[i].m = spec.safeget(Par::Pole_Mass,mass_es);
+        result.slepton[i].uncert_high = mssm.safeget(Par::Pole_Mass_1srd_high, mass_es);
+        result.slepton[i].uncert_low = mssm.safeget(Par::Pole_Mass_1srd_low, mass_es);
+      }
+      // Only the central sneutrino masses enter the cross-sections.
+      for (int i=0; i<3; i++)
+      {
+        result.sneutrino[i].m = spec.safeget(Par::Pole_Mass,"~nu_" + std::to_string(i+1));
+        result.sneutrino[i].uncert_high = result.sneutrino[i].uncert_low = 0;
+      }
+
+      // Get the 4x4 neutralino mixing matrix and the 2x2 chargino mixing matrices
+      result.neutmix.assign(4,std::vector<double>(4));
+      result.charginomixV.assign(2,std::vector<double>(2));
+      result.charginomixU.assign(2,std::vector<double>(2));
+      for (int i=0; i<4; i++) for (int j=0; j<4; j++) result.neutmix[i][j] = mssm.safeget(Par::Pole_Mixing,"~chi0",i+1,j+1);
+      for (int i=0; i<2; i++) for (int j=0; j<2; j++)
+      {
+        result.charginomixV[i][j] = mssm.safeget(Par::Pole_Mixing,"~chi+",i+1,j+1);
+        result.charginomixU[i][j] = mssm.safeget(Par::Pole_Mixing,"~chi-",i+1,j+1);
+      }
+
+      // Convert the mixing matrices to BFM convention
+      SLHA2BFM_NN(result.neutmix, result.tanb, result.sinW2);
+      SLHA2BFM_VV(result.charginomixV);
+      SLHA2BFM_VV(result.charginomixU);
+    }
+
+
     /// Retrieve the production cross-section at an e+e- collider for slepton pairs.
     ///  If l_are_gauge_es = T, then l(bar)_chirality = 1 => (anti-)left-type  slepton
     ///                                               = 2 => (anti-)right-type slepton
@@ -48,7 +128,8 @@ namespace Gambit
     ///                                               = 2 => (anti-)slepton is heaviest family state
     void get_sigma_ee_ll(triplet<double>& result, const double sqrts, const int generation, const int l_chirality,
                          const int lbar_chirality, const double gtol, const double ftol, const bool gpt_error,
-                         const bool fpt_error, const Spectrum& spec, const double gammaZ, const bool l_are_gauge_es)
+                         const bool fpt_error, const Spectrum& spec, const LEPSpectrumInputs& inputs,
+                         const bool l_are_gauge_es)
     {
       static const str genmap[3][2] =
       {
@@ -63,14 +144,6 @@ namespace Gambit
       const int id1 = 1000000*l_chirality + 11 +2*(generation-1);
       const int id2 = -(1000000*lbar_chirality + 11 +2*(generation-1));
 
-      // SM parameters
-      const double mZ = spec.safeget(Par::Pole_Mass,23,0);
-      const double g2 = mssm.safeget(Par::dimensionless,"g2");
-      const double sinW2 = mssm.safeget(Par::dimensionless,"sinW2");
-      const double alpha = 0.25*sinW2*g2*g2/pi;
-      // MSSM parameters
-      const double tanb = mssm.safeget(Par::dimensionless,"tanbeta");
-
       // Get the mass eigenstate strings and 2x2 slepton generation mass mixing matrix
       str mass_es1, mass_es2;
       MixMatrix sleptonmix(2,std::vector<double>(2));
@@ -97,15 +170,13 @@ namespace Gambit
         sleptonmix[1][0] = slepton4vec[2];
         sleptonmix[1][1] = slepton4vec[3];
       }
-      const double m1 = spec.safeget(Par::Pole_Mass,mass_es1);
+      const LEPSparticleMass& sl1 = inputs.sfermion(mass_es1);
       // FIXME when spectrum object has separate pole mass getters for antiparticles
-      //const double m2 = spec.safeget(Par::Pole_Mass,Models::ParticleDB().get_antiparticle(mass_es2));
-      // until then
-      const double m2 = spec.safeget(Par::Pole_Mass,mass_es2);
-      std::pair<double,double> m1_uncerts(mssm.safeget(Par::Pole_Mass_1srd_high, mass_es1),
-                                          mssm.safeget(Par::Pole_Mass_1srd_low,  mass_es1));
-      std::pair<double,double> m2_uncerts(mssm.safeget(Par::Pole_Mass_1srd_high, mass_es2),
-                                          mssm.safeget(Par::Pole_Mass_1srd_low,  mass_es2));
+      const LEPSparticleMass& sl2 = inputs.sfermion(mass_es2);
+      const double m1 = sl1.m;
+      const double m2 = sl2.m;
+      std::pair<double,double> m1_uncerts(sl1.uncert_high, sl1.uncert_low);
+      std::pair<double,double> m2_uncerts(sl2.uncert_high, sl2.uncert_low);
 
       // If the final state is kinematically inaccessible *even* if both masses
       // are 2simga lower than their central values, then return zero.
@@ -117,39 +188,32 @@ namespace Gambit
         return;
       }
 
-      // Get the neutralino masses
-      const double neutmass[4] = { spec.safeget(Par::Pole_Mass,1000022,0), spec.safeget(Par::Pole_Mass,1000023,0),
-                                   spec.safeget(Par::Pole_Mass,1000025,0), spec.safeget(Par::Pole_Mass,1000035,0) };
-      // Get the 4x4 neutralino mixing matrix
-      MixMatrix neutmix(4,std::vector<double>(4));
-      for (int i=0; i<4; i++) for (int j=0; j<4; j++) neutmix[i][j] = mssm.safeget(Par::Pole_Mixing,"~chi0",i+1,j+1);
-
-      // Convert neutralino mixing matrix to BFM convention
-      SLHA2BFM_NN(neutmix, tanb, sinW2);
+      const MixMatrix& neutmix = inputs.neutmix;
+      const double* neutmass = inputs.neutmass;
+      const double alpha = inputs.alpha, mZ = inputs.mZ, gammaZ = inputs.gammaZ, sinW2 = inputs.sinW2;
 
       // Calculate the cross-section
       result.central = xsec_sleislej(id1, id2, sqrts, m1, m2, sleptonmix, neutmix, neutmass, alpha, mZ, gammaZ, sinW2);
 
       // Calculate the uncertainty on the cross-section due to final state masses varying by +/- 1 sigma
-      std::vector<double> xsecs;
-      xsecs.push_back(result.central);
-      xsecs.push_back(xsec_sleislej(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.+m2_uncerts.first), sleptonmix, neutmix,
-                                   neutmass, alpha, mZ, gammaZ, sinW2, false));
-      xsecs.push_back(xsec_sleislej(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.+m2_uncerts.first), sleptonmix, neutmix,
-                                   neutmass, alpha, mZ, gammaZ, sinW2, false));
-      xsecs.push_back(xsec_sleislej(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.-m2_uncerts.second), sleptonmix, neutmix,
-                                   neutmass, alpha, mZ, gammaZ, sinW2, false));
-      xsecs.push_back(xsec_sleislej(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.-m2_uncerts.second), sleptonmix, neutmix,
-                                   neutmass, alpha, mZ, gammaZ, sinW2, false));
-      result.upper = *std::max_element(xsecs.begin(), xsecs.end());
-      result.lower = *std::min_element(xsecs.begin(), xsecs.end());
+      double xsecs[5] = { result.central,
+        xsec_sleislej(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.+m2_uncerts.first), sleptonmix, neutmix,
+                      neutmass, alpha, mZ, gammaZ, sinW2, false),
+        xsec_sleislej(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.+m2_uncerts.first), sleptonmix, neutmix,
+                      neutmass, alpha, mZ, gammaZ, sinW2, false),
+        xsec_sleislej(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.-m2_uncerts.second), sleptonmix, neutmix,
+                      neutmass, alpha, mZ, gammaZ, sinW2, false),
+        xsec_sleislej(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.-m2_uncerts.second), sleptonmix, neutmix,
+                      neutmass, alpha, mZ, gammaZ, sinW2, false) };
+      result.upper = *std::max_element(xsecs, xsecs+5);
+      result.lower = *std::min_element(xsecs, xsecs+5);
 
     }
 
 
     /// Retrieve the production cross-section at an e+e- collider for neutralino pairs
     void get_sigma_ee_chi00(triplet<double>& result, const double sqrts, const int chi_first, const int chi_second,
-                            const double tol, const bool pt_error, const Spectrum& spec, const double gammaZ)
+                            const double tol, const bool pt_error, const Spectrum& spec, const LEPSpectrumInputs& inputs)
     {
       // Subspectrum
       const SubSpectrum& mssm = spec.get_HE();
@@ -158,26 +222,19 @@ namespace Gambit
       const int id1 = 1000021 + chi_first  + (chi_first  > 2 ? 1 + (chi_first -3)*9 : 0);
       const int id2 = 1000021 + chi_second + (chi_second > 2 ? 1 + (chi_second-3)*9 : 0);
 
-      // SM parameters
-      const double mZ = spec.safeget(Par::Pole_Mass,23,0);
-      const double g2 = mssm.safeget(Par::dimensionless,"g2");
-      const double sinW2 = mssm.safeget(Par::dimensionless,"sinW2");
-      const double alpha = 0.25*sinW2*g2*g2/pi;
-
       // MSSM parameters
-      const double tanb = mssm.safeget(Par::dimensionless,"tanbeta");
       // Get the mass eigenstates best corresponding to ~eL and ~eR.
       const str mass_esL = slhahelp::mass_es_from_gauge_es("~e_L", mssm, tol, LOCAL_INFO, pt_error);
       const str mass_esR = slhahelp::mass_es_from_gauge_es("~e_R", mssm, tol, LOCAL_INFO, pt_error);
       // Get the slepton masses
-      const double mS[2] = {spec.safeget(Par::Pole_Mass,mass_esL), spec.safeget(Par::Pole_Mass,mass_esR)};
+      const double mS[2] = {inputs.sfermion(mass_esL).m, inputs.sfermion(mass_esR).m};
       // Get the neutralino masses
-      const double m1 = spec.safeget(Par::Pole_Mass,id1,0);
-      const double m2 = spec.safeget(Par::Pole_Mass,id2,0);
-      std::pair<double,double> m1_uncerts(mssm.safeget(Par::Pole_Mass_1srd_high, id1, 0),
-                                          mssm.safeget(Par::Pole_Mass_1srd_low,  id1, 0));
-      std::pair<double,double> m2_uncerts(mssm.safeget(Par::Pole_Mass_1srd_high, id2, 0),
-                                          mssm.safeget(Par::Pole_Mass_1srd_low,  id2, 0));
+      const LEPSparticleMass& chi1 = inputs.neutralino[chi_first-1];
+      const LEPSparticleMass& chi2 = inputs.neutralino[chi_second-1];
+      const double m1 = chi1.m;
+      const double m2 = chi2.m;
+      std::pair<double,double> m1_uncerts(chi1.uncert_high, chi1.uncert_low);
+      std::pair<double,double> m2_uncerts(chi2.uncert_high, chi2.uncert_low);
 
       // Just return zero if the final state is kinematically inaccessible
       // *even* if both masses are 2simga lower than their central values
@@ -189,35 +246,30 @@ namespace Gambit
         return;
       }
 
-      // Get the 4x4 neutralino mixing matrix
-      MixMatrix neutmix(4,std::vector<double>(4));
-      for (int i=0; i<4; i++) for (int j=0; j<4; j++) neutmix[i][j] = mssm.safeget(Par::Pole_Mixing,"~chi0",i+1,j+1);
-
-      // Convert neutralino mixing matrix to BFM convention
-      SLHA2BFM_NN(neutmix, tanb, sinW2);
+      const MixMatrix& neutmix = inputs.neutmix;
+      const double tanb = inputs.tanb, alpha = inputs.alpha, mZ = inputs.mZ, gammaZ = inputs.gammaZ, sinW2 = inputs.sinW2;
 
       // Calculate the cross-section
       result.central = xsec_neuineuj(id1, id2, sqrts, m1, m2, neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2);
 
       // Calculate the uncertainty on the cross-section due to final state masses varying by +/- 1 sigma
-      std::vector<double> xsecs;
-      xsecs.push_back(result.central);
-      xsecs.push_back(xsec_neuineuj(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.+m2_uncerts.first),
-                                    neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2));
-      xsecs.push_back(xsec_neuineuj(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.-m2_uncerts.second),
-                                    neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2));
-      xsecs.push_back(xsec_neuineuj(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.+m2_uncerts.first),
-                                    neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2));
-      xsecs.push_back(xsec_neuineuj(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.-m2_uncerts.second),
-                                    neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2));
-      result.upper = *std::max_element(xsecs.begin(), xsecs.end());
-      result.lower = *std::min_element(xsecs.begin(), xsecs.end());
+      double xsecs[5] = { result.central,
+        xsec_neuineuj(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.+m2_uncerts.first),
+                      neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2),
+        xsec_neuineuj(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.-m2_uncerts.second),
+                      neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2),
+        xsec_neuineuj(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.+m2_uncerts.first),
+                      neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2),
+        xsec_neuineuj(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.-m2_uncerts.second),
+                      neutmix, mS, 1./tanb, alpha, mZ, gammaZ, sinW2) };
+      result.upper = *std::max_element(xsecs, xsecs+5);
+      result.lower = *std::min_element(xsecs, xsecs+5);
 
     }
 
     /// Retrieve the production cross-section at an e+e- collider for chargino pairs
     void get_sigma_ee_chipm(triplet<double>& result, const double sqrts, const int chi_plus, const int chi_minus,
-                            const double tol, const bool pt_error, const Spectrum& spec, const double gammaZ)
+                            const double tol, const bool pt_error, const Spectrum& spec, const LEPSpectrumInputs& inputs)
     {
       // Subspectrum
       const SubSpectrum& mssm = spec.get_HE();
@@ -226,24 +278,18 @@ namespace Gambit
       const int id1 = 1000023 + chi_plus + (chi_plus - 1)*12;
       const int id2 = -(1000023 + chi_minus + (chi_minus - 1)*12);
 
-      // SM parameters
-      const double mZ = spec.safeget(Par::Pole_Mass,23,0);
-      const double g2 = mssm.safeget(Par::dimensionless,"g2");
-      const double sinW2 = mssm.safeget(Par::dimensionless,"sinW2");
-      const double alpha = 0.25*sinW2*g2*g2/pi;
-
       // MSSM parameters
       // Get the mass eigenstate best corresponding to ~nu_e_L.
       const str mass_snue = slhahelp::mass_es_from_gauge_es("~nu_e_L", mssm, tol, LOCAL_INFO, pt_error);
       // Get the electron sneutrino mass
-      const double msn = spec.safeget(Par::Pole_Mass,mass_snue);
+      const double msn = inputs.sfermion(mass_snue).m;
       // Get the chargino masses
-      const double m1 = spec.safeget(Par::Pole_Mass,id1,0);
-      const double m2 = spec.safeget(Par::Pole_Mass,id2,0);
-      std::pair<double,double> m1_uncerts(mssm.safeget(Par::Pole_Mass_1srd_high, id1, 0),
-                                          mssm.safeget(Par::Pole_Mass_1srd_low,  id1, 0));
-      std::pair<double,double> m2_uncerts(mssm.safeget(Par::Pole_Mass_1srd_high, id2, 0),
-                                          mssm.safeget(Par::Pole_Mass_1srd_low,  id2, 0));
+      const LEPSparticleMass& chi1 = inputs.chargino[chi_plus-1];
+      const LEPSparticleMass& chi2 = inputs.antichargino[chi_minus-1];
+      const double m1 = chi1.m;
+      const double m2 = chi2.m;
+      std::pair<double,double> m1_uncerts(chi1.uncert_high, chi1.uncert_low);
+      std::pair<double,double> m2_uncerts(chi2.uncert_high, chi2.uncert_low);
 
       // Just return zero if the final state is kinematically inaccessible
       // *even* if both masses are 2simga lower than their central values
@@ -255,36 +301,26 @@ namespace Gambit
         return;
       }
 
-      // Get the 2x2 chargino mixing matrices
-      MixMatrix charginomixV(2,std::vector<double>(2));
-      MixMatrix charginomixU(2,std::vector<double>(2));
-      for (int i=0; i<2; i++) for (int j=0; j<2; j++)
-      {
-        charginomixV[i][j] = mssm.safeget(Par::Pole_Mixing,"~chi+",i+1,j+1);
-        charginomixU[i][j] = mssm.safeget(Par::Pole_Mixing,"~chi-",i+1,j+1);
-      }
-
-      // Convert chargino mixing matrices to BFM convention
-      SLHA2BFM_VV(charginomixV);
-      SLHA2BFM_VV(charginomixU);
+      const MixMatrix& charginomixV = inputs.charginomixV;
+      const MixMatrix& charginomixU = inputs.charginomixU;
+      const double alpha = inputs.alpha, mZ = inputs.mZ, gammaZ = inputs.gammaZ, sinW2 = inputs.sinW2;
 
       // Calculate the cross-section
       result.central = xsec_chaichaj(id1, id2, sqrts, m1, m2, charginomixV, charginomixU,
                                      msn, alpha, mZ, gammaZ, sinW2);
 
       // Calculate the uncertainty on the cross-section due to final state masses varying by +/- 1 sigma
-      std::vector<double> xsecs;
-      xsecs.push_back(result.central);
-      xsecs.push_back(xsec_chaichaj(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.+m2_uncerts.first), charginomixV, charginomixU,
-                                     msn, alpha, mZ, gammaZ, sinW2));
-      xsecs.push_back(xsec_chaichaj(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.-m2_uncerts.second), charginomixV, charginomixU,
-                                     msn, alpha, mZ, gammaZ, sinW2));
-      xsecs.push_back(xsec_chaichaj(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.+m2_uncerts.first), charginomixV, charginomixU,
-                                     msn, alpha, mZ, gammaZ, sinW2));
-      xsecs.push_back(xsec_chaichaj(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.-m2_uncerts.second), charginomixV, charginomixU,
-                                     msn, alpha, mZ, gammaZ, sinW2));
-      result.upper = *std::max_element(xsecs.begin(), xsecs.end());
-      result.lower = *std::min_element(xsecs.begin(), xsecs.end());
+      double xsecs[5] = { result.central,
+        xsec_chaichaj(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.+m2_uncerts.first), charginomixV, charginomixU,
+                      msn, alpha, mZ, gammaZ, sinW2),
+        xsec_chaichaj(id1, id2, sqrts, m1*(1.+m1_uncerts.first), m2*(1.-m2_uncerts.second), charginomixV, charginomixU,
+                      msn, alpha, mZ, gammaZ, sinW2),
+        xsec_chaichaj(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.+m2_uncerts.first), charginomixV, charginomixU,
+                      msn, alpha, mZ, gammaZ, sinW2),
+        xsec_chaichaj(id1, id2, sqrts, m1*(1.-m1_uncerts.second), m2*(1.-m2_uncerts.second), charginomixV, charginomixU,
+                      msn, alpha, mZ, gammaZ, sinW2) };
+      result.upper = *std::max_element(xsecs, xsecs+5);
+      result.lower = *std::min_element(xsecs, xsecs+5);
 
     }
 
@@ -352,8 +388,8 @@ namespace Gambit
 
     /// Cross section [pb] for \f$e^+e^- -> \tilde l_i \tilde l_j^*\f$
     /// To use, call SLHA2BFM first on SLHA mixing matrices constructed as a vector of vectors
-    double xsec_sleislej(int pid1, int pid2, double sqrts, double m1, double m2, MixMatrix F,
-                         MixMatrix N, const double mN[4], double alpha, double mZ, double gZ,
+    double xsec_sleislej(int pid1, int pid2, double sqrts, double m1, double m2, const MixMatrix& F,
+                         const MixMatrix& N, const double mN[4], double alpha, double mZ, double gZ,
                          double sin2thetaW, bool CP_lock)
     {
 
@@ -523,7 +559,7 @@ namespace Gambit
     /// Cross section [pb] for \f$e^+e^- -> \tilde\chi^0_i \tilde\chi^0_j\f$
     /// Masses mi and mj for the neutralinos are signed. mS are the selectron masses (left = 0, right = 1).
     /// Warning! BFM uses inverted \f$\tan\beta\f$! Use tanb = 1 / tanb in converting from SLHA.
-    double xsec_neuineuj(int pid1, int pid2, double sqrts, double mi, double mj, MixMatrix N,
+    double xsec_neuineuj(int pid1, int pid2, double sqrts, double mi, double mj, const MixMatrix& N,
                          const double mS[2], double tanb, double alpha, double mZ, double gZ, double sin2thetaW)
     {
 
@@ -621,8 +657,8 @@ namespace Gambit
 
     /// Cross section [pb] for \f$e^+e^- -> \tilde\chi^+_i \tilde\chi^-_j\f$
     /// Masses mi and mj for the charginos are signed. msn is electron sneutrino mass.
-    double xsec_chaichaj(int pid1, int pid2, double sqrts, double mi, double mj, MixMatrix V,
-                         MixMatrix U, double ms, double alpha, double mZ, double gZ, double sin2thetaW)
+    double xsec_chaichaj(int pid1, int pid2, double sqrts, double mi, double mj, const MixMatrix& V,
+                         const MixMatrix& U, double ms, double alpha, double mZ, double gZ, double sin2thetaW)
     {
       // Just return zero if the final state isn't kinematically accessible
       if (std::abs(mi)+std::abs(mj) > sqrts) return 0.0;
@@ -18,7 +18,13 @@
 ///
 ///  *************************************
 
+#include <cctype>
+#include <cstring>
+#include <sstream>
+
 #include "gambit/ColliderBit/limits/BaseLimitContainer.hpp"
+#include "gambit/Utils/standalone_error_handlers.hpp"
+#include "gambit/cmake/cmake_variables.hpp"
 
 namespace Gambit
 {
@@ -34,12 +40,116 @@ namespace Gambit
       }
     }
 
+    void BaseLimitContainer::readContours(const std::string& name)
+    {
+      const std::string filename = GAMBIT_DIR "/ColliderBit/data/LEP_limits/" + name + ".dat";
+      std::ifstream inFile(filename.c_str());
+      if (not inFile) utils_error().raise(LOCAL_INFO, "Could not open LEP limit data file " + filename + ".");
+
+      Contours* contour = NULL;
+      Corners corners;
+      bool inPolyline = false;
+      std::string line;
+      int lineNumber = 0;
+      auto fail = [&](const std::string& problem)
+      {
+        std::stringstream msg;
+        msg << "Error reading LEP limit data file " << filename << ", line " << lineNumber << ": " << problem;
+        utils_error().raise(LOCAL_INFO, msg.str());
+      };
+      // Add the polyline through the corners read so far to the current contour.
+      auto addCorners = [&]()
+      {
+        if (not inPolyline) return;
+        inPolyline = false;
+        if (corners.empty()) fail("polyline with no corners.");
+        if (corners.size() < 2) fail("polyline with only one corner.");
+        size_t oldSize = contour->size();
+        contour->resize(oldSize + corners.size() - 1);
+        std::transform(corners.begin(), --corners.end(), ++corners.begin(),
+                       contour->begin() + oldSize, makeLine);
+        corners.clear();
+      };
+
+      while (std::getline(inFile, line))
+      {
+        lineNumber++;
+        const char* pos = line.c_str();
+        char* end;
+        while (std::isspace(*pos)) pos++;
+        if (*pos == '\0' or *pos == '#') continue;
+
+        if (std::strncmp(pos, "limit", 5) == 0)
+        {
+          addCorners();
+          double value = std::strtod(pos + 5, &end);
+          if (end == pos + 5) fail("missing limit value.");
+          if (not _limitValuesSorted.empty() and value <= _limitValuesSorted.back()) fail("limit values are not in increasing order.");
+          _limitValuesSorted.push_back(value);
+          // Hand the contour to the map straight away, so that the destructor cleans up if reading fails.
+          contour = new Contours();
+          _limitContours.insert(LimitContourEntry(_limitValuesSorted.size() - 1, contour));
+        }
+        else if (std::strncmp(pos, "line", 4) == 0)
+        {
+          if (contour == NULL) fail("polyline before the first limit value.");
+          addCorners();
+          inPolyline = true;
+        }
+        else
+        {
+          if (contour == NULL) fail("corner before the first limit value.");
+          double x = std::strtod(pos, &end);
+          const char* ypos = end;
+          double y = std::strtod(ypos, &end);
+          if (ypos == pos or end == ypos) fail("expected 'x y' pixel coordinates, found '" + line + "'.");
+          corners.push_back(convertPt(x, y));
+          inPolyline = true;
+        }
+      }
+      if (contour != NULL) addCorners();
+      if (_limitValuesSorted.empty()) fail("no limit contours found.");
+    }
+
     double BaseLimitContainer::specialLimit(double, double) const
     {
       return std::numeric_limits<double>::infinity();
     }
   
+    const std::vector<unsigned>& BaseLimitContainer::_segmentsNear(unsigned index, const LineSegment& line, bool useIndex) const
+    {
+      static thread_local std::vector<unsigned> result;
+      const Contours& contour = *_limitContours.at(index);
+      if (useIndex)
+      {
+        // The derived classes fill the contours in their constructors, so index them on first use.
+        std::call_once(_contourGridsBuilt, [this]()
+        {
+          _contourGrids.resize(_limitContours.size());
+          for (auto it = _limitContours.begin(); it != _limitContours.end(); ++it)
+            _contourGrids.at(it->first).build(*it->second);
+        });
+        _contourGrids.at(index).candidates(line, result);
+      }
+      else
+      {
+        result.resize(contour.size());
+        for (unsigned i = 0; i < contour.size(); i++) result[i] = i;
+      }
+      return result;
+    }
+
     double BaseLimitContainer::limitAverage(double x, double y, double mZ) const
+    {
+      return _limitAverage(x, y, mZ, true);
+    }
+
+    double BaseLimitContainer::limitAverageFullScan(double x, double y, double mZ) const
+    {
+      return _limitAverage(x, y, mZ, false);
+    }
+
+    double BaseLimitContainer::_limitAverage(double x, double y, double mZ, bool useIndex) const
     {
       if (!isWithinExclusionRegion(x, y, mZ)) return specialLimit(x, y);
       const P2& point = P2(x, y);
@@ -54,9 +164,9 @@ namespace Gambit
       for (index=0; index<_limitValuesSorted.size(); index++) {
         intersectCounter = 0; 
         thisLimit = _limitValuesSorted[index];
-        for (auto segmentIter = _limitContours.at(index)->begin();
-                  segmentIter != _limitContours.at(index)->end(); ++segmentIter)
-          if (externalLine.intersectsAt(*segmentIter).r() < std::numeric_limits<double>::infinity())
+        const Contours& contour = *_limitContours.at(index);
+        for (unsigned iseg : _segmentsNear(index, externalLine, useIndex))
+          if (externalLine.intersectsAt(contour[iseg]).r() < std::numeric_limits<double>::infinity())
             intersectCounter++;
         if (intersectCounter % 2) break;
         thisLimit = -1.;
@@ -82,9 +192,9 @@ namespace Gambit
   
         // For each ray, look for intersections with the next best limit.
         rmin = std::numeric_limits<double>::infinity();
-        for (auto segmentIter = _limitContours.at(index-1)->begin();
-                  segmentIter != _limitContours.at(index-1)->end(); ++segmentIter) {
-          intersectLine.init(point, ray.intersectsAt(*segmentIter));
+        const Contours& nextBestContour = *_limitContours.at(index-1);
+        for (unsigned iseg : _segmentsNear(index-1, ray, useIndex)) {
+          intersectLine.init(point, ray.intersectsAt(nextBestContour[iseg]));
           r = intersectLine.r();
           if (r <= rmin) rmin = r;
         }
@@ -99,9 +209,9 @@ namespace Gambit
   
         // For each ray, also look for intersections with the current limit.
         rmin = std::numeric_limits<double>::infinity();
-        for (auto segmentIter = _limitContours.at(index)->begin();
-                  segmentIter != _limitContours.at(index)->end(); ++segmentIter) {
-          intersectLine.init(point, ray.intersectsAt(*segmentIter));
+        const Contours& thisContour = *_limitContours.at(index);
+        for (unsigned iseg : _segmentsNear(index, ray, useIndex)) {
+          intersectLine.init(point, ray.intersectsAt(thisContour[iseg]));
           r = intersectLine.r();
           if (r <= rmin) rmin = r;
         }
@@ -31,7 +31,15 @@ namespace Gambit
         bool &auto_increment();
 
         /// Returns unigue pointid;
+        /// Inside an OpenMP parallel region this is the ID claimed by the calling thread (if any).
         unsigned long long int &get_point_id();
+
+        /// Take the next pointid from the global counter and make it the calling thread's current
+        /// pointid, so that points can be evaluated and printed concurrently from several threads.
+        unsigned long long int claim_point_id();
+
+        /// Return the calling thread to the global pointid.
+        void release_point_id();
  
         /// Consolidated 'get id' function, for both main and aux
         int get_param_id(const std::string& name, bool& is_new);
@@ -1,4 +1,6 @@
 
+#include <omp.h>
+
 #include "gambit/Printers/printer_id_tools.hpp"
 #include "gambit/Logs/logger.hpp"
 
@@ -10,13 +12,51 @@ namespace Gambit
         // bjf> I'm not sure that it is so great to have this as a global.
         //      It would be better managed by the printer object. Some
         //      changes required in ScannerBit to do this though
-        unsigned long long int &get_point_id()
+        unsigned long long int &global_point_id()
         {
             static unsigned long long int id = 0;
             
             return id;
         }
 
+        /// Point ID claimed by the calling thread for a point evaluated inside a parallel region.
+        struct thread_point_id
+        {
+            bool active;
+            unsigned long long int id;
+        };
+
+        thread_point_id &get_thread_point_id()
+        {
+            static thread_local thread_point_id tid = {false, 0};
+            return tid;
+        }
+
+        unsigned long long int &get_point_id()
+        {
+            thread_point_id &tid = get_thread_point_id();
+            if (tid.active and omp_in_parallel()) return tid.id;
+            return global_point_id();
+        }
+
+        unsigned long long int claim_point_id()
+        {
+            unsigned long long int id;
+            #pragma omp critical (gambit_point_id)
+            {
+                id = ++global_point_id();
+            }
+            thread_point_id &tid = get_thread_point_id();
+            tid.active = true;
+            tid.id = id;
+            return id;
+        }
+
+        void release_point_id()
+        {
+            get_thread_point_id().active = false;
+        }
+
         bool &auto_increment()
         {
             static bool ai = true;
@@ -0,0 +1,242 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Check that the array and batch prior
+///  transforms give the same physical parameters,
+///  bit for bit, as the map-based transform, over
+///  random points of the unit hypercube:
+///   - transformArray against transform for each
+///     prior type on its own;
+///   - transformBatch and transformArray against
+///     transform for a composite prior using every
+///     prior type.
+///
+///  Usage: ScannerBit_prior_transform_check [npoints]
+///
+///  *********************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gambit/Utils/yaml_options.hpp"
+#include "gambit/ScannerBit/priors_rollcall.hpp"
+
+using namespace Gambit;
+using namespace Gambit::Priors;
+
+namespace
+{
+
+  /// A prior type, the parameters it transforms, and its options
+  struct PriorCase
+  {
+    std::string type;
+    std::vector<std::string> params;
+    std::string options;
+    /// Parameters whose values are input rather than transformed (the scanner's for "none", the source of "same_as")
+    std::vector<std::string> inputs;
+  };
+
+  const std::vector<PriorCase> cases =
+  {
+    {"flat", {"x"}, "range: [-2, 3]", {}},
+    {"log", {"x"}, "range: [0.1, 1000]", {}},
+    {"sin", {"x"}, "range: [0.1, 1.2]", {}},
+    {"cos", {"x"}, "range: [0.1, 1.2]", {}},
+    {"tan", {"x"}, "range: [0.1, 1.2]", {}},
+    {"cot", {"x"}, "range: [0.1, 1.2]", {}},
+    {"flat", {"x"}, "{range: [0, 90], scale: degrees, shift: 1}", {}},
+    {"double_log_flat_join", {"x"}, "ranges: [-100, -1, 1, 100]", {}},
+    {"gaussian", {"x", "y", "z"}, "{mean: [1, -1, 0], cov: [[4, 1, 0.5], [1, 2, 0], [0.5, 0, 1]]}", {}},
+    {"cauchy", {"x", "y"}, "{mean: [0, 2], cov: [[1, 0.5], [0.5, 3]]}", {}},
+    {"dummy", {"x", "y"}, "{}", {}},
+    {"none", {"x"}, "{}", {"x"}},
+    {"fixed_value", {"x", "y"}, "fixed_value: [1, 2, 3]", {}},
+    {"same_as", {"x", "y"}, "{same_as: s, scale: [2, -1], shift: [1, 0]}", {"s"}},
+  };
+
+  /// Every prior type in one composite prior
+  const char *composite_parameters = R"(
+model:
+  flat_par:
+    range: [-2, 3]
+  log_par:
+    prior_type: log
+    range: [0.1, 1000]
+  sin_par:
+    prior_type: sin
+    range: [0.1, 1.2]
+  cos_par:
+    prior_type: cos
+    range: [0.1, 1.2]
+  tan_par:
+    prior_type: tan
+    range: [0.1, 1.2]
+  cot_par:
+    prior_type: cot
+    range: [0.1, 1.2]
+  join_par:
+    prior_type: double_log_flat_join
+    ranges: [-100, -1, 1, 100]
+  none_par:
+    prior_type: none
+  fixed_par: 3.5
+  cycle_par:
+    fixed_value: [1, 2, 3]
+  same_par:
+    same_as: model::flat_par
+    scale: 2
+    shift: 1
+  gauss_1:
+  gauss_2:
+  cauchy_1:
+  cauchy_2:
+  dummy_par:
+)";
+
+  const char *composite_priors = R"(
+gauss:
+  parameters: [model::gauss_1, model::gauss_2]
+  prior_type: gaussian
+  mean: [1, -1]
+  cov: [[4, 1], [1, 2]]
+cauchy:
+  parameters: [model::cauchy_1, model::cauchy_2]
+  prior_type: cauchy
+  mean: [0, 2]
+  cov: [[1, 0.5], [0.5, 3]]
+dummy:
+  parameters: [model::dummy_par]
+  prior_type: dummy
+)";
+
+  /// Bit-for-bit equality, treating NaNs as equal
+  bool same(double a, double b)
+  {
+    return a == b or (std::isnan(a) and std::isnan(b));
+  }
+
+  /// Compare transformArray with transform for one prior type.  Separate instances are used for
+  /// the two, so that priors with state (e.g. cycling fixed values) are compared in step.
+  /// @return The number of mismatching values
+  int check_prior(const PriorCase& c, int npoints, std::mt19937_64& gen)
+  {
+    std::uniform_real_distribution<double> unif(0, 1), input(-10, 10);
+    const Options options(YAML::Load(c.options));
+    std::unique_ptr<BasePrior> viaMap(prior_creators.at(c.type)(c.params, options));
+    std::unique_ptr<BasePrior> viaArray(prior_creators.at(c.type)(c.params, options));
+
+    std::vector<std::string> names = c.params;
+    for (const std::string& name : c.inputs)
+      if (std::find(names.begin(), names.end(), name) == names.end()) names.push_back(name);
+    std::unordered_map<std::string, int> index;
+    for (int i = 0, end = names.size(); i < end; i++) index[names[i]] = i;
+    viaArray->setOutputIndices(index);
+
+    int mismatches = 0;
+    std::vector<double> unit(viaMap->size()), phys(names.size());
+    std::unordered_map<std::string, double> map;
+    for (int n = 0; n < npoints; n++)
+    {
+      for (double& u : unit) u = unif(gen);
+      map.clear();
+      for (const std::string& name : c.inputs) phys[index[name]] = map[name] = input(gen);
+
+      viaMap->transform(unit, map);
+      viaArray->transformArray(unit.data(), phys.data());
+
+      for (int i = 0, end = names.size(); i < end; i++)
+      {
+        if (not same(map[names[i]], phys[i]))
+        {
+          if (mismatches++ < 5)
+            std::cout << "  " << c.type << ": " << names[i] << " = " << map[names[i]] << " from transform, "
+                      << phys[i] << " from transformArray" << std::endl;
+        }
+      }
+    }
+    return mismatches;
+  }
+
+  /// Compare transformBatch and transformArray with transform for a composite prior of every type.
+  /// @return The number of mismatching values
+  int check_composite(int npoints, std::mt19937_64& gen)
+  {
+    std::uniform_real_distribution<double> unif(0, 1), input(-10, 10);
+    const Options parameters(YAML::Load(composite_parameters)), priors(YAML::Load(composite_priors));
+    CompositePrior viaMap(parameters, priors), viaArray(parameters, priors), viaBatch(parameters, priors);
+
+    const std::vector<std::string>& names = viaMap.getOutputParameters();
+    const int nunit = viaMap.size(), nphys = names.size();
+    int none_index = -1;
+    for (int i = 0; i < nphys; i++) if (names[i] == "model::none_par") none_index = i;
+    if (none_index < 0)
+    {
+      std::cout << "  composite: model::none_par is not an output parameter" << std::endl;
+      return 1;
+    }
+
+    std::vector<double> unit(npoints*nunit), batch(npoints*nphys), inputs(npoints);
+    for (double& u : unit) u = unif(gen);
+    for (int n = 0; n < npoints; n++) batch[n*nphys + none_index] = inputs[n] = input(gen);
+    viaBatch.transformBatch(unit.data(), batch.data(), npoints);
+
+    int mismatches = 0;
+    std::vector<double> unitpars(nunit), phys(nphys);
+    std::unordered_map<std::string, double> map;
+    for (int n = 0; n < npoints; n++)
+    {
+      unitpars.assign(unit.begin() + n*nunit, unit.begin() + (n+1)*nunit);
+      map.clear();
+      map["model::none_par"] = phys[none_index] = inputs[n];
+
+      viaMap.transform(unitpars, map);
+      viaArray.transformArray(unitpars.data(), phys.data());
+
+      for (int i = 0; i < nphys; i++)
+      {
+        const double expected = map[names[i]];
+        if (not same(expected, phys[i]) or not same(expected, batch[n*nphys + i]))
+        {
+          if (mismatches++ < 5)
+            std::cout << "  composite: " << names[i] << " = " << expected << " from transform, " << phys[i]
+                      << " from transformArray, " << batch[n*nphys + i] << " from transformBatch" << std::endl;
+        }
+      }
+    }
+    return mismatches;
+  }
+
+}
+
+int main(int argc, char* argv[])
+{
+  const int npoints = (argc > 1 ? std::atoi(argv[1]) : 10000);
+  std::mt19937_64 gen(12345);
+  std::cout << std::setprecision(17);
+  int failed = 0;
+
+  for (const PriorCase& c : cases)
+  {
+    const int mismatches = check_prior(c, npoints, gen);
+    std::cout << (mismatches == 0 ? "OK   " : "FAIL ") << c.type << " (" << c.options << "): "
+              << mismatches << " mismatches in " << npoints << " points" << std::endl;
+    if (mismatches > 0) failed++;
+  }
+
+  const int mismatches = check_composite(npoints, gen);
+  std::cout << (mismatches == 0 ? "OK   " : "FAIL ") << "composite of all types: "
+            << mismatches << " mismatches in " << npoints << " points" << std::endl;
+  if (mismatches > 0) failed++;
+
+  return failed > 0 ? 1 : 0;
+}
@@ -22,6 +22,7 @@
 #ifndef __BASE_PRIORS_HPP__
 #define __BASE_PRIORS_HPP__
 
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -42,6 +43,8 @@ namespace Gambit
 
         protected:
             std::vector<std::string> param_names;
+            /// Position of each of param_names in the output array of transformArray
+            std::vector<int> param_index;
 
         public:
             BasePrior() : param_size(0), param_names(0) {}
@@ -54,6 +57,27 @@ namespace Gambit
 
             virtual void transform(const std::vector<double> &, std::unordered_map<std::string, double> &) const = 0;
 
+            /// Array version of transform.  Reads size() unit hypercube parameters from unit and writes
+            /// the physical parameters to phys, at the positions given to setOutputIndices.  Priors that
+            /// do not provide their own version go through the map-based transform.
+            virtual void transformArray(const double *unit, double *phys) const
+            {
+                static thread_local std::vector<double> unitpars;
+                static thread_local std::unordered_map<std::string, double> map;
+                unitpars.assign(unit, unit + size());
+                transform(unitpars, map);
+                for (int i = 0, end = param_names.size(); i < end; i++)
+                    phys[param_index[i]] = map[param_names[i]];
+            }
+
+            /// Set the output array positions used by transformArray from a map of parameter name to position.
+            virtual void setOutputIndices(const std::unordered_map<std::string, int> &index)
+            {
+                param_index.resize(param_names.size());
+                for (int i = 0, end = param_names.size(); i < end; i++)
+                    param_index[i] = index.at(param_names[i]);
+            }
+
             virtual double operator()(const std::vector<double> &) const {return 0.0;}
 
             inline unsigned int size() const {return param_size;}
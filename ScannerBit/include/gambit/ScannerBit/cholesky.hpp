@@ -82,6 +82,23 @@ namespace Gambit
                         
                         y = b;
                 }
+
+                /// Same as ElMult, but acting on y[index[0]], y[index[1]], ... with y0 then added to the
+                /// result.  The rows are done last to first so that no temporary storage is needed.
+                void ElMult (double *y, const int *index, const std::vector<double> &y0) const
+                {
+                        int i, j;
+                        int num = el.size();
+                        for(i = num - 1; i >= 0; i--)
+                        {
+                                double b = 0.0;
+                                for (j = 0; j <= i; j++)
+                                {
+                                        b += el[i][j]*y[index[j]];
+                                }
+                                y[index[i]] = b + y0[i];
+                        }
+                }
                 
                 double Square(const std::vector<double> &y, const std::vector<double> &y0)
                 {
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <typeinfo>
+#include <omp.h>
 #ifdef __NO_PLUGIN_BOOST__
   #include <memory>
 #else
@@ -119,7 +120,11 @@ namespace Gambit
                 Gambit::Scanner::Plugins::plugin_info.set_calculating(true);
                 if(Gambit::Printers::auto_increment()) // This is slightly hacky, but I need to be able to disable the auto-incrementing in the post-processor scanner. Need to manually set the point ID.
                 {
-                  ++Gambit::Printers::get_point_id();
+                  // Points evaluated concurrently by a threaded scanner each get their own ID.
+                  if (omp_in_parallel())
+                    Gambit::Printers::claim_point_id();
+                  else
+                    ++Gambit::Printers::get_point_id();
                 }
                 ret ret_val = main(params...);
                 Gambit::Scanner::Plugins::plugin_info.set_calculating(false);
@@ -317,11 +322,14 @@ namespace Gambit
                 (*this)->getPrior().transform(vec, map);
                 double ret_val = (*this)->operator()(map);
                 unsigned long long int id = Gambit::Printers::get_point_id();
-                (*this)->getPrinter().print(ret_val, (*this)->getPurpose(), rank, id);
-                (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
-                (*this)->getPrinter().print(vec, "unitCubeParameters", rank, id);
-                (*this)->getPrinter().print(id,   "pointID", rank, id);
-                (*this)->getPrinter().print(rank, "MPIrank", rank, id);
+                #pragma omp critical (gambit_scanner_printer)
+                {
+                    (*this)->getPrinter().print(ret_val, (*this)->getPurpose(), rank, id);
+                    (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
+                    (*this)->getPrinter().print(vec, "unitCubeParameters", rank, id);
+                    (*this)->getPrinter().print(id,   "pointID", rank, id);
+                    (*this)->getPrinter().print(rank, "MPIrank", rank, id);
+                }
 
                 return ret_val + (*this)->getPurposeOffset();
             }
@@ -332,11 +340,14 @@ namespace Gambit
                 (*this)->getPrior().transform(vec, map);
                 double ret_val = (*this)->operator()(map);
                 unsigned long long int id = Gambit::Printers::get_point_id();
-                (*this)->getPrinter().print(ret_val, (*this)->getPurpose(), rank, id);
-                (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
-                if (vec.size() > 0) (*this)->getPrinter().print(vec, "unitCubeParameters", rank, id);
-                (*this)->getPrinter().print(id,   "pointID", rank, id);
-                (*this)->getPrinter().print(rank, "MPIrank", rank, id);
+                #pragma omp critical (gambit_scanner_printer)
+                {
+                    (*this)->getPrinter().print(ret_val, (*this)->getPurpose(), rank, id);
+                    (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
+                    if (vec.size() > 0) (*this)->getPrinter().print(vec, "unitCubeParameters", rank, id);
+                    (*this)->getPrinter().print(id,   "pointID", rank, id);
+                    (*this)->getPrinter().print(rank, "MPIrank", rank, id);
+                }
                 // Return the value of the function, offset by any offset set
                 return ret_val + (*this)->getPurposeOffset();
             }
@@ -44,6 +44,7 @@ inline void print_parameters(std::unordered_map<std::string, double> &key_map)
 {                                                                                                               \
     using Gambit::Printers::get_main_param_id;                                                                  \
     Gambit::Scanner::printer *printer = get_printer().get_stream();                                             \
+    _Pragma("omp critical (gambit_scanner_printer)")                                                            \
     for (auto it = get_keys().begin(), end = get_keys().end(); it != end; ++it)                                 \
     {                                                                                                           \
         printer->print(key_map[*it], *it, get_main_param_id(*it), printer->getRank(), get_point_id());          \
@@ -80,8 +80,8 @@ namespace Gambit
             
             ret main(const args&... in)
             {
-                // Check for signals to abort run
-                if(signaldata().check_if_shutdown_begun())
+                // Check for signals to abort run (only from the master thread, which owns the MPI communication)
+                if(omp_get_thread_num() == 0 and signaldata().check_if_shutdown_begun())
                 {
                     Function_Base<ret (args...)>::tell_scanner_early_shutdown_in_progress(); // e.g. sets 'quit' flag in Diver
                 }
@@ -116,8 +116,8 @@ namespace Gambit
             
             ret main(const args&... in)
             {
-                // Check for signals to abort run
-                if(signaldata().check_if_shutdown_begun())
+                // Check for signals to abort run (only from the master thread, which owns the MPI communication)
+                if(omp_get_thread_num() == 0 and signaldata().check_if_shutdown_begun())
                 {
                     Function_Base<ret (args...)>::tell_scanner_early_shutdown_in_progress(); // e.g. sets 'quit' flag in Diver
                 }
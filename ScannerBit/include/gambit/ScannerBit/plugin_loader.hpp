@@ -26,6 +26,7 @@
 #ifndef __PLUGIN_LOADER_HPP
 #define __PLUGIN_LOADER_HPP
 
+#include <atomic>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -84,6 +85,15 @@ namespace Gambit
                 std::vector<Plugin_Details> total_plugins;
                 std::map<std::string, std::map<std::string, std::vector<Plugin_Details>>> total_plugin_map;
                 YAML::Node flags_node;
+                /// Cache of plugin symbols per library, so that nm only runs on new or modified libraries
+                std::string registry_file;
+                YAML::Node registry_node;
+                bool registry_changed;
+
+                void loadRegistry();
+                void saveRegistry();
+                std::vector<std::string> findPluginSymbols(const std::string &);
+                std::vector<std::string> scanLibrary(const std::string &) const;
                     
             public:
                 Plugin_Loader();
@@ -136,7 +146,8 @@ namespace Gambit
             {
             private:
                 bool keepRunning;
-                bool funcCalculating;
+                /// Number of likelihood calls in progress, which threaded scanners may make concurrently
+                std::atomic<int> funcCalculating;
                 std::map<std::string, std::map<std::string, Proto_Plugin_Details> > selectedPlugins;
                 mutable Plugins::Plugin_Loader plugins;
                 std::map<std::string, std::vector<__plugin_resume_base__ *>> resume_data;
@@ -187,8 +198,8 @@ namespace Gambit
                 void printer_prior(printer_interface &, Priors::BasePrior &);
                 bool keep_running() const {return keepRunning;}
                 void set_running(bool b){keepRunning = b;}
-                bool func_calculating() const {return funcCalculating;}
-                void set_calculating(bool b){funcCalculating = b;}
+                bool func_calculating() const {return funcCalculating > 0;}
+                void set_calculating(bool b){if (b) ++funcCalculating; else --funcCalculating;}
                 void set_early_shutdown_in_progress(){earlyShutdownInProgress=true;}
                 bool early_shutdown_in_progress() const {return earlyShutdownInProgress;}
                 bool resume_mode() const { return printer->resume_mode(); }
@@ -66,6 +66,16 @@ namespace Gambit
                                 }
                         }
                         
+                        void transformArray(const double *unit, double *phys) const
+                        {
+                                for (int i = 0, end = param_names.size(); i < end; i++)
+                                {
+                                        phys[param_index[i]] = std::tan(M_PI*(unit[i] - 0.5));
+                                }
+                                
+                                col.ElMult(phys, param_index.data(), mean);
+                        }
+                        
                         double operator()(const std::vector<double> &vec) const
                         {
                                 static double norm = std::log(Gambit::Scanner::pi()*col.DetSqrt());
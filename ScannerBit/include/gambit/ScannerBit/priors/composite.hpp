@@ -50,6 +50,13 @@ namespace Gambit
             // References to component prior objects
             std::vector<BasePrior*> my_subpriors;
             std::vector<std::string> shown_param_names;
+            // Parameter order of the transformArray output, and where each subprior's unit parameters start
+            std::vector<std::string> output_names;
+            std::vector<int> unit_offsets;
+            // Output positions of parameters whose values are supplied by the scanner (prior "none")
+            std::vector<int> input_index;
+
+            void setOutputLayout();
                 
         public:
         
@@ -60,16 +67,57 @@ namespace Gambit
             
             inline std::vector<std::string> getShownParameters() const {return shown_param_names;}
             
+            /// Parameter order of the arrays written by transformArray and transformBatch
+            inline const std::vector<std::string> &getOutputParameters() const {return output_names;}
+            
             // Transformation from unit hypercube to my_ranges
             void transform(const std::vector<double> &unitPars, std::unordered_map<std::string,double> &outputMap) const
             {
-                std::vector<double>::const_iterator unit_it = unitPars.begin(), unit_next;
-                for (auto it = my_subpriors.begin(), end = my_subpriors.end(); it != end; it++)
+                static thread_local std::vector<double> phys;
+                phys.resize(output_names.size());
+                
+                for (auto it = input_index.begin(), end = input_index.end(); it != end; it++)
+                {
+                    auto find_it = outputMap.find(output_names[*it]);
+                    if (find_it == outputMap.end())
+                    {
+                        scan_err << "Parameter " << output_names[*it] << " prior is specified as 'none'"
+                                 << " and the scanner has not inputed a value for it."
+                                 << scan_end;
+                    }
+                    else
+                    {
+                        phys[*it] = find_it->second;
+                    }
+                }
+                
+                transformArray(unitPars.data(), phys.data());
+                
+                for (int i = 0, end = output_names.size(); i < end; i++)
+                {
+                    outputMap[output_names[i]] = phys[i];
+                }
+            }
+            
+            /// Transformation from unit hypercube to an array in the order of getOutputParameters().
+            /// Parameters with prior "none" are left as they are in phys.
+            void transformArray(const double *unit, double *phys) const
+            {
+                auto off_it = unit_offsets.begin();
+                for (auto it = my_subpriors.begin(), end = my_subpriors.end(); it != end; it++, off_it++)
+                {
+                    (*it)->transformArray(unit + *off_it, phys);
+                }
+            }
+            
+            /// Transform npoints points at once.  Point i is read from unit + i*size() and written to
+            /// phys + i*getOutputParameters().size().
+            void transformBatch(const double *unit, double *phys, std::size_t npoints) const
+            {
+                const std::size_t nunit = size(), nphys = output_names.size();
+                for (std::size_t i = 0; i < npoints; i++)
                 {
-                    unit_next = unit_it + (*it)->size();
-                    std::vector<double> subUnit(unit_it, unit_next);
-                    unit_it = unit_next;
-                    (*it)->transform(subUnit, outputMap);
+                    transformArray(unit + i*nunit, phys + i*nphys);
                 }
             }
             
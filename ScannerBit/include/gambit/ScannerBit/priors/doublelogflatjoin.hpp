@@ -60,12 +60,16 @@ namespace Gambit
          /// Try to get options for double log-flat joined prior
          double get_option(const str&, const Options&);
 
+         /// Transformation of a single unit interval value
+         double transformValue(double r) const;
+
       public: 
          /// Constructor defined in doublelogflatjoin.cpp
          DoubleLogFlatJoin(const std::vector<std::string>& param, const Options&); 
 
          /// Transformation from unit interval to the double log + flat join (inverse prior transform)
          void transform(const std::vector <double> &unitpars, std::unordered_map <std::string, double> &output) const;
+         void transformArray(const double *unit, double *phys) const;
 
          /// Probability density function
          double operator()(const std::vector<double> &vec) const;
@@ -44,6 +44,14 @@ namespace Gambit
                     outputMap[*it] = *(it_vec++);
                 }
             }
+
+            void transformArray(const double *unit, double *phys) const
+            {
+                for (int i = 0, end = param_index.size(); i < end; i++)
+                {
+                    phys[param_index[i]] = unit[i];
+                }
+            }
         };
 
         class None : public BasePrior
@@ -67,6 +75,9 @@ namespace Gambit
                     }
                 }
             }
+
+            // The scanner supplies these values, so they are already in place.
+            void transformArray(const double *, double *) const {}
         };
 
         LOAD_PRIOR(dummy, Dummy)
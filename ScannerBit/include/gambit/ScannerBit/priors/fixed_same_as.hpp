@@ -84,6 +84,15 @@ namespace Gambit
 
                 iter = (iter + 1)%value.size();
             }
+
+            void transformArray(const double *, double *phys) const
+            {
+                for (auto it = param_index.begin(), end = param_index.end(); it != end; it++)
+                {
+                    phys[*it] = value[iter];
+                }
+                iter = (iter + 1)%value.size();
+            }
         };
 
         //if the parameter shares multiple different parameters
@@ -92,9 +101,10 @@ namespace Gambit
         private:
             std::string name;
             std::vector<double> scale, shift;
+            int name_index;
 
         public:
-            MultiPriors(const std::vector<std::string>& param, const Options& options) : BasePrior(param), scale(param.size(), 1.0), shift(param.size(), 0.0)
+            MultiPriors(const std::vector<std::string>& param, const Options& options) : BasePrior(param), scale(param.size(), 1.0), shift(param.size(), 0.0), name_index(0)
             {
                 if (options.hasKey("same_as"))
                 {
@@ -117,7 +127,7 @@ namespace Gambit
                 }
             }
 
-            MultiPriors(std::string name_in, std::unordered_map<std::string, std::pair<double, double> > &map_in)
+            MultiPriors(std::string name_in, std::unordered_map<std::string, std::pair<double, double> > &map_in) : name_index(0)
             {
                 std::string::size_type pos_old = 0;
                 std::string::size_type pos = name_in.find("+");
@@ -141,6 +151,8 @@ namespace Gambit
 
                 name = name_in.substr(pos_old);
                 param_names.push_back(name_in);
+                scale.push_back(1.0);
+                shift.push_back(0.0);
             }
 
             void transform (const std::vector<double> &, std::unordered_map<std::string, double> &outputMap) const
@@ -153,6 +165,30 @@ namespace Gambit
                     outputMap[*it] = (*it1)*value + *it2;
                 }
             }
+
+            void transformArray(const double *, double *phys) const
+            {
+                double value = phys[name_index];
+                auto it1 = scale.begin(), it2 = shift.begin();
+                for (auto it = param_index.begin(), end = param_index.end(); it != end; ++it, ++it1, ++it2)
+                {
+                    phys[*it] = (*it1)*value + *it2;
+                }
+            }
+
+            void setOutputIndices(const std::unordered_map<std::string, int> &index)
+            {
+                BasePrior::setOutputIndices(index);
+                auto it = index.find(name);
+                if (it == index.end())
+                {
+                    scan_err << "same_as:  " << name << " is not a parameter of this prior." << scan_end;
+                }
+                else
+                {
+                    name_index = it->second;
+                }
+            }
         };
 
         LOAD_PRIOR(fixed_value, FixedPrior)
@@ -211,6 +211,11 @@ namespace Gambit
                 output[myparameter] = (T::inv(unitpars[0]*(upper-lower) + lower)-shift_out)/scale_out;
             }
 
+            void transformArray(const double *unit, double *phys) const
+            {
+                phys[param_index[0]] = (T::inv(unit[0]*(upper-lower) + lower)-shift_out)/scale_out;
+            }
+
             double operator()(const std::vector<double> &vec) const {return T::prior(vec[0]*scale+shift)*scale;}
         };
 
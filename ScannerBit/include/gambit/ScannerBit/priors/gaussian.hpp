@@ -66,6 +66,16 @@ namespace Gambit
                     outputMap[*str_it] = *(v_it++) + *(m_it++);
                 }
             }
+
+            void transformArray(const double *unit, double *phys) const
+            {
+                for (int i = 0, end = param_names.size(); i < end; i++)
+                {
+                    phys[param_index[i]] = M_SQRT2*boost::math::erf_inv(2.0*unit[i] - 1.0);
+                }
+
+                col.ElMult(phys, param_index.data(), mean);
+            }
             
             double operator()(const std::vector<double> &vec) const
             {
@@ -0,0 +1,147 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Scrambled Sobol and Halton low-discrepancy
+///  sequences in the unit hypercube.  Points are
+///  computed directly from their index, so any
+///  process can skip ahead to any point.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef LOW_DISCREPANCY_HPP
+#define LOW_DISCREPANCY_HPP
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+
+/// Base class of the low-discrepancy sequences.
+class low_discrepancy_sequence
+{
+public:
+    /// Fill x with point number n (n >= 1) of the sequence.
+    virtual void point(unsigned long long n, std::vector<double> &x) const = 0;
+    virtual ~low_discrepancy_sequence() {}
+};
+
+/// Sobol sequence with direction numbers of Joe & Kuo (2008) and a random digital shift.
+class sobol_sequence : public low_discrepancy_sequence
+{
+private:
+    static const int bits = 32;
+    int dim;
+    std::vector<std::vector<std::uint32_t>> v;
+    std::vector<std::uint32_t> shift;
+
+public:
+    /// Largest dimension for which direction numbers are tabulated.
+    static int max_dimension() {return 21;}
+
+    sobol_sequence(int dim, unsigned long long seed, bool scramble) : dim(dim), v(dim, std::vector<std::uint32_t>(bits)), shift(dim, 0)
+    {
+        // Degree s, polynomial coefficients a and initial direction numbers m of dimensions 2-21.
+        static const int s[] = {1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7};
+        static const int a[] = {0, 1, 1, 2, 1, 4, 2, 4, 7, 11, 13, 14, 1, 13, 16, 19, 22, 25, 1, 4};
+        static const int m[][7] =
+        {
+            {1}, {1, 3}, {1, 3, 1}, {1, 1, 1}, {1, 1, 3, 3}, {1, 3, 5, 13},
+            {1, 1, 5, 5, 17}, {1, 1, 5, 5, 5}, {1, 1, 7, 11, 19}, {1, 1, 5, 1, 1}, {1, 1, 1, 3, 11}, {1, 3, 5, 5, 31},
+            {1, 3, 3, 9, 7, 49}, {1, 1, 1, 15, 21, 21}, {1, 3, 1, 13, 27, 49}, {1, 1, 1, 15, 7, 5}, {1, 3, 1, 15, 13, 25}, {1, 1, 5, 5, 19, 61},
+            {1, 3, 7, 11, 23, 15, 103}, {1, 3, 7, 13, 13, 15, 69}
+        };
+
+        if (dim > 0)
+            for (int i = 0; i < bits; i++)
+                v[0][i] = std::uint32_t(1) << (bits - 1 - i);
+
+        for (int j = 1; j < dim; j++)
+        {
+            const int sj = s[j-1], aj = a[j-1];
+            for (int i = 0; i < sj && i < bits; i++)
+                v[j][i] = std::uint32_t(m[j-1][i]) << (bits - 1 - i);
+            for (int i = sj; i < bits; i++)
+            {
+                v[j][i] = v[j][i-sj] ^ (v[j][i-sj] >> sj);
+                for (int k = 1; k < sj; k++)
+                    v[j][i] ^= ((aj >> (sj - 1 - k)) & 1) * v[j][i-k];
+            }
+        }
+
+        if (scramble)
+        {
+            std::mt19937_64 gen(seed);
+            for (auto &&sh : shift)
+                sh = std::uint32_t(gen() >> 32);
+        }
+    }
+
+    void point(unsigned long long n, std::vector<double> &x) const
+    {
+        unsigned long long gray = n ^ (n >> 1);
+        for (int j = 0; j < dim; j++)
+        {
+            std::uint32_t xi = shift[j];
+            unsigned long long g = gray;
+            for (int i = 0; g != 0 && i < bits; i++, g >>= 1)
+                if (g & 1) xi ^= v[j][i];
+            x[j] = (double(xi) + 0.5)/4294967296.0;
+        }
+    }
+};
+
+/// Halton sequence with random digit permutations (keeping 0 fixed) in each prime base.
+class halton_sequence : public low_discrepancy_sequence
+{
+private:
+    int dim;
+    std::vector<unsigned int> bases;
+    std::vector<std::vector<unsigned int>> perms;
+
+public:
+    halton_sequence(int dim, unsigned long long seed, bool scramble) : dim(dim), perms(dim)
+    {
+        for (unsigned int p = 2; (int)bases.size() < dim; p++)
+        {
+            bool prime = true;
+            for (auto &&b : bases)
+            {
+                if (b*b > p) break;
+                if (p%b == 0) {prime = false; break;}
+            }
+            if (prime) bases.push_back(p);
+        }
+
+        std::mt19937_64 gen(seed);
+        for (int j = 0; j < dim; j++)
+        {
+            perms[j].resize(bases[j]);
+            for (unsigned int d = 0; d < bases[j]; d++)
+                perms[j][d] = d;
+            if (scramble)
+                std::shuffle(perms[j].begin() + 1, perms[j].end(), gen);
+        }
+    }
+
+    void point(unsigned long long n, std::vector<double> &x) const
+    {
+        for (int j = 0; j < dim; j++)
+        {
+            const unsigned long long b = bases[j];
+            double inv = 1.0/b, f = inv, xj = 0.0;
+            for (unsigned long long k = n; k > 0; k /= b, f *= inv)
+                xj += perms[j][k%b]*f;
+            x[j] = xj;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,128 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Surrogate-model pre-screening of likelihood
+///  evaluations for any scanner plugin.
+///
+///  Header file
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __surrogate_hpp__
+#define __surrogate_hpp__
+
+#include <vector>
+#include <string>
+#include <limits>
+#include <unordered_map>
+
+#include "gambit/ScannerBit/scanner_plugin.hpp"
+
+namespace Gambit
+{
+  namespace Surrogate
+  {
+    typedef Scanner::Function_Base<double (std::unordered_map<std::string, double> &)> like_base;
+
+    /// Options controlling when a likelihood evaluation may be skipped.
+    struct surrogate_settings
+    {
+      /// Number of nearest neighbours used for each prediction
+      int k;
+      /// Number of true evaluations needed before any point is screened
+      int min_training;
+      /// Maximum number of evaluated points kept for training (oldest are dropped first)
+      int max_training;
+      /// Points are only screened if predicted to lie this far below the best lnL seen so far
+      double delta_lnL;
+      /// Number of standard deviations of the neighbours' lnL added to the prediction before comparing
+      double n_sigma;
+      /// Largest (range-normalised) distance to the nearest neighbour for which predictions are trusted
+      double max_distance;
+      /// Fraction of screened points that are still evaluated exactly
+      double true_fraction;
+    };
+
+    /// Running tally of screened and evaluated points.
+    struct surrogate_stats
+    {
+      long long evaluated;
+      long long skipped;
+      surrogate_stats() : evaluated(0), skipped(0) {}
+    };
+
+    /// k-nearest-neighbour regression of lnL on the physical parameters of already-evaluated points.
+    class knn_surrogate
+    {
+      private:
+        int dim;
+        int max_size;
+        int next;
+        std::vector<std::vector<double>> points;
+        std::vector<double> values;
+        std::vector<double> low, high;
+
+      public:
+        knn_surrogate(int dim, int max_size);
+
+        /// Add an exactly evaluated point to the training set.
+        void add(const std::vector<double> &x, double lnL);
+
+        /// Predict lnL at x from its k nearest neighbours, with each neighbour's lnL clamped from
+        /// below at floor.  Returns false if there are too few neighbours to make a prediction.
+        bool predict(const std::vector<double> &x, int k, double floor, double &mean, double &sigma, double &nearest) const;
+
+        int size() const { return values.size(); }
+    };
+
+    /// Likelihood function handed to the wrapped scanner.  Forwards to the real likelihood unless
+    /// the surrogate confidently predicts a value far below the best lnL found so far.
+    class surrogate_function : public like_base
+    {
+      private:
+        like_base *real;
+        const surrogate_settings &settings;
+        surrogate_stats &stats;
+        knn_surrogate model;
+        std::vector<std::string> keys;
+        std::vector<double> x;
+        double best;
+        bool synced;
+
+        /// Print the physical parameters of a point that is not evaluated.
+        void print_parameters(std::unordered_map<std::string, double> &map);
+
+      public:
+        surrogate_function(like_base *real, const surrogate_settings &settings, surrogate_stats &stats);
+        ~surrogate_function();
+
+        double main(std::unordered_map<std::string, double> &map);
+    };
+
+    /// Factory passed to the wrapped scanner in place of the original one.
+    class surrogate_factory : public Scanner::Factory_Base
+    {
+      private:
+        const Scanner::Factory_Base &factory;
+        std::string purpose;
+        const surrogate_settings &settings;
+        surrogate_stats &stats;
+
+      public:
+        surrogate_factory(const Scanner::Factory_Base &factory, const std::string &purpose, const surrogate_settings &settings, surrogate_stats &stats)
+          : factory(factory), purpose(purpose), settings(settings), stats(stats) {}
+
+        void *operator()(const std::string &purpose) const;
+    };
+  }
+}
+
+#endif // #defined __surrogate_hpp__
@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+#
+# GAMBIT: Global and Modular BSM Inference Tool
+#*********************************************
+# \file
+#
+#  Check of the threaded ensemble sampler.
+#
+#  Runs ScannerBit_standalone on
+#  yaml_files/ScannerBit_ensemble.yaml with one
+#  and with several OpenMP threads, and checks
+#  that
+#   - both runs give exactly the same samples,
+#     as the proposals do not depend on the
+#     number of threads;
+#   - the multiplicity-weighted means and widths
+#     of the samples recover those of the
+#     gaussian objective.
+#
+#  Usage (from the GAMBIT root directory):
+#    python ScannerBit/scripts/check_ensemble.py [threads]
+#
+#  Needs h5py and numpy.
+#
+#*********************************************
+
+from __future__ import print_function
+import os
+import re
+import sys
+import shutil
+import tempfile
+import subprocess
+
+import h5py
+import numpy as np
+
+yaml_file = "yaml_files/ScannerBit_ensemble.yaml"
+executable = "./ScannerBit_standalone"
+group = "ensemble"
+
+# As in the yaml file
+mean = np.array([0.5, -1.0, 0.0, 2.0])
+sigs = np.array([0.5, 1.0, 0.2, 1.5])
+
+# Largest accepted deviation of the means, in units of the widths, and of the widths, relative
+mean_tolerance = 0.1
+width_tolerance = 0.1
+
+
+def run(threads, workdir):
+    """Run the scan with the given number of threads, and return its samples and their multiplicities."""
+    path = os.path.join(workdir, "threads_%d" % threads)
+    with open(yaml_file) as f:
+        config = f.read()
+    config = re.sub(r'default_output_path: *"[^"]*"', 'default_output_path: "%s"' % path, config)
+    run_yaml = os.path.join(workdir, "ensemble_%d.yaml" % threads)
+    with open(run_yaml, "w") as f:
+        f.write(config)
+
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    subprocess.check_call([executable, "-f", run_yaml], env=env)
+
+    with h5py.File(os.path.join(path, "samples", "ensemble.hdf5"), "r") as f:
+        data = f[group]
+        names = sorted((int(m.group(1)), name) for name in data.keys()
+                       for m in [re.search(r"param_(\d+)$", name)] if m)
+        valid = np.array(data["mult_isvalid"], dtype=bool)
+        for _, name in names:
+            valid &= np.array(data[name + "_isvalid"], dtype=bool)
+        points = np.column_stack([np.array(data[name])[valid] for _, name in names])
+        mult = np.array(data["mult"])[valid]
+    return points, mult
+
+
+def main(argv):
+    threads = int(argv[1]) if len(argv) > 1 else 4
+    workdir = tempfile.mkdtemp(prefix="check_ensemble_")
+    failed = False
+    try:
+        serial = run(1, workdir)
+        threaded = run(threads, workdir)
+
+        # Point IDs are claimed in a different order by the threads, so compare the sorted samples.
+        def rows(sample):
+            return sorted(map(tuple, np.column_stack(sample)))
+        if rows(serial) != rows(threaded):
+            print("FAIL: the samples with 1 and %d threads differ." % threads)
+            failed = True
+        else:
+            print("OK: the samples with 1 and %d threads are identical." % threads)
+
+        points, mult = threaded
+        weights = mult/float(mult.sum())
+        found_mean = np.dot(weights, points)
+        found_sigs = np.sqrt(np.dot(weights, (points - found_mean)**2))
+        for i in range(len(mean)):
+            ok = (abs(found_mean[i] - mean[i]) < mean_tolerance*sigs[i] and
+                  abs(found_sigs[i]/sigs[i] - 1) < width_tolerance)
+            print("%s: param_%d mean %.3f (expected %.3f), width %.3f (expected %.3f)" %
+                  ("OK" if ok else "FAIL", i, found_mean[i], mean[i], found_sigs[i], sigs[i]))
+            failed = failed or not ok
+    finally:
+        shutil.rmtree(workdir)
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -85,7 +85,8 @@ objective_plugin(gaussian, version(1, 0, 0))
     
     double plugin_main(std::unordered_map<std::string, double> &map)
     {
-        static std::vector<double> params(get_keys().size());
+        // Local rather than static, so that several threads can evaluate the objective at once.
+        std::vector<double> params(get_keys().size());
         
         print_parameters(map);
         
@@ -25,8 +25,10 @@
 ///  *********************************************
 
 #include <cstdlib>
+#include <cstdio>
 #include <iomanip>
 #include <unistd.h>
+#include <sys/stat.h>
 #include <iostream>
 #include <fstream>
 #include <stdio.h>
@@ -72,26 +74,16 @@ namespace Gambit
                 return table.str();
             }
 
-            Plugin_Loader::Plugin_Loader() : path(GAMBIT_DIR "/ScannerBit/lib/")
+            Plugin_Loader::Plugin_Loader() : path(GAMBIT_DIR "/ScannerBit/lib/"), registry_file(GAMBIT_DIR "/scratch/scanbit_plugin_registry.yaml"), registry_changed(false)
             {
                 std::string p_str;
                 std::ifstream lib_list(path + "plugin_libraries.list");
-                //if (FILE* p_f = popen((std::string("ls ") + path).c_str(), "r"))
                 if (lib_list.is_open())
                 {
-                    /*char path_buffer[1024];
-                    int p_n;
-                    std::stringstream p_ss;
+                    loadRegistry();
 
-                    while ((p_n = fread(path_buffer, 1, sizeof path_buffer, p_f)) > 0)
-                    {
-                        p_ss << std::string(path_buffer, p_n);
-                    }*/
-
-                    //while (p_ss >> p_str)
                     while (lib_list >> p_str)
                     {
-                        //if (p_str.find(".so") != std::string::npos && p_str.find(".so.") == std::string::npos)
                         p_str = path + p_str;
                         if(access(p_str.c_str(), F_OK) != -1) //can use R_OK|W_OK|X_OK also
                             loadLibrary (p_str);
@@ -99,7 +91,7 @@ namespace Gambit
                             scan_warn << "Could not find plugin library \"" << p_str << "\"." << scan_end;
                     }
 
-                    //pclose(p_f);
+                    saveRegistry();
 
                     loadExcluded(GAMBIT_DIR "/scratch/scanbit_excluded_libs.yaml");
 
@@ -112,6 +104,114 @@ namespace Gambit
                 }
             }
 
+            void Plugin_Loader::loadRegistry()
+            {
+                if (access(registry_file.c_str(), R_OK) == -1)
+                    return;
+
+                try
+                {
+                    YAML::Node node = YAML::LoadFile(registry_file);
+                    if (node.IsMap())
+                        registry_node = node;
+                }
+                catch (YAML::Exception &)
+                {
+                    // A corrupt registry is simply rebuilt from scratch.
+                    registry_node = YAML::Node();
+                    registry_changed = true;
+                }
+            }
+
+            void Plugin_Loader::saveRegistry()
+            {
+                if (!registry_changed)
+                    return;
+
+                // Write to a unique temporary file and rename it into place, so that
+                // concurrently starting processes never see a partially written registry.
+                std::string temp_file = registry_file + "." + std::to_string(getpid()) + ".tmp";
+                std::ofstream out(temp_file.c_str());
+                if (!out.is_open())
+                    return;
+
+                out << "# Plugin symbols found in each ScannerBit plugin library, keyed by library path.\n"
+                    << "# Entries are regenerated automatically whenever a library's mtime or size changes.\n";
+                out << registry_node << std::endl;
+                out.close();
+
+                if (out.fail() || std::rename(temp_file.c_str(), registry_file.c_str()) != 0)
+                    std::remove(temp_file.c_str());
+                else
+                    registry_changed = false;
+            }
+
+            std::vector<std::string> Plugin_Loader::findPluginSymbols (const std::string &p_str)
+            {
+                std::vector<std::string> symbols;
+                struct stat lib_stat;
+
+                if (stat(p_str.c_str(), &lib_stat) == 0)
+                {
+                    long long mtime = static_cast<long long>(lib_stat.st_mtime);
+                    long long size = static_cast<long long>(lib_stat.st_size);
+                    YAML::Node entry = registry_node[p_str];
+
+                    if (entry.IsMap() && entry["mtime"] && entry["size"] && entry["symbols"] &&
+                        entry["mtime"].as<long long>() == mtime && entry["size"].as<long long>() == size)
+                    {
+                        return entry["symbols"].as<std::vector<std::string>>();
+                    }
+
+                    symbols = scanLibrary(p_str);
+
+                    YAML::Node new_entry;
+                    new_entry["mtime"] = mtime;
+                    new_entry["size"] = size;
+                    new_entry["symbols"] = symbols;
+                    registry_node[p_str] = new_entry;
+                    registry_changed = true;
+                }
+                else
+                {
+                    symbols = scanLibrary(p_str);
+                }
+
+                return symbols;
+            }
+
+            std::vector<std::string> Plugin_Loader::scanLibrary (const std::string &p_str) const
+            {
+                std::vector<std::string> symbols;
+                std::string str;
+                if (FILE* f = popen((std::string("nm ") + p_str + std::string(" | grep \"__gambit_plugin_pluginInit_\"")).c_str(), "r"))
+                {
+                    char buffer[1024];
+                    int n;
+                    std::stringstream ss;
+
+                    while ((n = fread(buffer, 1, sizeof buffer, f)) > 0)
+                    {
+                        ss << std::string(buffer, n);
+                    }
+
+                    while(std::getline(ss, str))
+                    {
+                        std::string::size_type pos = str.find("__gambit_plugin_pluginInit_");
+
+                        if (pos != std::string::npos &&
+                                (str.rfind(" T ", pos) != std::string::npos || str.rfind(" t ", pos) != std::string::npos))
+                        {
+                            symbols.push_back(str.substr(pos + 27, str.rfind("__") - pos - 27));
+                        }
+                    }
+
+                    pclose(f);
+                }
+
+                return symbols;
+            }
+
             void Plugin_Loader::process(const std::string &libFile, const std::string &plugFile, const std::string &flagFile)
             {
                 YAML::Node libNode = YAML::LoadFile(libFile);
@@ -192,37 +292,18 @@ namespace Gambit
 
             void Plugin_Loader::loadLibrary (const std::string &p_str, const std::string &plug)
             {
-                std::string str;
-                if (FILE* f = popen((std::string("nm ") + p_str + std::string(" | grep \"__gambit_plugin_pluginInit_\"")).c_str(), "r"))
-                {
-                    char buffer[1024];
-                    int n;
-                    std::stringstream ss;
+                std::vector<std::string> symbols = findPluginSymbols(p_str);
 
-                    while ((n = fread(buffer, 1, sizeof buffer, f)) > 0)
-                    {
-                        ss << std::string(buffer, n);
-                    }
+                for (auto it = symbols.begin(), end = symbols.end(); it != end; ++it)
+                {
+                    Plugin_Details temp(*it);
 
-                    while(std::getline(ss, str))
+                    if (plug == "" || temp.plugin == plug)
                     {
-                        std::string::size_type pos = str.find("__gambit_plugin_pluginInit_");
-
-                        if (pos != std::string::npos &&
-                                (str.rfind(" T ", pos) != std::string::npos || str.rfind(" t ", pos) != std::string::npos))
-                        {
-                            Plugin_Details temp(str.substr(pos + 27, str.rfind("__") - pos - 27));
-
-                            if (plug == "" || temp.plugin == plug)
-                            {
-                                temp.path = p_str;
-                                plugins.push_back(temp);
-                                total_plugins.push_back(temp);
-                            }
-                        }
+                        temp.path = p_str;
+                        plugins.push_back(temp);
+                        total_plugins.push_back(temp);
                     }
-
-                    pclose(f);
                 }
             }
 
@@ -682,7 +763,7 @@ namespace Gambit
             }
 
             pluginInfo::pluginInfo()
-              : keepRunning(true), funcCalculating(false), MPIrank(0)
+              : keepRunning(true), funcCalculating(0), MPIrank(0)
               #ifdef WITH_MPI
               , scannerComm(NULL), MPIdata_is_init(false)
               #endif
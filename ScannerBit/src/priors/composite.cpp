@@ -419,6 +419,8 @@ namespace Gambit
             setSize(param_size);
             
             my_subpriors.insert(my_subpriors.end(), phantomPriors.begin(), phantomPriors.end());
+            
+            setOutputLayout();
         }  
         
         CompositePrior::CompositePrior(const std::vector<std::string> &params_in, const Options &options_in) : BasePrior(params_in), shown_param_names(params_in)
@@ -589,6 +591,46 @@ namespace Gambit
             }
             
             setSize(param_size);
+            
+            setOutputLayout();
+        }
+        
+        // Assign every parameter of every subprior a fixed position in the output array, so that
+        // transformArray can run without any parameter name lookups.
+        void CompositePrior::setOutputLayout()
+        {
+            std::unordered_map<std::string, int> index;
+            int unit_offset = 0;
+            
+            output_names.clear();
+            unit_offsets.clear();
+            input_index.clear();
+            
+            for (auto subprior = my_subpriors.begin(), subprior_end = my_subpriors.end(); subprior != subprior_end; subprior++)
+            {
+                std::vector<std::string> params = (*subprior)->getParameters();
+                for (auto par_it = params.begin(), par_end = params.end(); par_it != par_end; par_it++)
+                {
+                    if (index.find(*par_it) == index.end())
+                    {
+                        index[*par_it] = output_names.size();
+                        output_names.push_back(*par_it);
+                        
+                        if (dynamic_cast<None *>(*subprior) != 0)
+                        {
+                            input_index.push_back(index[*par_it]);
+                        }
+                    }
+                }
+                
+                unit_offsets.push_back(unit_offset);
+                unit_offset += (*subprior)->size();
+            }
+            
+            for (auto subprior = my_subpriors.begin(), subprior_end = my_subpriors.end(); subprior != subprior_end; subprior++)
+            {
+                (*subprior)->setOutputIndices(index);
+            }
         }
     } // end namespace Priors
 } // end namespace Gambit
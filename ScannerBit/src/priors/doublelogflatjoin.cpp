@@ -172,8 +172,17 @@ namespace Gambit
              scan_err << "Invalid input to DoubleLogFlatJoin prior (in 'transform'): Input parameters must be a vector of size 1! (has size=" << unitpars.size() << ")" << scan_end;
          }
 
+         output[myparameter] = transformValue(unitpars[0]);
+      }
+
+      void DoubleLogFlatJoin::transformArray(const double *unit, double *phys) const
+      {
+         phys[param_index[0]] = transformValue(unit[0]);
+      }
+
+      double DoubleLogFlatJoin::transformValue(double r) const
+      {
          double x = 0; // output (result)
-         double r = unitpars[0]; // input unit cube parameter
          double x0 = lower;
          double x1 = flat_start;
          double x2 = flat_end;
@@ -195,7 +204,7 @@ namespace Gambit
              scan_err << "Problem transforming r-value for DoubleLogFlatJoin (received "<<r<<")!" << scan_end;
          }
 
-         output[myparameter] = x;
+         return x;
       }
       
       double DoubleLogFlatJoin::operator()(const std::vector<double> &vec) const
@@ -0,0 +1,248 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Affine-invariant ensemble sampler (Goodman &
+///  Weare stretch move).  The walkers of each half
+///  of the ensemble are evaluated concurrently on
+///  OpenMP threads within a process, and spread
+///  over MPI processes across nodes.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+//
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifdef WITH_MPI
+#include "mpi.h"
+#endif
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <iostream>
+
+#include <omp.h>
+
+#include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "gambit/Utils/threadsafe_rng.hpp"
+
+scanner_plugin(ensemble, version(1, 0, 0))
+{
+    int dim, nwalkers, niter, nthreads, rank, numtasks;
+    double stretch;
+    long long int seed;
+    /// One likelihood context per thread, so that threads never share a parameter map or prior workspace
+    std::vector<like_ptr> LogLikes;
+
+    plugin_constructor
+    {
+        std::string purpose = get_inifile_value<std::string>("like", "LogLike");
+        dim = get_dimension();
+        nwalkers = get_inifile_value<int>("walkers", 2*dim + 2);
+        niter = get_inifile_value<int>("iterations", 1000);
+        stretch = get_inifile_value<double>("stretch", 2.0);
+        nthreads = get_inifile_value<int>("threads", 1);
+
+        if (nwalkers % 2 != 0)
+            nwalkers++;
+        if (nwalkers < 2*dim)
+            scan_err << "Ensemble:  need at least twice as many walkers as parameters (" << 2*dim << "), but only " << nwalkers << " were requested." << scan_end;
+        if (stretch <= 1.0)
+            scan_err << "Ensemble:  the stretch scale must be larger than 1." << scan_end;
+        if (nthreads <= 0)
+            nthreads = omp_get_max_threads();
+
+#ifdef WITH_MPI
+        MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#else
+        numtasks = 1;
+        rank = 0;
+#endif
+
+        // All processes must propose the same moves, so they share one seed.
+        seed = get_inifile_value<long long int>("ran_seed", 0);
+        if (seed == 0 && rank == 0)
+            seed = 1 + static_cast<long long int>(Gambit::Random::draw()*2147483647.0);
+#ifdef WITH_MPI
+        MPI_Bcast(&seed, 1, MPI_LONG_LONG, 0, MPI_COMM_WORLD);
+#endif
+
+        LogLikes.resize(nthreads);
+        for (auto &&like : LogLikes)
+        {
+            like = get_purpose(purpose);
+            like->disable_external_shutdown();
+        }
+    }
+
+    /// Evaluate the points flagged in todo, spreading them over processes and over the threads of each process.
+    void evaluate(const std::vector<std::vector<double>> &points, const std::vector<bool> &todo,
+                  std::vector<double> &lnL, std::vector<unsigned long long int> &ids, std::vector<int> &ranks)
+    {
+        int N = points.size();
+        std::vector<int> mine;
+        for (int i = 0, count = 0; i < N; i++)
+        {
+            if (todo[i])
+            {
+                if (count%numtasks == rank) mine.push_back(i);
+                count++;
+            }
+        }
+
+        std::vector<double> lnL_buf(N, 0.0);
+        std::vector<unsigned long long int> id_buf(N, 0);
+        std::vector<int> rank_buf(N, 0);
+        int nmine = mine.size();
+
+        #pragma omp parallel num_threads(nthreads)
+        {
+            like_ptr &LogLike = LogLikes[omp_get_thread_num()];
+
+            #pragma omp for schedule(dynamic)
+            for (int m = 0; m < nmine; m++)
+            {
+                int i = mine[m];
+                lnL_buf[i] = LogLike(points[i]);
+                id_buf[i] = LogLike->getPtID();
+                rank_buf[i] = LogLike->getRank();
+            }
+
+            Gambit::Printers::release_point_id();
+        }
+
+#ifdef WITH_MPI
+        if (numtasks > 1)
+        {
+            MPI_Allreduce(MPI_IN_PLACE, &lnL_buf[0], N, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+            MPI_Allreduce(MPI_IN_PLACE, &id_buf[0], N, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+            MPI_Allreduce(MPI_IN_PLACE, &rank_buf[0], N, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+        }
+#endif
+
+        for (int i = 0; i < N; i++)
+        {
+            if (todo[i])
+            {
+                lnL[i] = lnL_buf[i];
+                ids[i] = id_buf[i];
+                ranks[i] = rank_buf[i];
+            }
+        }
+    }
+
+    int plugin_main ()
+    {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> unif(0.0, 1.0);
+        int half = nwalkers/2;
+
+        std::vector<std::vector<double>> walkers(nwalkers, std::vector<double>(dim));
+        std::vector<double> lnL(nwalkers);
+        std::vector<unsigned long long int> ids(nwalkers);
+        std::vector<int> ranks(nwalkers), mult(nwalkers, 1);
+
+        std::vector<std::vector<double>> proposals(nwalkers, std::vector<double>(dim));
+        std::vector<double> lnL_prop(nwalkers), z(nwalkers);
+        std::vector<unsigned long long int> ids_prop(nwalkers);
+        std::vector<int> ranks_prop(nwalkers);
+
+        Gambit::Options txt_options;
+        txt_options.setValue("synchronised",false);
+        get_printer().new_stream("txt", txt_options);
+        Gambit::Scanner::printer *out_stream = get_printer().get_stream("txt");
+        out_stream->reset();
+        Gambit::Scanner::assign_aux_numbers("mult", "chain");
+
+        if (rank == 0)
+            std::cout << "Entering ensemble sampler." << "\n\twalkers:  " << nwalkers << "\n\titerations:  " << niter
+                      << "\n\tthreads per process:  " << nthreads << std::endl;
+
+        for (auto &&walker : walkers)
+            for (auto &&val : walker)
+                val = unif(gen);
+
+        evaluate(walkers, std::vector<bool>(nwalkers, true), lnL, ids, ranks);
+
+        long long int accepted = 0, total = 0;
+        int quit = 0;
+        for (int it = 0; it < niter && !quit; it++)
+        {
+            // Move each half of the ensemble using the other half, so that all moves within a half are independent.
+            for (int h = 0; h < 2; h++)
+            {
+                int begin = h*half, other = (1 - h)*half;
+                std::vector<bool> todo(nwalkers, false);
+
+                for (int k = begin; k < begin + half; k++)
+                {
+                    int j = other + std::min(int(unif(gen)*half), half - 1);
+                    double u = unif(gen);
+                    z[k] = std::pow((stretch - 1.0)*u + 1.0, 2)/stretch;
+
+                    bool inside = true;
+                    for (int i = 0; i < dim; i++)
+                    {
+                        proposals[k][i] = walkers[j][i] + z[k]*(walkers[k][i] - walkers[j][i]);
+                        if (proposals[k][i] < 0.0 || proposals[k][i] > 1.0)
+                            inside = false;
+                    }
+                    todo[k] = inside;
+                }
+
+                evaluate(proposals, todo, lnL_prop, ids_prop, ranks_prop);
+
+                for (int k = begin; k < begin + half; k++)
+                {
+                    double u = unif(gen);
+                    total++;
+                    if (todo[k] && std::log(u) < (dim - 1)*std::log(z[k]) + lnL_prop[k] - lnL[k])
+                    {
+                        if (rank == 0)
+                        {
+                            out_stream->print(mult[k], "mult", ranks[k], ids[k]);
+                            out_stream->print(k, "chain", ranks[k], ids[k]);
+                        }
+                        walkers[k] = proposals[k];
+                        lnL[k] = lnL_prop[k];
+                        ids[k] = ids_prop[k];
+                        ranks[k] = ranks_prop[k];
+                        mult[k] = 1;
+                        accepted++;
+                    }
+                    else
+                    {
+                        mult[k]++;
+                    }
+                }
+            }
+
+            quit = Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress();
+#ifdef WITH_MPI
+            MPI_Allreduce(MPI_IN_PLACE, &quit, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+            if (rank == 0 && (it + 1)%100 == 0)
+                std::cout << "iterations:  " << it + 1 << " / " << niter << "; accept ratio = " << double(accepted)/double(total) << std::endl;
+        }
+
+        if (rank == 0)
+        {
+            for (int k = 0; k < nwalkers; k++)
+            {
+                out_stream->print(mult[k], "mult", ranks[k], ids[k]);
+                out_stream->print(k, "chain", ranks[k], ids[k]);
+            }
+        }
+
+        return 0;
+    }
+}
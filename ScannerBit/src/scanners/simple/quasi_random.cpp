@@ -0,0 +1,104 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Quasi-random sampler, drawing points from a
+///  scrambled Sobol or Halton sequence.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+//
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifdef WITH_MPI
+#include "mpi.h"
+#endif
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <iostream>
+
+#include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "gambit/ScannerBit/scanners/simple/low_discrepancy.hpp"
+#include "gambit/Utils/threadsafe_rng.hpp"
+
+scanner_plugin(quasi_random, version(1, 0, 0))
+{
+    like_ptr LogLike;
+    int dim, numtasks, rank;
+    long long num;
+    std::string sequence;
+    bool scramble;
+
+    plugin_constructor
+    {
+        LogLike = get_purpose(get_inifile_value<std::string>("like"));
+        num = get_inifile_value<long long>("point_number", 1000);
+        sequence = get_inifile_value<std::string>("sequence", "sobol");
+        scramble = get_inifile_value<bool>("scramble", true);
+        dim = get_dimension();
+
+        if (sequence != "sobol" && sequence != "halton")
+            scan_err << "Quasi-random sampler:  unknown sequence \"" << sequence << "\"; choose \"sobol\" or \"halton\"." << scan_end;
+        if (sequence == "sobol" && dim > sobol_sequence::max_dimension())
+            scan_err << "Quasi-random sampler:  Sobol direction numbers are only available for up to " << sobol_sequence::max_dimension()
+                     << " dimensions; use \"sequence: halton\" for this " << dim << "-dimensional scan." << scan_end;
+
+#ifdef WITH_MPI
+        MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#else
+        numtasks = 1;
+        rank = 0;
+#endif
+    }
+
+    int plugin_main ()
+    {
+        // All processes must scramble the sequence in the same way, so they share one seed.
+        long long seed = get_inifile_value<long long>("ran_seed", 0);
+        if (seed == 0 && rank == 0)
+            seed = 1 + static_cast<long long>(Gambit::Random::draw()*2147483647.0);
+#ifdef WITH_MPI
+        MPI_Bcast(&seed, 1, MPI_LONG_LONG, 0, MPI_COMM_WORLD);
+#endif
+
+        // Each process takes every numtasks-th point of the sequence, so no coordination is needed.
+        // Resuming requires the same number of processes as the original run.
+        long long next = rank;
+        set_resume_params.set_resume_mode(get_printer().resume_mode());
+        set_resume_params(seed, next);
+
+        std::unique_ptr<low_discrepancy_sequence> points;
+        if (sequence == "sobol")
+            points.reset(new sobol_sequence(dim, seed, scramble));
+        else
+            points.reset(new halton_sequence(dim, seed, scramble));
+
+        std::vector<double> a(dim);
+
+        if (rank == 0)
+            std::cout << "Entering quasi-random sampler (" << sequence << " sequence)." << "\n\tnumber of points to calculate:  " << num << std::endl;
+
+        while (next < num)
+        {
+            // Skip the first point of the sequence (the origin, when unscrambled).
+            points->point(next + 1, a);
+            LogLike(a);
+            next += numtasks;
+
+            if (rank == 0 && (next/numtasks)%1000 == 0)
+                std::cout << "points:  " << next << " / " << num << std::endl;
+
+            if (Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+                break;
+        }
+
+        return 0;
+    }
+}
@@ -0,0 +1,76 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Surrogate-model pre-screening meta-plugin.
+///
+///  Runs another scanner plugin (selected by its
+///  tag under "scanners") with its likelihood
+///  wrapped by a k-nearest-neighbour surrogate.
+///  Points confidently predicted to lie far below
+///  the best lnL found so far are not evaluated,
+///  and are flagged as "surrogate_skipped" in the
+///  printer output.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <vector>
+#include <string>
+#include <iostream>
+
+#include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "gambit/ScannerBit/plugin_interface.hpp"
+#include "gambit/ScannerBit/scanners/surrogate/surrogate.hpp"
+
+scanner_plugin(surrogate, version(1, 0, 0))
+{
+    reqd_inifile_entries("scanner");
+
+    int plugin_main ()
+    {
+        std::string inner = get_inifile_value<std::string>("scanner");
+        std::string purpose = get_inifile_value<std::string>("like", "LogLike");
+        unsigned int dim = get_dimension();
+
+        Gambit::Surrogate::surrogate_settings settings;
+        settings.k = get_inifile_value<int>("neighbours", 10);
+        settings.min_training = get_inifile_value<int>("min_training", 200);
+        settings.max_training = get_inifile_value<int>("max_training", 5000);
+        settings.delta_lnL = get_inifile_value<double>("delta_lnL", 50.0);
+        settings.n_sigma = get_inifile_value<double>("n_sigma", 2.0);
+        settings.max_distance = get_inifile_value<double>("max_distance", 0.05);
+        settings.true_fraction = get_inifile_value<double>("true_fraction", 0.1);
+
+        if (settings.min_training < settings.k)
+            scan_err << "Surrogate:  min_training must be at least as large as neighbours." << scan_end;
+        if (settings.max_training < settings.min_training)
+            scan_err << "Surrogate:  max_training must be at least as large as min_training." << scan_end;
+        if (settings.true_fraction < 0.0 or settings.true_fraction > 1.0)
+            scan_err << "Surrogate:  true_fraction must lie between 0 and 1." << scan_end;
+
+        Gambit::Surrogate::surrogate_stats stats;
+        Gambit::Surrogate::surrogate_factory factory(get_input_value<Factory_Base>(1), purpose, settings, stats);
+        const Factory_Base &factory_base = factory;
+
+        Gambit::Scanner::assign_aux_numbers("surrogate_skipped");
+
+        std::cout << "Entering surrogate pre-screening, wrapping scanner \"" << inner << "\"." << std::endl;
+        {
+            Gambit::Scanner::Plugins::Plugin_Interface<int ()> plugin_interface("scanner", inner, dim, factory_base);
+            plugin_interface();
+        }
+
+        long long total = stats.evaluated + stats.skipped;
+        std::cout << "Surrogate pre-screening:  " << stats.evaluated << " of " << total << " likelihood calls evaluated exactly, "
+                  << stats.skipped << " skipped." << std::endl;
+
+        return 0;
+    }
+}
@@ -0,0 +1,205 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Surrogate-model pre-screening of likelihood
+///  evaluations for any scanner plugin.
+///
+///  Surrogate model, likelihood wrapper and
+///  factory implementations.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include <map>
+
+#include "gambit/ScannerBit/scanners/surrogate/surrogate.hpp"
+#include "gambit/Utils/threadsafe_rng.hpp"
+
+namespace Gambit
+{
+  namespace Surrogate
+  {
+
+    knn_surrogate::knn_surrogate(int dim, int max_size)
+      : dim(dim), max_size(max_size), next(0),
+        low(dim, std::numeric_limits<double>::max()), high(dim, -std::numeric_limits<double>::max())
+    {}
+
+    void knn_surrogate::add(const std::vector<double> &x, double lnL)
+    {
+      for (int i = 0; i < dim; i++)
+      {
+        low[i] = std::min(low[i], x[i]);
+        high[i] = std::max(high[i], x[i]);
+      }
+
+      if ((int)values.size() < max_size)
+      {
+        points.push_back(x);
+        values.push_back(lnL);
+      }
+      else
+      {
+        // Replace the oldest training point.
+        points[next] = x;
+        values[next] = lnL;
+        next = (next + 1) % max_size;
+      }
+    }
+
+    bool knn_surrogate::predict(const std::vector<double> &x, int k, double floor, double &mean, double &sigma, double &nearest) const
+    {
+      int N = values.size();
+      if (N < k or k <= 0) return false;
+
+      std::vector<double> scale(dim);
+      for (int i = 0; i < dim; i++)
+        scale[i] = (high[i] > low[i] ? 1.0/(high[i] - low[i]) : 1.0);
+
+      std::vector<std::pair<double, int>> dist(N);
+      for (int n = 0; n < N; n++)
+      {
+        double d2 = 0.0;
+        for (int i = 0; i < dim; i++)
+        {
+          double d = (x[i] - points[n][i])*scale[i];
+          d2 += d*d;
+        }
+        dist[n] = std::make_pair(d2, n);
+      }
+      std::partial_sort(dist.begin(), dist.begin() + k, dist.end());
+
+      double sum = 0.0, sum2 = 0.0;
+      for (int j = 0; j < k; j++)
+      {
+        double v = std::max(values[dist[j].second], floor);
+        sum += v;
+        sum2 += v*v;
+      }
+      mean = sum/k;
+      sigma = std::sqrt(std::max(sum2/k - mean*mean, 0.0));
+      nearest = std::sqrt(dist[0].first);
+
+      return true;
+    }
+
+    surrogate_function::surrogate_function(like_base *real, const surrogate_settings &settings, surrogate_stats &stats)
+      : real(real), settings(settings), stats(stats), model(0, settings.max_training),
+        best(-std::numeric_limits<double>::max()), synced(false)
+    {}
+
+    surrogate_function::~surrogate_function()
+    {
+      Scanner::Function_Deleter<double (std::unordered_map<std::string, double> &)>(real)(real);
+    }
+
+    double surrogate_function::main(std::unordered_map<std::string, double> &map)
+    {
+      // The wrapped scanner sets up this object after the factory returns it, so hand
+      // the same setup on to the real likelihood the first time it is needed.
+      if (not synced)
+      {
+        real->setPurpose(getPurpose());
+        real->setPrinter(&getPrinter());
+        real->setPrior(&getPrior());
+        if (scanner_can_quit()) real->disable_external_shutdown();
+        keys = getParameters();
+        x.resize(keys.size());
+        model = knn_surrogate(keys.size(), settings.max_training);
+        synced = true;
+      }
+
+      for (int i = 0, end = keys.size(); i < end; i++)
+        x[i] = map[keys[i]];
+
+      bool skip = false;
+      double lnL = 0.0;
+
+      if (model.size() >= settings.min_training)
+      {
+        double mean, sigma, nearest;
+        double threshold = best - settings.delta_lnL;
+        if (model.predict(x, settings.k, best - 2.0*settings.delta_lnL, mean, sigma, nearest) and
+            nearest <= settings.max_distance and
+            mean + settings.n_sigma*sigma < threshold and
+            Random::draw() >= settings.true_fraction)
+        {
+          skip = true;
+          lnL = mean;
+        }
+      }
+
+      if (skip)
+      {
+        print_parameters(map);
+        stats.skipped++;
+      }
+      else
+      {
+        lnL = real->main(map);
+        model.add(x, lnL);
+        best = std::max(best, lnL);
+        stats.evaluated++;
+      }
+
+      getPrinter().print(int(skip), "surrogate_skipped", getRank(), getPtID());
+
+      return lnL;
+    }
+
+    void surrogate_function::print_parameters(std::unordered_map<std::string, double> &map)
+    {
+      // Print the parameters as the real likelihood would have: those of GAMBIT models
+      // ("model::parameter") as the ModelParameters of each model's primary_parameters functor,
+      // and any others under their own names, as the ScannerBit objectives do.
+      std::map<std::string, ModelParameters> models;
+      Scanner::printer &out = getPrinter();
+      int rank = getRank();
+      unsigned long long int id = getPtID();
+      #pragma omp critical (gambit_scanner_printer)
+      {
+        for (const std::string &key : keys)
+        {
+          std::string::size_type pos = key.find("::");
+          if (pos == std::string::npos)
+          {
+            out.print(map[key], key, Printers::get_main_param_id(key), rank, id);
+          }
+          else
+          {
+            ModelParameters &params = models[key.substr(0, pos)];
+            params._definePar(key.substr(pos + 2));
+            params.setValue(key.substr(pos + 2), map[key]);
+          }
+        }
+        for (auto &&model : models)
+        {
+          std::string label = "#" + model.first + "_parameters @" + model.first + "::primary_parameters";
+          out.print(model.second, label, Printers::get_main_param_id(label), rank, id);
+        }
+      }
+    }
+
+    void *surrogate_factory::operator()(const std::string &in_purpose) const
+    {
+      void *ptr = factory(in_purpose);
+
+      // Only the screened likelihood is wrapped; any other purpose goes straight to the original factory.
+      if (ptr == NULL or in_purpose != purpose) return ptr;
+
+      like_base *wrapped = new surrogate_function(static_cast<like_base *>(ptr), settings, stats);
+      return static_cast<void *>(wrapped);
+    }
+
+  }
+}
@@ -66,6 +66,7 @@ if(EXISTS "${PROJECT_SOURCE_DIR}/ScannerBit/")
   set(clean_files ${clean_files} "${PROJECT_BINARY_DIR}/linkedout.cmake")
   set(clean_files ${clean_files} "${PROJECT_SOURCE_DIR}/scratch/scanbit_reqd_entries.yaml")
   set(clean_files ${clean_files} "${PROJECT_SOURCE_DIR}/scratch/scanbit_flags.yaml")
+  set(clean_files ${clean_files} "${PROJECT_SOURCE_DIR}/scratch/scanbit_plugin_registry.yaml")
 endif()
 
 # Add all the clean files
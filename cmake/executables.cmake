@@ -80,6 +80,23 @@ if(EXISTS "${PROJECT_SOURCE_DIR}/ScannerBit/")
     target_compile_definitions(Printers PRIVATE SCANNER_STANDALONE)
   endif()
   add_dependencies(standalones ScannerBit_standalone)
+
+  # Check of the array and batch prior transforms against the map-based one
+  add_gambit_executable(ScannerBit_prior_transform_check "${ScannerBit_XTRA}"
+                        SOURCES ${PROJECT_SOURCE_DIR}/ScannerBit/examples/ScannerBit_prior_transform_check.cpp
+                                $<TARGET_OBJECTS:ScannerBit>
+                                $<TARGET_OBJECTS:Printers>
+                                ${GAMBIT_BASIC_COMMON_OBJECTS}
+  )
+  if(EXISTS "${PROJECT_SOURCE_DIR}/Elements/")
+    if (NOT EXCLUDE_FLEXIBLESUSY)
+      add_dependencies(ScannerBit_prior_transform_check flexiblesusy)
+    endif()
+    if (NOT EXCLUDE_DELPHES)
+      add_dependencies(ScannerBit_prior_transform_check delphes)
+    endif()
+  endif()
+  add_dependencies(standalones ScannerBit_prior_transform_check)
 endif()
 
 # Add C++ hdf5 combine tool, if we have HDF5 libraries
@@ -23,3 +23,16 @@ add_standalone(DarkBit_standalone_SingletDM SOURCES DarkBit/examples/DarkBit_sta
 add_standalone(DarkBit_standalone_WIMP SOURCES DarkBit/examples/DarkBit_standalone_WIMP.cpp MODULES DarkBit)
 add_standalone(3bithit SOURCES DecayBit/examples/3bithit.cpp MODULES DecayBit SpecBit PrecisionBit)
 add_standalone(FlavBit_standalone SOURCES FlavBit/examples/FlavBit_standalone_example.cpp MODULES FlavBit)
+
+# ColliderBit benchmarks and checks.  Each links the whole of ColliderBit, so they are only built by
+# "make colliderbit_checks", or individually by name.
+add_custom_target(colliderbit_checks)
+add_standalone(ColliderBit_LEP_limits_benchmark SOURCES ColliderBit/examples/ColliderBit_LEP_limits_benchmark.cpp MODULES ColliderBit TARGET colliderbit_checks)
+add_standalone(ColliderBit_jet_clustering_benchmark SOURCES ColliderBit/examples/ColliderBit_jet_clustering_benchmark.cpp MODULES ColliderBit TARGET colliderbit_checks)
+add_standalone(ColliderBit_marg_poisson_benchmark SOURCES ColliderBit/examples/ColliderBit_marg_poisson_benchmark.cpp MODULES ColliderBit TARGET colliderbit_checks)
+add_standalone(ColliderBit_analysis_combine_benchmark SOURCES ColliderBit/examples/ColliderBit_analysis_combine_benchmark.cpp MODULES ColliderBit TARGET colliderbit_checks)
+add_standalone(ColliderBit_result_collection_benchmark SOURCES ColliderBit/examples/ColliderBit_result_collection_benchmark.cpp MODULES ColliderBit TARGET colliderbit_checks)
+add_standalone(ColliderBit_pythia_reinit_check SOURCES ColliderBit/examples/ColliderBit_pythia_reinit_check.cpp MODULES ColliderBit TARGET colliderbit_checks)
+add_standalone(ColliderBit_preselection_check SOURCES ColliderBit/examples/ColliderBit_preselection_check.cpp MODULES ColliderBit TARGET colliderbit_checks)
+add_standalone(ColliderBit_ancestry_check SOURCES ColliderBit/examples/ColliderBit_ancestry_check.cpp MODULES ColliderBit TARGET colliderbit_checks)
+add_standalone(ColliderBit_event_cache_benchmark SOURCES ColliderBit/examples/ColliderBit_event_cache_benchmark.cpp MODULES ColliderBit TARGET colliderbit_checks)
@@ -283,9 +283,9 @@ endfunction()
 # Standalone harvester script
 set(STANDALONE_FACILITATOR ${PROJECT_SOURCE_DIR}/Elements/scripts/standalone_facilitator.py)
 
-# Function to add a standalone executable
+# Function to add a standalone executable, built by the standalones target or by the TARGET given
 function(add_standalone executablename)
-  cmake_parse_arguments(ARG "" "" "SOURCES;HEADERS;LIBRARIES;MODULES" ${ARGN})
+  cmake_parse_arguments(ARG "" "TARGET" "SOURCES;HEADERS;LIBRARIES;MODULES" ${ARGN})
 
   # Iterate over modules, checking if the neccessary ones are present, and adding them to the target objects if so.
   set(standalone_permitted 1)
@@ -350,8 +350,12 @@ function(add_standalone executablename)
       add_dependencies(${executablename} delphes)
     endif()
 
-    # Add the new executable to the standalones target
-    add_dependencies(standalones ${executablename})
+    # Add the new executable to the standalones target, unless another target is given
+    if(ARG_TARGET)
+      add_dependencies(${ARG_TARGET} ${executablename})
+    else()
+      add_dependencies(standalones ${executablename})
+    endif()
 
   endif()
 
@@ -11,6 +11,7 @@
 #include "HEPUtils/Particle.h"
 #include "HEPUtils/Jet.h"
 #include <algorithm>
+#include <cassert>
 
 namespace HEPUtils {
 
@@ -33,6 +34,9 @@ namespace HEPUtils {
     /// Missing momentum vector
     P4 _pmiss;
 
+    /// Event weights
+    std::vector<double> _weights;
+
     //@}
 
   private:
@@ -48,6 +52,7 @@ namespace HEPUtils {
       _invisibles = e._invisibles;
       _jets = e._jets;
       _pmiss = e._pmiss;
+      _weights = e._weights;
       //return *this;
     }
 
@@ -94,15 +99,19 @@ namespace HEPUtils {
 
     /// Clone a deep copy (new Particles and Jets allocated) into the provided event object
     void cloneTo(Event& e) const {
-      const std::vector<Particle*> ps = particles();
-      for (size_t i = 0; i < ps.size(); ++i) {
-        e.add_particle(new Particle(*ps[i]));
-      }
-      const std::vector<Jet*> js = jets();
+      #define CLONE_VEC(vec) for (size_t i = 0; i < vec.size(); ++i) e.add_particle(new Particle(*vec[i]))
+      CLONE_VEC(_photons);
+      CLONE_VEC(_electrons);
+      CLONE_VEC(_muons);
+      CLONE_VEC(_taus);
+      CLONE_VEC(_invisibles);
+      #undef CLONE_VEC
+      const std::vector<Jet*>& js = jets();
       for (size_t i = 0; i < js.size(); ++i) {
         e.add_jet(new Jet(*js[i]));
       }
       e._pmiss = _pmiss;
+      e._weights = _weights;
     }
 
     //@}
@@ -122,6 +131,7 @@ namespace HEPUtils {
       #undef DELCLEAR
 
       _pmiss.clear();
+      _weights.clear();
     }
 
 
@@ -184,6 +194,21 @@ namespace HEPUtils {
     }
 
 
+    /// Get all final state particles, filling the supplied vector
+    ///
+    /// This reuses the vector's memory, so avoids allocation when called repeatedly with the same vector.
+    void particles(std::vector<Particle*>& rtn) const {
+      rtn.clear();
+      #define APPEND_VEC(vec) rtn.insert(rtn.end(), vec.begin(), vec.end())
+      APPEND_VEC(_photons);
+      APPEND_VEC(_electrons);
+      APPEND_VEC(_muons);
+      APPEND_VEC(_taus);
+      APPEND_VEC(_invisibles);
+      #undef APPEND_VEC
+    }
+
+
     /// Get visible state particles
     /// @todo Note the return by value: it's not efficient yet!
     /// @note Overlap of taus and e/mu
@@ -203,6 +228,20 @@ namespace HEPUtils {
     }
 
 
+    /// Get visible state particles, filling the supplied vector
+    ///
+    /// This reuses the vector's memory, so avoids allocation when called repeatedly with the same vector.
+    void visible_particles(std::vector<Particle*>& rtn) const {
+      rtn.clear();
+      #define APPEND_VEC(vec) rtn.insert(rtn.end(), vec.begin(), vec.end())
+      APPEND_VEC(_photons);
+      APPEND_VEC(_electrons);
+      APPEND_VEC(_muons);
+      APPEND_VEC(_taus);
+      #undef APPEND_VEC
+    }
+
+
     /// Get invisible final state particles
     const std::vector<Particle*>& invisible_particles() const {
       return _invisibles;
@@ -312,6 +351,39 @@ namespace HEPUtils {
     //@}
 
 
+    /// @name Event weights
+    //@{
+
+    /// Set the event weights
+    void set_weights(const std::vector<double>& ws) {
+      _weights = ws;
+    }
+
+    /// Set the event weights to the single given weight
+    void set_weight(double w) {
+      _weights.clear();
+      _weights.push_back(w);
+    }
+
+    /// Get the event weights
+    const std::vector<double>& weights() const {
+      return _weights;
+    }
+
+    /// Get a single event weight -- the nominal, by default
+    ///
+    /// An event without weights has a nominal weight of 1.
+    double weight(size_t i=0) const {
+      if (_weights.empty()) {
+        assert(i == 0);
+        return 1;
+      }
+      return _weights.at(i);
+    }
+
+    //@}
+
+
   };
 
 
@@ -10,6 +10,7 @@
 
 #include "HEPUtils/MathUtils.h"
 #include "HEPUtils/Vectors.h"
+#include "HEPUtils/Pool.h"
 
 namespace HEPUtils {
 
@@ -29,6 +30,10 @@ namespace HEPUtils {
 
   public:
 
+    /// Jets are allocated from a per-thread pool, since very many are made and deleted per event
+    HEPUTILS_POOL_ALLOCATED(Jet)
+
+
     /// @name Constructors
     //@{
 
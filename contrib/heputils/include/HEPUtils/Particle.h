@@ -10,6 +10,7 @@
 
 #include "HEPUtils/MathUtils.h"
 #include "HEPUtils/Vectors.h"
+#include "HEPUtils/Pool.h"
 
 namespace HEPUtils {
 
@@ -35,6 +36,10 @@ namespace HEPUtils {
 
   public:
 
+    /// Particles are allocated from a per-thread pool, since very many are made and deleted per event
+    HEPUTILS_POOL_ALLOCATED(Particle)
+
+
     /// @name Constructors
     //@{
 
@@ -0,0 +1,149 @@
+// -*- C++ -*-
+//
+// This file is part of HEPUtils -- https://bitbucket.org/andybuckley/heputils
+// Copyright (C) 2013-2016 Andy Buckley <andy.buckley@cern.ch>
+//
+// Embedding of HEPUtils code in other projects is permitted provided this
+// notice is retained and the HEPUtils namespace and include path are changed.
+//
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace HEPUtils {
+
+
+  /// @brief Per-thread free-list allocator for small event objects of type T
+  ///
+  /// Memory is taken from the heap in blocks of many objects and, once freed, is
+  /// kept on a free list of the thread that allocated it, so that the objects of
+  /// each new event reuse the memory of the last event's objects.  An object freed
+  /// by another thread goes back to its owning thread through a lock-free list,
+  /// which the owner takes over once its own free list runs out.  The memory held
+  /// by each thread is thus bounded by the most objects it has had alive at once.
+  ///
+  /// Blocks are never returned to the heap.  The free lists of a thread outlive
+  /// it, so that its objects may still be freed after it has exited, and are
+  /// taken over by the next new thread.
+  ///
+  /// Classes use this by forwarding their class-specific operator new and delete.
+  template <typename T>
+  class Pool {
+  private:
+
+    struct Owner;
+
+    /// A slot for one T, tagged with the thread bookkeeping it belongs to
+    struct Slot {
+      Owner* owner;
+      union {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+      };
+    };
+
+    /// The free lists of one thread
+    struct Owner {
+      /// Free slots, only touched by the owning thread
+      Slot* head;
+      /// Slots freed by other threads, pushed by them and taken all at once by the owner
+      std::atomic<Slot*> returned;
+      Owner() : head(nullptr), returned(nullptr) {}
+    };
+
+    /// Number of objects allocated from the heap at a time
+    static const size_t BLOCKSIZE = 256;
+
+    /// Free lists of exited threads, waiting for a new thread to take them over
+    static std::vector<Owner*>& _orphans() {
+      static std::vector<Owner*> orphans;
+      return orphans;
+    }
+    static std::mutex& _orphansMutex() {
+      static std::mutex m;
+      return m;
+    }
+
+    /// Hands a thread's free lists on to the orphans when the thread exits
+    struct OwnerHandle {
+      Owner* owner;
+      OwnerHandle() {
+        std::lock_guard<std::mutex> lock(_orphansMutex());
+        std::vector<Owner*>& orphans = _orphans();
+        if (orphans.empty()) {
+          owner = new Owner();
+        } else {
+          owner = orphans.back();
+          orphans.pop_back();
+        }
+      }
+      ~OwnerHandle() {
+        std::lock_guard<std::mutex> lock(_orphansMutex());
+        _orphans().push_back(owner);
+      }
+    };
+
+    /// This thread's free lists
+    static Owner& _owner() {
+      static thread_local OwnerHandle handle;
+      return *handle.owner;
+    }
+
+    /// The slot holding the object at @a p
+    static Slot* _slot(void* p) {
+      return reinterpret_cast<Slot*>(static_cast<unsigned char*>(p) - offsetof(Slot, storage));
+    }
+
+  public:
+
+    /// Get memory for one T
+    static void* allocate() {
+      Owner& owner = _owner();
+      if (owner.head == nullptr) owner.head = owner.returned.exchange(nullptr, std::memory_order_acquire);
+      if (owner.head == nullptr) {
+        Slot* block = static_cast<Slot*>(::operator new(BLOCKSIZE * sizeof(Slot)));
+        for (size_t i = 0; i < BLOCKSIZE; ++i) {
+          block[i].owner = &owner;
+          block[i].next = (i + 1 < BLOCKSIZE) ? &block[i+1] : nullptr;
+        }
+        owner.head = block;
+      }
+      Slot* rtn = owner.head;
+      owner.head = rtn->next;
+      return rtn->storage;
+    }
+
+    /// Return memory obtained from allocate() to the free lists of the thread that allocated it
+    static void deallocate(void* p) {
+      if (p == nullptr) return;
+      Slot* s = _slot(p);
+      Owner* owner = s->owner;
+      if (owner == &_owner()) {
+        s->next = owner->head;
+        owner->head = s;
+      } else {
+        s->next = owner->returned.load(std::memory_order_relaxed);
+        while (!owner->returned.compare_exchange_weak(s->next, s, std::memory_order_release, std::memory_order_relaxed)) {}
+      }
+    }
+
+  };
+
+
+  /// @brief Define class-specific operator new/delete for CLASS that use Pool<CLASS>
+  ///
+  /// Objects of derived classes with a different size go to the global heap as usual.
+  #define HEPUTILS_POOL_ALLOCATED(CLASS)                                  \
+    static void* operator new(size_t size) {                            \
+      return size == sizeof(CLASS) ? Pool<CLASS>::allocate() : ::operator new(size); \
+    }                                                                   \
+    static void operator delete(void* p, size_t size) {                 \
+      if (size == sizeof(CLASS)) Pool<CLASS>::deallocate(p); else ::operator delete(p); \
+    }
+
+
+}